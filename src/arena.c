@@ -0,0 +1,86 @@
+/**
+  @file arena.c
+
+  @brief Per-simulation bump allocator. The UPDATE matrix, the function
+  pointer tables and the integrator's scratch arrays consist of thousands of
+  small arrays that are allocated once during verification and are needed
+  until the end of the run. They are carved out of a few large blocks, which
+  keeps them close together in memory and lets them all be freed with a
+  single call when the simulation ends.
+
+  @date Oct 18 2026
+
+*/
+
+#include "vplanet.h"
+
+/*!
+Start an empty arena. No memory is allocated until the first request.
+*/
+void ArenaInit(ARENA *arena) {
+  arena->pBlock = NULL;
+  arena->iTotal = 0;
+}
+
+/* Add a block with room for at least iSize bytes. */
+void ArenaNewBlock(ARENA *arena, size_t iSize) {
+  ARENABLOCK *block;
+
+  if (iSize < ARENABLOCKSIZE) {
+    iSize = ARENABLOCKSIZE;
+  }
+  block = malloc(sizeof(ARENABLOCK));
+  if (block != NULL) {
+    block->caData = calloc(iSize, 1);
+  }
+  if (block == NULL || block->caData == NULL) {
+    fprintf(stderr, "ERROR: Unable to allocate %zu bytes.\n", iSize);
+    exit(EXIT_EXE);
+  }
+  block->iSize  = iSize;
+  block->iUsed  = 0;
+  block->pNext  = arena->pBlock;
+  arena->pBlock = block;
+}
+
+/*!
+Return iSize bytes of zeroed memory that stays valid until ArenaRelease is
+called. The memory must not be passed to free or realloc.
+*/
+void *ArenaAlloc(ARENA *arena, size_t iSize) {
+  void *pMemory;
+
+  // Round up so every allocation stays aligned
+  iSize = (iSize + ARENAALIGN - 1) & ~((size_t)ARENAALIGN - 1);
+  if (iSize == 0) {
+    iSize = ARENAALIGN;
+  }
+  if (arena->pBlock == NULL ||
+      arena->pBlock->iUsed + iSize > arena->pBlock->iSize) {
+    ArenaNewBlock(arena, iSize);
+  }
+  pMemory = arena->pBlock->caData + arena->pBlock->iUsed;
+  arena->pBlock->iUsed += iSize;
+  arena->iTotal += iSize;
+
+  return pMemory;
+}
+
+void *ArenaCalloc(ARENA *arena, size_t iNum, size_t iSize) {
+  return ArenaAlloc(arena, iNum * iSize);
+}
+
+/*!
+Free every allocation made from the arena.
+*/
+void ArenaRelease(ARENA *arena) {
+  ARENABLOCK *block;
+
+  while (arena->pBlock != NULL) {
+    block         = arena->pBlock;
+    arena->pBlock = block->pNext;
+    free(block->caData);
+    free(block);
+  }
+  arena->iTotal = 0;
+}
@@ -0,0 +1,21 @@
+/**
+  @file arena.h
+
+  @brief Per-simulation bump allocator.
+
+  @date Oct 18 2026
+
+*/
+
+#define ARENABLOCKSIZE 1048576 /**< Default size of an arena block (bytes) */
+#define ARENAALIGN 16          /**< Alignment of every allocation (bytes) */
+
+/* @cond DOXYGEN_OVERRIDE */
+
+void ArenaInit(ARENA *);
+void ArenaNewBlock(ARENA *, size_t);
+void *ArenaAlloc(ARENA *, size_t);
+void *ArenaCalloc(ARENA *, size_t, size_t);
+void ArenaRelease(ARENA *);
+
+/* @endcond */
@@ -4027,10 +4027,21 @@ The rate of change of the envelope mass given Bondi-limited escape.
 double fdDEnvelopeMassDtBondiLimited(BODY *body, SYSTEM *system, int *iaBody) {
 
   // Compute Bondi-limited mass loss rate where body 0 is always the host star
-  double dMDt = -1.9e15 * (body[iaBody[0]].dMass / (10.0 * MEARTH)) /
-                sqrt(body[0].dTemperature / 5800.0);
+  STARMEMO *memo = &body[0].StarMemo;
+  double dMDt;
+
+  if (memo->dBondiTemperature != body[0].dTemperature) {
+    memo->dBondiTempFactor  = sqrt(body[0].dTemperature / 5800.0);
+    memo->dBondiTemperature = body[0].dTemperature;
+  }
+  if (memo->dBondiRadius != body[0].dRadius) {
+    memo->dBondiRadiusFactor = pow(body[0].dRadius / RSUN, 0.25);
+    memo->dBondiRadius       = body[0].dRadius;
+  }
+  dMDt = -1.9e15 * (body[iaBody[0]].dMass / (10.0 * MEARTH)) /
+         memo->dBondiTempFactor;
   dMDt = dMDt * pow(body[iaBody[0]].dSemi / (0.1 * AUM), 0.25) /
-         pow(body[0].dRadius / RSUN, 0.25);
+         memo->dBondiRadiusFactor;
 
   return dMDt;
 }
@@ -4263,23 +4274,27 @@ double fdHZRG14(BODY *body, int iBody) {
   // Do a simple log-linear fit to the Kopparapu+14 mass-dependent RG limit
   int i;
   double seff[3];
-  double daCoeffs[2];
+  double *daCoeffs = body[0].StarMemo.daHZRG14Coeff;
   double dHZRG14Limit;
 
-  double tstar      = body[0].dTemperature - 5780;
-  double daLogMP[3] = {-1.0, 0., 0.69897};
-  double seffsun[3] = {0.99, 1.107, 1.188};
-  double a[3]       = {1.209e-4, 1.332e-4, 1.433e-4};
-  double b[3]       = {1.404e-8, 1.58e-8, 1.707e-8};
-  double c[3]       = {-7.418e-12, -8.308e-12, -8.968e-12};
-  double d[3]       = {-1.713e-15, -1.931e-15, -2.084e-15};
-
-  for (i = 0; i < 3; i++) {
-    seff[i] = seffsun[i] + a[i] * tstar + b[i] * tstar * tstar +
-              c[i] * pow(tstar, 3) + d[i] * pow(tstar, 4);
-  }
+  // The fit depends only on the star, so all planets share it
+  if (body[0].StarMemo.dHZRG14Temperature != body[0].dTemperature) {
+    double tstar      = body[0].dTemperature - 5780;
+    double daLogMP[3] = {-1.0, 0., 0.69897};
+    double seffsun[3] = {0.99, 1.107, 1.188};
+    double a[3]       = {1.209e-4, 1.332e-4, 1.433e-4};
+    double b[3]       = {1.404e-8, 1.58e-8, 1.707e-8};
+    double c[3]       = {-7.418e-12, -8.308e-12, -8.968e-12};
+    double d[3]       = {-1.713e-15, -1.931e-15, -2.084e-15};
+
+    for (i = 0; i < 3; i++) {
+      seff[i] = seffsun[i] + a[i] * tstar + b[i] * tstar * tstar +
+                c[i] * pow(tstar, 3) + d[i] * pow(tstar, 4);
+    }
 
-  fvLinearFit(daLogMP, seff, 3, daCoeffs);
+    fvLinearFit(daLogMP, seff, 3, daCoeffs);
+    body[0].StarMemo.dHZRG14Temperature = body[0].dTemperature;
+  }
 
   dHZRG14Limit =
         (daCoeffs[0] * log10(body[iBody].dMass / MEARTH) + daCoeffs[1]) * LSUN /
@@ -785,70 +785,228 @@ double fdHflowSecMan(BODY *body, EVOLVE *evolve, int iBody) {
 
 
 /**
-  For use with `fdProximaCenStellar()` to interpolate stellar properties
-  (temperature, radius, luminosity) from a grid.
+  Whether a value lies in a cell of an increasing grid, in the sense of
+  fiGridHunt: values below the grid belong to the first cell and values above
+  it to the last.
+
+  @param dVal Value to locate
+  @param daNode Grid points
+  @param iLen Number of grid points
+  @param iCell Index of the lower grid point of the cell
+
+  @return 1 if dVal is in cell iCell, 0 otherwise
+*/
+int fbGridInCell(double dVal, const double *daNode, int iLen, int iCell) {
+  return iCell >= 0 && iCell <= iLen - 2 &&
+         (iCell == 0 || dVal >= daNode[iCell]) &&
+         (iCell == iLen - 2 || dVal < daNode[iCell + 1]);
+}
 
-  @param dVal Value of (temperature, radius, luminosity)
-  @param daArr Array of values from Yonsei-Yale tracks
-  @param iDim Length of array
-  @param iIndex Index of dArr correpoinding to the value
+/**
+  Find the cell of an increasing grid that contains a value, i.e. the first
+  i with dVal < daNode[i + 1], or iLen - 2 if there is none. The search
+  starts from the cell found by the previous call, which is almost always
+  still correct, then tries the next cell and falls back to bisection.
+
+  @param dVal Value to locate
+  @param daNode Grid points
+  @param iLen Number of grid points
+  @param piHint Cell of the previous call, updated to the cell found
 
-  @return iIndex
+  @return Index of the lower grid point of the cell
 */
-int fiGetLowerBoundProximaCen(double dVal, const double *daArr, int iDim) {
-  int iIndex;
-  for (iIndex = 0; iIndex < iDim - 2; iIndex++) {
-    if (dVal < daArr[iIndex + 1]) {
-      break;
+int fiGridHunt(double dVal, const double *daNode, int iLen, int *piHint) {
+  int i = *piHint, iHi, iMid;
+
+  if (fbGridInCell(dVal, daNode, iLen, i)) {
+    return i;
+  }
+  if (fbGridInCell(dVal, daNode, iLen, i + 1)) {
+    // Moved into the next cell
+    *piHint = i + 1;
+    return i + 1;
+  }
+  i   = 0;
+  iHi = iLen - 2;
+  while (i < iHi) {
+    iMid = (i + iHi) / 2;
+    if (dVal < daNode[iMid + 1]) {
+      iHi = iMid;
+    } else {
+      i = iMid + 1;
     }
   }
-  return iIndex;
+  *piHint = i;
+  return i;
 }
 
 /**
-  For use with `fdProximaCenStellar()` to interpolate stellar properties
-  (temperature, radius, luminosity) from a grid. This function
-  linearly interpolates over data, given indices of lower bounds on grid xi, yi
-  and normalized distances to the interpolation point dx, dy.
+  Clamp a value to the range of an increasing grid.
+
+  @param dVal Value to clamp
+  @param daNode Grid points
+  @param iLen Number of grid points
 
- What are these arguments?
+  @return The nearest value in [daNode[0], daNode[iLen - 1]]
 */
-double fdProximaCenBiLinear(int iALEN, double const data_lo[PROXIMACEN_ALEN],
-                            double const data_hi[PROXIMACEN_ALEN], int xi,
-                            int yi, double dx, double dy) {
-  double C0, C1, C;
-  if (dx == 0) {
-    C0 = data_lo[xi];
-    C1 = data_hi[xi];
-  } else {
-    C0 = data_lo[xi] * (1 - dx) + data_lo[xi + 1] * dx;
-    C1 = data_hi[xi] * (1 - dx) + data_hi[xi + 1] * dx;
+double fdGridClamp(double dVal, const double *daNode, int iLen) {
+  if (dVal < daNode[0]) {
+    return daNode[0];
+  } else if (dVal > daNode[iLen - 1]) {
+    return daNode[iLen - 1];
   }
-  if (dy == 0) {
-    C = C0;
-  } else {
-    C = C0 * (1 - dy) + C1 * dy;
+  return dVal;
+}
+
+/**
+  Find the cell of a grid axis that contains a value and the normalized
+  distance from its lower grid point. Values outside the axis are
+  extrapolated from the first or last cell, so callers that want the table
+  clamped must clamp the value first.
+
+  @param axis The axis, whose hint is updated
+  @param dVal Value to locate
+  @param pdFrac Normalized distance from the lower grid point
+
+  @return Index of the lower grid point of the cell
+*/
+int fiGridAxisLocate(GRIDAXIS *axis, double dVal, double *pdFrac) {
+  int i = fiGridHunt(dVal, axis->daNode, axis->iLen, &axis->iHint);
+
+  *pdFrac = (dVal - axis->daNode[i]) * axis->daInvStep[i];
+  return i;
+}
+
+/**
+  Prepare a grid for interpolation. The reciprocal width of every cell of
+  each axis is stored, and the offsets of the corners of a cell from its
+  lower corner are set: corner k is displaced by one grid point along axis d
+  if bit d of k is set. The grids are shared by all bodies and live as long
+  as the program, so the reciprocals are never freed.
+
+  @param grid The grid
+*/
+void fvInterpGridInit(INTERPGRID *grid) {
+  GRIDAXIS *axis;
+  int iDim, iNode, iCorner, iNumCorners = 1;
+
+  grid->iaCornerOffset[0] = 0;
+  for (iDim = 0; iDim < grid->iNumDim; iDim++) {
+    axis            = &grid->aAxis[iDim];
+    axis->daInvStep = malloc((axis->iLen - 1) * sizeof(double));
+    for (iNode = 0; iNode < axis->iLen - 1; iNode++) {
+      axis->daInvStep[iNode] =
+            1 / (axis->daNode[iNode + 1] - axis->daNode[iNode]);
+    }
+    for (iCorner = 0; iCorner < iNumCorners; iCorner++) {
+      grid->iaCornerOffset[iCorner + iNumCorners] =
+            grid->iaCornerOffset[iCorner] + grid->aAxis[iDim].iStride;
+    }
+    iNumCorners *= 2;
   }
-  return C;
+  grid->bInit = 1;
 }
 
 /**
-For use with `fdProximaCenStellar()` to interpolate stellar properties
-(temperature, radius, luminosity) from a grid.
+  Multilinear interpolation in one cell of a grid. The 2^N corner values are
+  combined along the first axis, then the second, and so on.
 
-  What are these arguments?
+  @param grid The grid
+  @param daData The table
+  @param iOffset Index in daData of the lower corner of the cell
+  @param daFrac Normalized distance from the lower corner along each axis
+
+  @return The interpolated value
 */
-double fdProximaCenInterpolate(int iALEN, int iMLEN,
-                               double const xarr[PROXIMACEN_ALEN],
-                               double const yarr[PROXIMACEN_MLEN],
-                               double const data_lo[PROXIMACEN_ALEN],
-                               double const data_hi[PROXIMACEN_ALEN], double A,
-                               double M, int *iError) {
-  double dx, dy;
-  int xi, yi;
-  int dxi, dyi;
-  double result = 0;
+double fdInterpGridCell(const INTERPGRID *grid, const double *daData,
+                        int iOffset, const double *daFrac) {
+  double daCorner[1 << (INTERPGRID_MAXDIM - 1)];
+  const double *daCell = daData + iOffset;
+  int iStride0         = grid->aAxis[0].iStride;
+  int iDim, iCorner, iNumCorners = 1 << (grid->iNumDim - 1);
+  const double *daPair;
+
+  // The first axis is combined as the corners are read
+  for (iCorner = 0; iCorner < iNumCorners; iCorner++) {
+    daPair            = daCell + grid->iaCornerOffset[2 * iCorner];
+    daCorner[iCorner] =
+          daPair[0] * (1 - daFrac[0]) + daPair[iStride0] * daFrac[0];
+  }
+  for (iDim = 1; iDim < grid->iNumDim; iDim++) {
+    iNumCorners /= 2;
+    for (iCorner = 0; iCorner < iNumCorners; iCorner++) {
+      daCorner[iCorner] = daCorner[2 * iCorner] * (1 - daFrac[iDim]) +
+                          daCorner[2 * iCorner + 1] * daFrac[iDim];
+    }
+  }
+  return daCorner[0];
+}
+
+/**
+  Interpolate several tables that share a grid at one point. The point is
+  located once, so this is cheaper than one fdInterpGrid call per table.
+
+  @param grid The grid, whose hints are updated
+  @param daPoint Coordinates of the point, one per axis
+  @param iNumTables Number of tables
+  @param daaData The tables
+  @param daResult The interpolated values, one per table
+*/
+void fvInterpGridBatch(INTERPGRID *grid, const double *daPoint, int iNumTables,
+                       const double *const *daaData, double *daResult) {
+  double daFrac[INTERPGRID_MAXDIM];
+  int iDim, iTable, iOffset = 0;
+
+  if (!grid->bInit) {
+    fvInterpGridInit(grid);
+  }
+  for (iDim = 0; iDim < grid->iNumDim; iDim++) {
+    iOffset += grid->aAxis[iDim].iStride *
+               fiGridAxisLocate(&grid->aAxis[iDim], daPoint[iDim],
+                                &daFrac[iDim]);
+  }
+  for (iTable = 0; iTable < iNumTables; iTable++) {
+    daResult[iTable] =
+          fdInterpGridCell(grid, daaData[iTable], iOffset, daFrac);
+  }
+}
+
+/**
+  Interpolate a table multilinearly at one point.
+
+  @param grid The grid, whose hints are updated
+  @param daData The table
+  @param daPoint Coordinates of the point, one per axis
+
+  @return The interpolated value
+*/
+double fdInterpGrid(INTERPGRID *grid, const double *daData,
+                    const double *daPoint) {
+  double dResult;
+
+  fvInterpGridBatch(grid, daPoint, 1, &daData, &dResult);
+  return dResult;
+}
 
+/**
+  For use with `fdProximaCenStellar()` to interpolate stellar properties
+  (temperature, radius, luminosity) from a grid. The tables are bilinear in
+  log10 of the age and the mass.
+
+  @param iNumTables Number of tables
+  @param daaData The tables, e.g. PROXIMACEN_LOGL
+  @param A Age [Gyr]
+  @param M Mass [MSUN]
+  @param daResult The interpolated values, one per table
+  @param iError Set to 0 on success, or to the reason for failure
+*/
+void fvProximaCenInterpolate(int iNumTables, const double *const *daaData,
+                             double A, double M, double *daResult,
+                             int *iError) {
+  double daPoint[2];
+  int iTable;
+
+  *iError = 0;
   // Let's enforce a minimum age of 0.001 GYR and a maximum age of 10.0 GYR
   // NOTE: This results in a constant luminosity at times beyond this range.
   if (A < 0.001) {
@@ -861,37 +1019,25 @@ double fdProximaCenInterpolate(int iALEN, int iMLEN,
   // Bounds on mass
   if (M < 0.1) {
     *iError = STELLAR_ERR_OUTOFBOUNDS_LO;
-    return 0;
   } else if (M > 0.15) {
     *iError = STELLAR_ERR_OUTOFBOUNDS_HI;
-    return 0;
   }
-
-  // Get the lower bound
-  xi = fiGetLowerBoundProximaCen(log10(A), xarr, iALEN);
-  yi = fiGetLowerBoundProximaCen(M, yarr, iMLEN);
-
-  // Paranoia check (REMOVE)
-  if (yi < 0) {
-    *iError = STELLAR_ERR_OUTOFBOUNDS_LO;
-    return 0;
-  } else if (yi > 1) {
-    *iError = STELLAR_ERR_OUTOFBOUNDS_HI;
-    return 0;
+  if (*iError) {
+    for (iTable = 0; iTable < iNumTables; iTable++) {
+      daResult[iTable] = 0;
+    }
+    return;
   }
 
-  // Normalized distance to grid points
-  dx = (log10(A) - xarr[xi]) / (xarr[xi + 1] - xarr[xi]);
-  dy = (M - yarr[yi]) / (yarr[yi + 1] - yarr[yi]);
-
-  // Calculate
-  result = fdProximaCenBiLinear(iALEN, data_lo, data_hi, xi, yi, dx, dy);
-  if (isnan(result)) {
-    *iError = PROXIMACEN_ERROR;
-    return 0;
+  daPoint[0] = log10(A);
+  daPoint[1] = M;
+  fvInterpGridBatch(&ProxCenGrid, daPoint, iNumTables, daaData, daResult);
+  for (iTable = 0; iTable < iNumTables; iTable++) {
+    if (isnan(daResult[iTable])) {
+      *iError           = PROXIMACEN_ERROR;
+      daResult[iTable] = 0;
+    }
   }
-  *iError = 0;
-  return result;
 }
 
 /**
@@ -922,37 +1068,26 @@ DATA FROM Boyajian+12; SECOND ROW FROM Demory+09 (direct measurements)
 
 */
 double fdProximaCenStellar(int iParam, double A, double M, int *iError) {
-  double res;
+  const double *daaData[2] = {&PROXIMACEN_LOGL[0][0], &PROXIMACEN_LOGR[0][0]};
+  double daRes[2];
   double dLum, dRad;
 
   if (iParam == PROXIMACEN_T) {
-    // Get fudged luminosity
-    dLum = fdProximaCenInterpolate(PROXIMACEN_ALEN, PROXIMACEN_MLEN,
-                                   PROXIMACEN_AARR, PROXIMACEN_MARR,
-                                   PROXIMACEN_LOGL_LO, PROXIMACEN_LOGL_HI,
-                                   A / (1.e9 * YEARSEC), M / MSUN, iError);
-    dLum = LSUN * pow(10., dLum * PROXIMACEN_FUDGE);
-    // Get radius
-    dRad = fdProximaCenInterpolate(PROXIMACEN_ALEN, PROXIMACEN_MLEN,
-                                   PROXIMACEN_AARR, PROXIMACEN_MARR,
-                                   PROXIMACEN_LOGR_LO, PROXIMACEN_LOGR_HI,
-                                   A / (1.e9 * YEARSEC), M / MSUN, iError);
-    dRad = RSUN * pow(10., dRad);
+    // Get fudged luminosity and radius from one lookup
+    fvProximaCenInterpolate(2, daaData, A / (1.e9 * YEARSEC), M / MSUN, daRes,
+                            iError);
+    dLum = LSUN * pow(10., daRes[0] * PROXIMACEN_FUDGE);
+    dRad = RSUN * pow(10., daRes[1]);
     // Compute self-consistent temperature
-    res = pow(dLum / (4 * PI * dRad * dRad * SIGMA), 0.25);
-    return res;
+    return pow(dLum / (4 * PI * dRad * dRad * SIGMA), 0.25);
   } else if (iParam == PROXIMACEN_L) {
-    res = fdProximaCenInterpolate(PROXIMACEN_ALEN, PROXIMACEN_MLEN,
-                                  PROXIMACEN_AARR, PROXIMACEN_MARR,
-                                  PROXIMACEN_LOGL_LO, PROXIMACEN_LOGL_HI,
-                                  A / (1.e9 * YEARSEC), M / MSUN, iError);
-    return LSUN * pow(10., res * PROXIMACEN_FUDGE);
+    fvProximaCenInterpolate(1, daaData, A / (1.e9 * YEARSEC), M / MSUN, daRes,
+                            iError);
+    return LSUN * pow(10., daRes[0] * PROXIMACEN_FUDGE);
   } else if (iParam == PROXIMACEN_R) {
-    res = fdProximaCenInterpolate(PROXIMACEN_ALEN, PROXIMACEN_MLEN,
-                                  PROXIMACEN_AARR, PROXIMACEN_MARR,
-                                  PROXIMACEN_LOGR_LO, PROXIMACEN_LOGR_HI,
-                                  A / (1.e9 * YEARSEC), M / MSUN, iError);
-    return RSUN * pow(10., res);
+    fvProximaCenInterpolate(1, daaData + 1, A / (1.e9 * YEARSEC), M / MSUN,
+                            daRes, iError);
+    return RSUN * pow(10., daRes[0]);
   } else {
     *iError = PROXIMACEN_ERROR;
     return 0;
@@ -960,55 +1095,6 @@ double fdProximaCenStellar(int iParam, double A, double M, int *iError) {
 }
 
 
-/**
-For use with `fdProximaCenBRadius()` to interpolate the radius of
-Proxima Cen b from a grid, assuming it has a gaseous composition
-
-@param dVal Value of (temperature, radius, luminosity)
-@param daArr Array of values from Yonsei-Yale tracks
-@param iDim Length of array
-@param iIndex Index of dArr correpoinding to the value
-
-@return iIndex
-*/
-int fiGetLowerBoundProximaCenB(double dVal, const double *daArr, int iDim) {
-  int iIndex;
-  for (iIndex = 0; iIndex < iDim - 2; iIndex++) {
-    if (dVal < daArr[iIndex + 1]) {
-      break;
-    }
-  }
-  return iIndex;
-}
-
-/**
-  For use with `fdProximaCenBRadius()` to interpolate the radius of
-  Proxima Cen b from a grid, assuming it has a gaseous composition
-
-  What are the arguments?
-*/
-double fdProximaCenBLinear(int xi, int yi, double dx, double dy) {
-  // Linearly interpolate over data, given indices of lower bounds on grid xi,
-  // yi and normalized distances to the interpolation point dx, dy.
-  double C0, C1, C;
-  if (dx == 0) {
-    C0 = daProxCenBRadius[xi][yi];
-    C1 = daProxCenBRadius[xi][yi + 1];
-  } else {
-    C0 = daProxCenBRadius[xi][yi] * (1 - dx) +
-         daProxCenBRadius[xi + 1][yi] * dx;
-    C1 = daProxCenBRadius[xi][yi + 1] * (1 - dx) +
-         daProxCenBRadius[xi + 1][yi + 1] * dx;
-  }
-  if (dy == 0) {
-    C = C0;
-  } else {
-    C = C0 * (1 - dy) + C1 * dy;
-  }
-
-  return C;
-}
-
 /**
 For use with `fdProximaCenBRadius()` to interpolate the radius of
 Proxima Cen b from a grid, assuming it has a gaseous composition
@@ -1020,8 +1106,7 @@ and smoothing over sharp (presumably) numerical features.
   What are the arguments?
 */
 double fdProximaCenBRadius(double C, double A, double M) {
-  double dx, dy;
-  int xi, yi;
+  double daPoint[2];
 
   // Let's enforce a minimum age of 0.001 GYR and a maximum age of 10.0 GYR
   A /= YEARSEC;
@@ -1042,16 +1127,10 @@ double fdProximaCenBRadius(double C, double A, double M) {
     C = 0.01;
   }
 
-  // Get the lower bounds
-  xi = fiGetLowerBoundProximaCenB(C, daProxCenBComp, PROXCENBCOMPLEN);
-  yi = fiGetLowerBoundProximaCenB(A, daProxCenBAge, PROXCENBTIMELEN);
-
-  // Normalized distance to grid points
-  dx = (C - daProxCenBComp[xi]) / (daProxCenBComp[xi + 1] - daProxCenBComp[xi]);
-  dy = (A - daProxCenBAge[yi]) / (daProxCenBAge[yi + 1] - daProxCenBAge[yi]);
-
-  // Calculate
-  return fdProximaCenBLinear(xi, yi, dx, dy) * REARTH;
+  daPoint[0] = C;
+  daPoint[1] = A;
+  return fdInterpGrid(&ProxCenBGrid, &daProxCenBRadius[0][0], daPoint) *
+         REARTH;
 }
 
 /**
@@ -1062,129 +1141,23 @@ double fdProximaCenBRadius(double C, double A, double M) {
 */
 double fdLopezRadius(double dMass, double dComp, double dFlux, double dAge,
                      int iMetal) {
-  int m, c, f, t, z;
-  double dm, dc, df, dt;
-  double R000, R001, R010, R011, R100, R101, R110, R111;
-  double R00, R10, R01, R11;
-  double R0, R1;
+  double daPoint[4];
   double dMassEarth = dMass / MEARTH;
   double dAgeYears  = dAge / YEARSEC;
 
-  /* We're not going to bother interpolating between metallicities. */
-  z = iMetal;
-
-  // Add a small tolerance
-  if ((dMassEarth / daLopezMass[0] < 1)) {
-    /* Out of bounds, assuming it's OK to use min val */
-    dMassEarth = daLopezMass[0];
-    m          = 0;
-  } else if ((dMassEarth / daLopezMass[MASSLEN - 1] > 1)) {
-    /* Out of bounds, assuming it's OK to use max val */
-    dMassEarth = daLopezMass[MASSLEN - 1];
-    m          = MASSLEN - 1;
-  } else {
-    /* Get index just below desired mass */
-    for (m = 0; m < MASSLEN - 1; m++) {
-      if (dMassEarth < daLopezMass[m + 1]) {
-        break;
-      }
-    }
-  }
-  if (dComp < daLopezComp[0]) {
-    /* Out of bounds, assuming it's OK to use min val */
-    dComp = daLopezComp[0];
-    c     = 0;
-  } else if (dComp >= daLopezComp[COMPLEN - 1]) {
-    /* Out of bounds, assuming it's OK to use max val */
-    dComp = daLopezComp[COMPLEN - 1];
-    c     = COMPLEN - 1;
-  } else {
-    /* Get index just below desired composition */
-    for (c = 0; c < COMPLEN - 1; c++) {
-      if (dComp < daLopezComp[c + 1]) {
-        break;
-      }
-    }
-  }
-  if (dFlux < daLopezFlux[0]) {
-    /* Out of bounds, assuming it's OK to use min val */
-    dFlux = daLopezFlux[0];
-    f     = 0;
-  } else if (dFlux >= daLopezFlux[FLUXLEN - 1]) {
-    /* Out of bounds, assuming it's OK to use max val */
-    dFlux = daLopezFlux[FLUXLEN - 1];
-    f     = FLUXLEN - 1;
-  } else {
-    /* Get index just below desired composition */
-    for (f = 0; f < FLUXLEN - 1; f++) {
-      if (dFlux < daLopezFlux[f + 1]) {
-        break;
-      }
-    }
-  }
-  if (dAgeYears < daLopezAge[0]) {
-    /* Out of bounds, assuming it's OK to use min val */
-    dAgeYears = daLopezAge[0];
-    t         = 0;
-  } else if (dAgeYears >= daLopezAge[TIMELEN - 1]) {
-    /* Out of bounds, assuming it's OK to use max val */
-    dAgeYears = daLopezAge[TIMELEN - 1];
-    t         = TIMELEN - 1;
-  } else {
-    /* Get index just below desired time */
-    for (t = 0; t < TIMELEN - 1; t++) {
-      if (dAgeYears < daLopezAge[t + 1]) {
-        break;
-      }
-    }
-  }
-  /* We now have the coordinates below our desired point.
-   * Let's use them to do a simple tetralinear interpolation.
-   * Adapted from the method described in
-   * http://en.wikipedia.org/wiki/Trilinear_interpolation */
-  if (m < MASSLEN - 1) {
-    dm   = (dMassEarth - daLopezMass[m]) / (daLopezMass[m + 1] - daLopezMass[m]);
-  } else {
-    dm   = (dMassEarth - daLopezMass[m]) / (daLopezMass[m] - daLopezMass[m-1]);
-  }
-  if (c < COMPLEN - 1) {
-    dc   = (dComp - daLopezComp[c]) / (daLopezComp[c+1] - daLopezComp[c]);
-  } else {
-    dc   = (dComp - daLopezComp[c]) / (daLopezComp[c] - daLopezComp[c-1]);
-  }
-  if (f < FLUXLEN - 1) {
-    df   = (dFlux - daLopezFlux[f]) / (daLopezFlux[f + 1] - daLopezFlux[f]);
-  } else {
-    df   = (dFlux - daLopezFlux[f]) / (daLopezFlux[f] - daLopezFlux[f-1]);
-  }
-  if (t < TIMELEN - 1) {
-    dt   = (dAgeYears - daLopezAge[t]) / (daLopezAge[t + 1] - daLopezAge[t]);
-  } else {
-    dt   = (dAgeYears - daLopezAge[t]) / (daLopezAge[t + 1] - daLopezAge[t]);
-  }
-  R000 = daLopezRadius[m][c][f][z][t] * (1 - dm) +
-         daLopezRadius[m + 1][c][f][z][t] * dm;
-  R001 = daLopezRadius[m][c][f][z][t + 1] * (1 - dm) +
-         daLopezRadius[m + 1][c][f][z][t + 1] * dm;
-  R010 = daLopezRadius[m][c][f + 1][z][t] * (1 - dm) +
-         daLopezRadius[m + 1][c][f + 1][z][t] * dm;
-  R011 = daLopezRadius[m][c][f + 1][z][t + 1] * (1 - dm) +
-         daLopezRadius[m + 1][c][f + 1][z][t + 1] * dm;
-  R100 = daLopezRadius[m][c + 1][f][z][t] * (1 - dm) +
-         daLopezRadius[m + 1][c + 1][f][z][t] * dm;
-  R101 = daLopezRadius[m][c + 1][f][z][t + 1] * (1 - dm) +
-         daLopezRadius[m + 1][c + 1][f][z][t + 1] * dm;
-  R110 = daLopezRadius[m][c + 1][f + 1][z][t] * (1 - dm) +
-         daLopezRadius[m + 1][c + 1][f + 1][z][t] * dm;
-  R111 = daLopezRadius[m][c + 1][f + 1][z][t + 1] * (1 - dm) +
-         daLopezRadius[m + 1][c + 1][f + 1][z][t + 1] * dm;
-  R00 = R000 * (1 - dc) + R100 * dc;
-  R10 = R010 * (1 - dc) + R110 * dc;
-  R01 = R001 * (1 - dc) + R101 * dc;
-  R11 = R011 * (1 - dc) + R111 * dc;
-  R0  = R00 * (1 - df) + R10 * df;
-  R1  = R01 * (1 - df) + R11 * df;
-  return (R0 * (1 - dt) + R1 * dt) * REARTH;
+  /* Out of bounds values are clamped to the edges of the grid, assuming it's
+     OK to use the min or max val. */
+  daPoint[0] = fdGridClamp(dMassEarth, daLopezMass, MASSLEN);
+  daPoint[1] = fdGridClamp(dComp, daLopezComp, COMPLEN);
+  daPoint[2] = fdGridClamp(dFlux, daLopezFlux, FLUXLEN);
+  daPoint[3] = fdGridClamp(dAgeYears, daLopezAge, TIMELEN);
+
+  /* We're not going to bother interpolating between metallicities, so the
+     table is the slice with the requested one. The interpolation is
+     tetralinear, in mass, composition, flux and then age. */
+  return fdInterpGrid(&LopezGrid, &daLopezRadius[0][0][0][iMetal][0],
+                      daPoint) *
+         REARTH;
 }
 
 /**
@@ -1222,24 +1195,20 @@ void fvMatrixVectorMult(const int mat[16][16], const double *vec,
 }
 
 /**
-  Helper function for interpolating Baraffe grid
+  Helper function for interpolating Baraffe grid. The search is fiGridHunt's,
+  starting from the index found by the previous call, piHint.
 
   What are the arguments?
 
 */
-int fiGetLowerBound(double val, const double *arr, int dim) {
+int fiGetLowerBound(double val, const double *arr, int dim, int *piHint) {
   int i;
   if (val < arr[0]) {
     return STELLAR_ERR_OUTOFBOUNDS_LO;
   } else if (val > arr[dim - 1]) {
     return STELLAR_ERR_OUTOFBOUNDS_HI;
-  } else {
-    for (i = 0; i < dim - 2; i++) {
-      if (val < arr[i + 1]) {
-        break;
-      }
-    }
   }
+  i = fiGridHunt(val, arr, dim, piHint);
   // Check to see if i-1, i, i+1 and i+2 are all valid indices
   if (i == 0) {
     return STELLAR_ERR_OUTOFBOUNDS_LO;
@@ -1251,115 +1220,210 @@ int fiGetLowerBound(double val, const double *arr, int dim) {
 }
 
 /**
-  Helper function for interpolating Baraffe grid
+  Helper function for interpolating Baraffe grid. If pdDy is not NULL, it is
+  set to the derivative of the interpolant with respect to dy.
 
   What are the arguments?
 */
-double fdBaraffeBiLinear(int iMLEN, int iALEN,
-                         double const data[STELLAR_BAR_MLEN][STELLAR_BAR_ALEN],
-                         int xi, int yi, double dx, double dy) {
+double fdBaraffeBiLinear(int iMLEN, int iALEN, const double *data, int xi,
+                         int yi, double dx, double dy, double *pdDy) {
   // Linearly interpolate over data, given indices of lower bounds on grid xi,
-  // yi and normalized distances to the interpolation point dx, dy.
+  // yi and normalized distances to the interpolation point dx, dy. The data
+  // are stored by mass, i.e. data[xi * iALEN + yi].
+  const double *d0 = data + xi * iALEN;
+  const double *d1 = d0 + iALEN;
   double C0, C1, C;
   if (dx == 0) {
-    C0 = data[xi][yi];
-    C1 = data[xi][yi + 1];
+    C0 = d0[yi];
+    C1 = d0[yi + 1];
   } else {
-    C0 = data[xi][yi] * (1 - dx) + data[xi + 1][yi] * dx;
-    C1 = data[xi][yi + 1] * (1 - dx) + data[xi + 1][yi + 1] * dx;
+    C0 = d0[yi] * (1 - dx) + d1[yi] * dx;
+    C1 = d0[yi + 1] * (1 - dx) + d1[yi + 1] * dx;
   }
   if (dy == 0) {
     C = C0;
   } else {
     C = C0 * (1 - dy) + C1 * dy;
   }
+  if (pdDy != NULL) {
+    *pdDy = C1 - C0;
+  }
   return C;
 }
 
 /**
-  Helper function for interpolating Baraffe grid
-
-  What are the arguments?
+  Bicubic coefficients of the Baraffe grid cell whose lower corner is
+  (xi, yi), from finite-difference derivatives of the data.
+
+  @param iALEN Number of ages in the grid
+  @param data Grid values, stored by mass
+  @param xi Mass index of the cell
+  @param yi Age index of the cell
+  @param dvCoeff The 16 coefficients of the cell
 */
-double fdBaraffeBiCubic(int iMLEN, int iALEN,
-                        double const data[STELLAR_BAR_MLEN][STELLAR_BAR_ALEN],
-                        int xi, int yi, double dx, double dy) {
-  double dvCoeff[16];
-  int j, k;
-  int ijkn      = 0;
-  double dypow  = 1;
-  double result = 0;
+void fvBaraffeCellCoeff(int iALEN, const double *data, int xi, int yi,
+                        double *dvCoeff) {
+  // Rows of the grid at masses xi-1, xi, xi+1 and xi+2
+  const double *dm = data + (xi - 1) * iALEN;
+  const double *d0 = dm + iALEN;
+  const double *d1 = d0 + iALEN;
+  const double *d2 = d1 + iALEN;
 
   // Linear algebra time!
   // Adapted from http://en.wikipedia.org/wiki/Bicubic_interpolation
   double dvDeriv[16] = {// values of the function at each corner
-                        data[xi][yi], data[xi + 1][yi], data[xi][yi + 1],
-                        data[xi + 1][yi + 1],
+                        d0[yi], d1[yi], d0[yi + 1], d1[yi + 1],
 
                         // values of df/dx at each corner.
-                        0.5 * (data[xi + 1][yi] - data[xi - 1][yi]),
-                        0.5 * (data[xi + 2][yi] - data[xi][yi]),
-                        0.5 * (data[xi + 1][yi + 1] - data[xi - 1][yi + 1]),
-                        0.5 * (data[xi + 2][yi + 1] - data[xi][yi + 1]),
+                        0.5 * (d1[yi] - dm[yi]), 0.5 * (d2[yi] - d0[yi]),
+                        0.5 * (d1[yi + 1] - dm[yi + 1]),
+                        0.5 * (d2[yi + 1] - d0[yi + 1]),
 
                         // values of df/dy at each corner.
-                        0.5 * (data[xi][yi + 1] - data[xi][yi - 1]),
-                        0.5 * (data[xi + 1][yi + 1] - data[xi + 1][yi - 1]),
-                        0.5 * (data[xi][yi + 2] - data[xi][yi]),
-                        0.5 * (data[xi + 1][yi + 2] - data[xi + 1][yi]),
+                        0.5 * (d0[yi + 1] - d0[yi - 1]),
+                        0.5 * (d1[yi + 1] - d1[yi - 1]),
+                        0.5 * (d0[yi + 2] - d0[yi]),
+                        0.5 * (d1[yi + 2] - d1[yi]),
 
                         // values of d2f/dxdy at each corner.
-                        0.25 * (data[xi + 1][yi + 1] - data[xi - 1][yi + 1] -
-                                data[xi + 1][yi - 1] + data[xi - 1][yi - 1]),
-                        0.25 * (data[xi + 2][yi + 1] - data[xi][yi + 1] -
-                                data[xi + 2][yi - 1] + data[xi][yi - 1]),
-                        0.25 * (data[xi + 1][yi + 2] - data[xi - 1][yi + 2] -
-                                data[xi + 1][yi] + data[xi - 1][yi]),
-                        0.25 * (data[xi + 2][yi + 2] - data[xi][yi + 2] -
-                                data[xi + 2][yi] + data[xi][yi])};
+                        0.25 * (d1[yi + 1] - dm[yi + 1] - d1[yi - 1] +
+                                dm[yi - 1]),
+                        0.25 * (d2[yi + 1] - d0[yi + 1] - d2[yi - 1] +
+                                d0[yi - 1]),
+                        0.25 * (d1[yi + 2] - dm[yi + 2] - d1[yi] + dm[yi]),
+                        0.25 * (d2[yi + 2] - d0[yi + 2] - d2[yi] + d0[yi])};
 
   fvMatrixVectorMult(STELLAR_BICUBIC_MATRIX, dvDeriv, dvCoeff);
-  dypow = 1;
+}
+
+/**
+  Bicubic coefficients of a Baraffe grid cell, computed on the cell's first
+  use and cached in daCoeff.
+
+  @param iALEN Number of ages in the grid
+  @param data Grid values, stored by mass
+  @param daCoeff Coefficient cache of the grid quantity
+  @param caCoeffSet Cells whose coefficients are in daCoeff
+  @param xi Mass index of the cell
+  @param yi Age index of the cell
+
+  @return The 16 coefficients of the cell
+*/
+double *fdaBaraffeCellCoeff(int iALEN, const double *data, double *daCoeff,
+                            char *caCoeffSet, int xi, int yi) {
+  int iCell       = xi * iALEN + yi;
+  double *dvCoeff = daCoeff + 16 * iCell;
+
+  if (!caCoeffSet[iCell]) {
+    fvBaraffeCellCoeff(iALEN, data, xi, yi, dvCoeff);
+    caCoeffSet[iCell] = 1;
+  }
+  return dvCoeff;
+}
+
+/**
+  Cubic in dx of row j of a bicubic cell, i.e. the coefficient of dy^j at
+  a fixed mass.
+
+  @param dvCoeff The 16 coefficients of the cell
+  @param j Power of dy
+  @param dx Normalized distance in mass
+
+  @return The coefficient of dy^j
+*/
+double fdBaraffeCellRow(const double *dvCoeff, int j, double dx) {
+  const double *dvRow = dvCoeff + 4 * j;
+  return dvRow[0] + dx * (dvRow[1] + dx * (dvRow[2] + dx * dvRow[3]));
+}
+
+/**
+  Evaluate the cubic in age of one cell at a fixed mass. If pdDy is not
+  NULL, it is set to the derivative of the cubic with respect to dy.
+
+  @param daRow The coefficients of dy^0 ... dy^3
+  @param dy Normalized distance in age
+  @param pdDy Derivative with respect to dy, or NULL
+
+  @return The interpolated value
+*/
+double fdBaraffeCubicInAge(const double *daRow, double dy, double *pdDy) {
+  int j;
+  double dypow    = 1;
+  double dDypowDy = 0;
+  double result   = 0;
+  double dDeriv   = 0;
+
   for (j = 0; j < 4; ++j) {
-    result +=
-          dypow * (dvCoeff[ijkn] +
-                   dx * (dvCoeff[ijkn + 1] +
-                         dx * (dvCoeff[ijkn + 2] + dx * dvCoeff[ijkn + 3])));
-    ijkn += 4;
+    result += dypow * daRow[j];
+    dDeriv += dDypowDy * daRow[j];
+    // d(dy^(j+1))/ddy = dy * d(dy^j)/ddy + dy^j
+    dDypowDy = dDypowDy * dy + dypow;
     dypow *= dy;
   }
+  if (pdDy != NULL) {
+    *pdDy = dDeriv;
+  }
   return result;
 }
 
+/**
+  Helper function for interpolating Baraffe grid. The coefficients of each
+  cell are computed on its first use and cached in daCoeff, so later calls
+  only evaluate the polynomial. If pdDy is not NULL, it is set to the
+  derivative of the polynomial with respect to dy.
+
+  What are the arguments?
+*/
+double fdBaraffeBiCubic(int iMLEN, int iALEN, const double *data,
+                        double *daCoeff, char *caCoeffSet, int xi, int yi,
+                        double dx, double dy, double *pdDy) {
+  double *dvCoeff =
+        fdaBaraffeCellCoeff(iALEN, data, daCoeff, caCoeffSet, xi, yi);
+  double daRow[4];
+  int j;
+
+  for (j = 0; j < 4; ++j) {
+    daRow[j] = fdBaraffeCellRow(dvCoeff, j, dx);
+  }
+  return fdBaraffeCubicInAge(daRow, dy, pdDy);
+}
+
 /**
   Helper function for interpolating Baraffe grid
 
   What are the arguments?
 
 */
-double
-fdBaraffeInterpolate(int iMLEN, int iALEN, double const xarr[STELLAR_BAR_MLEN],
-                     double const yarr[STELLAR_BAR_ALEN],
-                     double const data[STELLAR_BAR_MLEN][STELLAR_BAR_ALEN],
-                     double M, double A, int iOrder, int *iError) {
-  double dx, dy;
+double fdBaraffeInterpolate(int iMLEN, int iALEN, const double *xarr,
+                            const double *yarr, const double *data,
+                            double *daCoeff, char *caCoeffSet,
+                            int *piMassHint, int *piAgeHint, double M,
+                            double A, int iOrder, double *pdDValDA,
+                            int *iError) {
+  double dx, dy, dDy;
+  double *pdDy = (pdDValDA == NULL) ? NULL : &dDy;
   int xi, yi;
   int dxi, dyi;
   double result = 0;
 
+  if (pdDValDA != NULL) {
+    *pdDValDA = 0;
+  }
+
   // Let's enforce a minimum age of 0.001 GYR
   // NOTE: This results in a constant luminosity at times earlier than this,
   // which is not realistic. Shouldn't be an issue for most planet evolution
   // calculations, since planets typically form after this time, but this issue
   // needs to be revisited eventually.
   if (A < 0.001) {
-    A = 0.001;
+    A    = 0.001;
+    pdDy = NULL; // The clamped value does not change with age
   }
 
   // Get bounds on grid
   *iError = 0;
-  xi      = fiGetLowerBound(M, xarr, iMLEN);
-  yi      = fiGetLowerBound(A, yarr, iALEN);
+  xi      = fiGetLowerBound(M, xarr, iMLEN, piMassHint);
+  yi      = fiGetLowerBound(A, yarr, iALEN, piAgeHint);
 
   if (xi < 0) {
     *iError = xi;
@@ -1374,19 +1438,23 @@ fdBaraffeInterpolate(int iMLEN, int iALEN, double const xarr[STELLAR_BAR_MLEN],
   dy = (A - yarr[yi]) / (yarr[yi + 1] - yarr[yi]);
 
   if (iOrder == 1) {
-    result = fdBaraffeBiLinear(iMLEN, iALEN, data, xi, yi, dx, dy);
+    result = fdBaraffeBiLinear(iMLEN, iALEN, data, xi, yi, dx, dy, pdDy);
     if (isnan(result)) {
       *iError = STELLAR_ERR_ISNAN;
       return 0;
     }
+    if (pdDy != NULL) {
+      *pdDValDA = dDy / (yarr[yi + 1] - yarr[yi]);
+    }
     return result;
   } else if (iOrder == 3) {
-    result = fdBaraffeBiCubic(iMLEN, iALEN, data, xi, yi, dx, dy);
+    result = fdBaraffeBiCubic(iMLEN, iALEN, data, daCoeff, caCoeffSet, xi,
+                              yi, dx, dy, pdDy);
     if (isnan(result)) {
       // Maybe we can still linearly interpolate. Let's check:
       if (dx == 0) {
         for (dyi = 0; dyi < 2; dyi++) {
-          if (isnan(data[xi][yi + dyi])) {
+          if (isnan(data[xi * iALEN + yi + dyi])) {
             // Hopeless; you're bounded by
             // a NaN on at least one side
             *iError = STELLAR_ERR_ISNAN;
@@ -1395,7 +1463,7 @@ fdBaraffeInterpolate(int iMLEN, int iALEN, double const xarr[STELLAR_BAR_MLEN],
         }
       } else if (dy == 0) {
         for (dxi = 0; dxi < 2; dxi++) {
-          if (isnan(data[xi + dxi][yi])) {
+          if (isnan(data[(xi + dxi) * iALEN + yi])) {
             // Hopeless; you're bounded by
             // a NaN on at least one side
             *iError = STELLAR_ERR_ISNAN;
@@ -1405,7 +1473,7 @@ fdBaraffeInterpolate(int iMLEN, int iALEN, double const xarr[STELLAR_BAR_MLEN],
       } else {
         for (dxi = 0; dxi < 2; dxi++) {
           for (dyi = 0; dyi < 2; dyi++) {
-            if (isnan(data[xi + dxi][yi + dyi])) {
+            if (isnan(data[(xi + dxi) * iALEN + yi + dyi])) {
               // Hopeless; you're bounded by
               // a NaN on at least one side
               *iError = STELLAR_ERR_ISNAN;
@@ -1416,7 +1484,10 @@ fdBaraffeInterpolate(int iMLEN, int iALEN, double const xarr[STELLAR_BAR_MLEN],
       }
       // We're good! A linear interpolation will save the day.
       *iError = STELLAR_ERR_LINEAR;
-      return fdBaraffeBiLinear(iMLEN, iALEN, data, xi, yi, dx, dy);
+      result  = fdBaraffeBiLinear(iMLEN, iALEN, data, xi, yi, dx, dy, pdDy);
+    }
+    if (pdDy != NULL) {
+      *pdDValDA = dDy / (yarr[yi + 1] - yarr[yi]);
     }
     return result;
   } else {
@@ -1426,38 +1497,524 @@ fdBaraffeInterpolate(int iMLEN, int iALEN, double const xarr[STELLAR_BAR_MLEN],
 }
 
 /**
-  Returns the stellar T, L, or R by interpolating over the Baraffe grid
-  using either a bilinear (iOrder = 1) or a bicubic (iOrder = 3) interpolation.
+  Allocate the empty bicubic coefficient cache of one quantity of a stellar
+  grid, for all metallicity slices.
 
-  What are the arguments?
+  @param grid The stellar grid
+  @param iQuantity Index of the quantity, iParam - STELLAR_T
+*/
+void fvStellarGridCache(STELLARGRID *grid, int iQuantity) {
+  size_t iNumCells = (size_t)grid->iZLen * grid->iMLen * grid->iALen;
+
+  grid->daCoeff[iQuantity]    = malloc(16 * iNumCells * sizeof(double));
+  grid->caCoeffSet[iQuantity] = calloc(iNumCells, sizeof(char));
+  if (grid->daCoeff[iQuantity] == NULL ||
+      grid->caCoeffSet[iQuantity] == NULL) {
+    fprintf(stderr, "ERROR: Unable to allocate the stellar grid cache.\n");
+    exit(EXIT_INPUT);
+  }
+}
+
+/**
+  Lower metallicity slice of a stellar grid for metallicity Z, and the
+  normalized distance from it. Grids without a metallicity axis have one
+  slice. Z is clamped to the grid.
+
+  @param grid The stellar grid
+  @param Z Metallicity [Fe/H]
+  @param pdDz Normalized distance from the lower slice
+
+  @return The lower slice
+*/
+int fiStellarGridSlice(STELLARGRID *grid, double Z, double *pdDz) {
+  const double *zarr = grid->daMet;
+  int iLo, iHi, iMid;
+
+  *pdDz = 0;
+  if (grid->iZLen == 1 || Z <= zarr[0]) {
+    return 0;
+  } else if (Z >= zarr[grid->iZLen - 1]) {
+    *pdDz = 1;
+    return grid->iZLen - 2;
+  }
+  iLo = 0;
+  iHi = grid->iZLen - 1;
+  while (iHi - iLo > 1) {
+    iMid = (iLo + iHi) / 2;
+    if (Z < zarr[iMid]) {
+      iHi = iMid;
+    } else {
+      iLo = iMid;
+    }
+  }
+  *pdDz = (Z - zarr[iLo]) / (zarr[iLo + 1] - zarr[iLo]);
+  return iLo;
+}
+
+/**
+  Interpolate one quantity of a stellar grid in mass and age within a
+  metallicity slice.
+
+  @param grid The stellar grid
+  @param data Grid values of the quantity
+  @param iQuantity Index of the quantity, iParam - STELLAR_T
+  @param iSlice Metallicity slice
+  @param M Stellar mass [MSUN]
+  @param A Stellar age [Gyr]
+  @param iOrder Order of the interpolation
+  @param pdDValDA Derivative with respect to age [1/Gyr], or NULL
+  @param iError Error code, one of the STELLAR_ERR_* values
+
+  @return The interpolated value
+*/
+double fdBaraffeSlice(STELLARGRID *grid, const double *data, int iQuantity,
+                      int iSlice, double M, double A, int iOrder,
+                      double *pdDValDA, int *iError) {
+  size_t iOffset = (size_t)iSlice * grid->iMLen * grid->iALen;
+
+  return fdBaraffeInterpolate(
+        grid->iMLen, grid->iALen, grid->daMass, grid->daAge, data + iOffset,
+        grid->daCoeff[iQuantity] + 16 * iOffset,
+        grid->caCoeffSet[iQuantity] + iOffset, &grid->iMassHint,
+        &grid->iAgeHint, M, A, iOrder, pdDValDA, iError);
+}
+
+/**
+  Interpolate one quantity of a stellar grid in mass, age and metallicity:
+  bicubic or bilinear in mass and age within the two metallicity slices
+  around Z, then linear between them.
+
+  @param grid The stellar grid
+  @param data Grid values of the quantity
+  @param iQuantity Index of the quantity, iParam - STELLAR_T
+  @param M Stellar mass [MSUN]
+  @param Z Metallicity [Fe/H]
+  @param A Stellar age [Gyr]
+  @param iOrder Order of the interpolation
+  @param pdDValDA Derivative with respect to age [1/Gyr], or NULL
+  @param iError Error code, one of the STELLAR_ERR_* values
+
+  @return The interpolated value
+*/
+double fdBaraffeGrid(STELLARGRID *grid, const double *data, int iQuantity,
+                     double M, double Z, double A, int iOrder,
+                     double *pdDValDA, int *iError) {
+  double dDz, dRes, dResHi, dDResHi;
+  double *pdDResHi = (pdDValDA == NULL) ? NULL : &dDResHi;
+  int iSlice, iErrorHi;
+
+  iSlice = fiStellarGridSlice(grid, Z, &dDz);
+  dRes   = fdBaraffeSlice(grid, data, iQuantity, iSlice, M, A, iOrder,
+                          pdDValDA, iError);
+  if (dDz == 0 || *iError < 0) {
+    return dRes;
+  }
+  dResHi = fdBaraffeSlice(grid, data, iQuantity, iSlice + 1, M, A, iOrder,
+                          pdDResHi, &iErrorHi);
+  if (iErrorHi < 0) {
+    *iError = iErrorHi;
+    return 0;
+  } else if (iErrorHi == STELLAR_ERR_LINEAR) {
+    *iError = STELLAR_ERR_LINEAR;
+  }
+  if (pdDValDA != NULL) {
+    *pdDValDA = *pdDValDA * (1 - dDz) + dDResHi * dDz;
+  }
+  return dRes * (1 - dDz) + dResHi * dDz;
+}
+
+/**
+  Find the track of a star of mass M and metallicity Z in a stellar grid.
+
+  @param grid The stellar grid
+  @param M Stellar mass [MSUN]
+  @param Z Metallicity [Fe/H]
+
+  @return The track, or NULL if no track has exactly this mass and
+    metallicity
+*/
+STELLARTRACK *fpStellarTrack(STELLARGRID *grid, double M, double Z) {
+  int iTrack;
+
+  for (iTrack = 0; iTrack < grid->iNumTracks; iTrack++) {
+    if (grid->aTrack[iTrack].dMass == M &&
+        grid->aTrack[iTrack].dMetallicity == Z) {
+      return &grid->aTrack[iTrack];
+    }
+  }
+  return NULL;
+}
+
+/**
+  Add a track to the Baraffe grid for a star whose mass never changes, so
+  its properties are interpolated in age only. Stars outside the grid get no
+  track, and the 2-D interpolation reports the error.
+
+  @param dMass Stellar mass [kg]
+  @param dMetallicity Metallicity [Fe/H]
+*/
+void fvAddStellarTrack(double dMass, double dMetallicity) {
+  STELLARGRID *grid = &BaraffeGrid;
+  STELLARTRACK *track;
+  double M  = dMass / MSUN;
+  int iHint = 0;
+  int xi;
+
+  if (fpStellarTrack(grid, M, dMetallicity) != NULL) {
+    return;
+  }
+  xi = fiGetLowerBound(M, grid->daMass, grid->iMLen, &iHint);
+  if (xi < 0) {
+    return;
+  }
+  grid->aTrack = realloc(grid->aTrack,
+                         (grid->iNumTracks + 1) * sizeof(STELLARTRACK));
+  if (grid->aTrack == NULL) {
+    fprintf(stderr, "ERROR: Unable to allocate a stellar track.\n");
+    exit(EXIT_INPUT);
+  }
+  track = &grid->aTrack[grid->iNumTracks];
+  grid->iNumTracks++;
+  memset(track, 0, sizeof(STELLARTRACK));
+  track->dMass        = M;
+  track->dMetallicity = dMetallicity;
+  track->iMassIndex   = xi;
+  track->dDx =
+        (M - grid->daMass[xi]) / (grid->daMass[xi + 1] - grid->daMass[xi]);
+  track->iMetIndex = fiStellarGridSlice(grid, dMetallicity, &track->dDz);
+}
+
+/**
+  Cubic in age of one cell of a track in one metallicity slice.
+
+  @param grid The stellar grid
+  @param track The track of the star
+  @param data Grid values of the quantity
+  @param iQuantity Index of the quantity, iParam - STELLAR_T
+  @param iSlice Metallicity slice
+  @param yi Age index of the cell
+  @param daRow The coefficients of dy^0 ... dy^3
+*/
+void fvStellarTrackRow(STELLARGRID *grid, STELLARTRACK *track,
+                       const double *data, int iQuantity, int iSlice, int yi,
+                       double *daRow) {
+  size_t iOffset = (size_t)iSlice * grid->iMLen * grid->iALen;
+  double *dvCoeff;
+  int j;
+
+  dvCoeff = fdaBaraffeCellCoeff(grid->iALen, data + iOffset,
+                                grid->daCoeff[iQuantity] + 16 * iOffset,
+                                grid->caCoeffSet[iQuantity] + iOffset,
+                                track->iMassIndex, yi);
+  for (j = 0; j < 4; j++) {
+    daRow[j] = fdBaraffeCellRow(dvCoeff, j, track->dDx);
+  }
+}
+
+/**
+  Interpolate one quantity along a stellar track. The cubic in age of each
+  cell is computed on the cell's first use from the grid's bicubic
+  coefficients, so the result is the same as the 2-D interpolation at the
+  track's mass. Cells that need the bilinear fallback, and ages outside the
+  grid, are passed to fdBaraffeGrid.
+
+  @param grid The stellar grid
+  @param track The track of the star
+  @param data Grid values of the quantity
+  @param iQuantity Index of the quantity, iParam - STELLAR_T
+  @param A Stellar age [Gyr]
+  @param pdDValDA Derivative with respect to age [1/Gyr], or NULL
+  @param iError Error code, one of the STELLAR_ERR_* values
+
+  @return The interpolated value
 */
-double fdBaraffe(int iParam, double A, double M, int iOrder, int *iError) {
-  double res;
+double fdBaraffeTrack(STELLARGRID *grid, STELLARTRACK *track,
+                      const double *data, int iQuantity, double A,
+                      double *pdDValDA, int *iError) {
+  const double *yarr = grid->daAge;
+  double daRowHi[4];
+  double *daRow;
+  double dAge = A;
+  double dy, dDy, result;
+  double *pdDy = (pdDValDA == NULL) ? NULL : &dDy;
+  int yi, j;
+
+  // Same minimum age as fdBaraffeInterpolate
+  if (dAge < 0.001) {
+    dAge = 0.001;
+    pdDy = NULL;
+  }
+  yi = fiGetLowerBound(dAge, yarr, grid->iALen, &track->iAgeHint);
+  if (yi < 0) {
+    return fdBaraffeGrid(grid, data, iQuantity, track->dMass,
+                         track->dMetallicity, A, 3, pdDValDA, iError);
+  }
+
+  daRow = track->daRow[iQuantity] + 4 * yi;
+  if (!track->caRowSet[iQuantity][yi]) {
+    fvStellarTrackRow(grid, track, data, iQuantity, track->iMetIndex, yi,
+                      daRow);
+    if (track->dDz > 0) {
+      fvStellarTrackRow(grid, track, data, iQuantity, track->iMetIndex + 1,
+                        yi, daRowHi);
+      for (j = 0; j < 4; j++) {
+        daRow[j] = daRow[j] * (1 - track->dDz) + daRowHi[j] * track->dDz;
+      }
+    }
+    track->caRowSet[iQuantity][yi] = 1;
+  }
+
+  dy     = (dAge - yarr[yi]) / (yarr[yi + 1] - yarr[yi]);
+  result = fdBaraffeCubicInAge(daRow, dy, pdDy);
+  if (isnan(result)) {
+    return fdBaraffeGrid(grid, data, iQuantity, track->dMass,
+                         track->dMetallicity, A, 3, pdDValDA, iError);
+  }
+
+  *iError = 0;
+  if (pdDValDA != NULL) {
+    *pdDValDA = (pdDy == NULL) ? 0 : dDy / (yarr[yi + 1] - yarr[yi]);
+  }
+  return result;
+}
+
+/**
+  Returns the stellar T, L, R or RG and, if pdDValDt is not NULL, its rate of
+  change with age by interpolating over the Baraffe grid using either a
+  bilinear (iOrder = 1) or a bicubic (iOrder = 3) interpolation. The rate is
+  the derivative of the interpolant itself, so it comes at no extra cost.
+
+  @param iParam Quantity to return: STELLAR_T, STELLAR_L, STELLAR_R or
+    STELLAR_RG
+  @param A Stellar age [s]
+  @param M Stellar mass [kg]
+  @param Z Metallicity [Fe/H], ignored by grids without that axis
+  @param iOrder Order of the interpolation
+  @param pdDValDt Rate of change of the quantity with age [units/s], or NULL
+  @param iError Error code, one of the STELLAR_ERR_* values
+
+  @return The quantity in SI units
+*/
+double fdBaraffeDeriv(int iParam, double A, double M, double Z, int iOrder,
+                      double *pdDValDt, int *iError) {
+  STELLARGRID *grid = &BaraffeGrid;
+  const double *data;
+  double res, dDResDA;
+  double *pdDResDA = (pdDValDt == NULL) ? NULL : &dDResDA;
+  STELLARTRACK *track;
+  int iQuantity;
 
   if (iParam == STELLAR_T) {
-    res = fdBaraffeInterpolate(STELLAR_BAR_MLEN, STELLAR_BAR_ALEN,
-                               STELLAR_BAR_MARR, STELLAR_BAR_AARR, DATA_LOGT,
-                               M / MSUN, A / (1.e9 * YEARSEC), iOrder, iError);
-    return pow(10., res);
+    data = grid->daLogT;
   } else if (iParam == STELLAR_L) {
-    res = fdBaraffeInterpolate(STELLAR_BAR_MLEN, STELLAR_BAR_ALEN,
-                               STELLAR_BAR_MARR, STELLAR_BAR_AARR, DATA_LOGL,
-                               M / MSUN, A / (1.e9 * YEARSEC), iOrder, iError);
-    return LSUN * pow(10., res);
+    data = grid->daLogL;
   } else if (iParam == STELLAR_R) {
-    res = fdBaraffeInterpolate(STELLAR_BAR_MLEN, STELLAR_BAR_ALEN,
-                               STELLAR_BAR_MARR, STELLAR_BAR_AARR, DATA_RADIUS,
-                               M / MSUN, A / (1.e9 * YEARSEC), iOrder, iError);
-    return RSUN * res;
+    data = grid->daRadius;
   } else if (iParam == STELLAR_RG) {
-    res = fdBaraffeInterpolate(STELLAR_BAR_MLEN, STELLAR_BAR_ALEN,
-                               STELLAR_BAR_MARR, STELLAR_BAR_AARR, DATA_RG,
-                               M / MSUN, A / (1.e9 * YEARSEC), iOrder, iError);
-    return res;
+    data = grid->daRG;
   } else {
     *iError = STELLAR_ERR_FILE;
     return 0;
   }
+  iQuantity = iParam - STELLAR_T;
+  if (grid->daCoeff[iQuantity] == NULL) {
+    fvStellarGridCache(grid, iQuantity);
+  }
+
+  M /= MSUN;
+  A /= 1.e9 * YEARSEC;
+  track = fpStellarTrack(grid, M, Z);
+  if (track != NULL && iOrder == 3) {
+    if (track->daRow[iQuantity] == NULL) {
+      track->daRow[iQuantity]    = malloc(4 * grid->iALen * sizeof(double));
+      track->caRowSet[iQuantity] = calloc(grid->iALen, sizeof(char));
+      if (track->daRow[iQuantity] == NULL ||
+          track->caRowSet[iQuantity] == NULL) {
+        fprintf(stderr, "ERROR: Unable to allocate a stellar track.\n");
+        exit(EXIT_INPUT);
+      }
+    }
+    res = fdBaraffeTrack(grid, track, data, iQuantity, A, pdDResDA, iError);
+  } else {
+    res = fdBaraffeGrid(grid, data, iQuantity, M, Z, A, iOrder, pdDResDA,
+                        iError);
+  }
+  if (pdDValDt != NULL) {
+    // Grid ages are in Gyr
+    dDResDA /= 1.e9 * YEARSEC;
+  }
+  if (iParam == STELLAR_T) {
+    res = pow(10., res);
+    if (pdDValDt != NULL) {
+      *pdDValDt = log(10.) * res * dDResDA;
+    }
+    return res;
+  } else if (iParam == STELLAR_L) {
+    res = LSUN * pow(10., res);
+    if (pdDValDt != NULL) {
+      *pdDValDt = log(10.) * res * dDResDA;
+    }
+    return res;
+  } else if (iParam == STELLAR_R) {
+    if (pdDValDt != NULL) {
+      *pdDValDt = RSUN * dDResDA;
+    }
+    return RSUN * res;
+  } else {
+    if (pdDValDt != NULL) {
+      *pdDValDt = dDResDA;
+    }
+    return res;
+  }
+}
+
+/**
+  Returns the stellar T, L, or R by interpolating over the Baraffe grid
+  using either a bilinear (iOrder = 1) or a bicubic (iOrder = 3) interpolation.
+
+  What are the arguments?
+*/
+double fdBaraffe(int iParam, double A, double M, double Z, int iOrder,
+                 int *iError) {
+  return fdBaraffeDeriv(iParam, A, M, Z, iOrder, NULL, iError);
+}
+
+/**
+  Free the tracks of a stellar grid.
+
+  @param grid The stellar grid
+*/
+void fvFreeStellarTracks(STELLARGRID *grid) {
+  int iTrack, iQuantity;
+
+  for (iTrack = 0; iTrack < grid->iNumTracks; iTrack++) {
+    for (iQuantity = 0; iQuantity < 4; iQuantity++) {
+      free(grid->aTrack[iTrack].daRow[iQuantity]);
+      free(grid->aTrack[iTrack].caRowSet[iQuantity]);
+    }
+  }
+  free(grid->aTrack);
+  grid->aTrack     = NULL;
+  grid->iNumTracks = 0;
+}
+
+/**
+  Replace the built-in Baraffe et al. (2015) grid with the grid in cFile.
+  The file starts with the 8 characters "VPLSTGRD", followed by int32
+  values for the format version, the number of masses, the number of ages
+  and the number of metallicities. Version 1 grids have no metallicity axis
+  and a zero there; version 2 grids have at least 2 metallicities. Then come,
+  as doubles, the masses [MSUN], the ages [Gyr], the metallicities [Fe/H] of
+  a version 2 grid, and log10(L/LSUN), R/RSUN, log10(Teff/K) and the radius
+  of gyration. Each of these four blocks is stored by metallicity, then by
+  mass (all ages of the first mass first). All axes must increase. On POSIX
+  systems the file is mapped read-only, so its pages are shared by all
+  processes that use the same grid, however large it is.
+
+@param cFile Name of the grid file
+@param iVerbose Verbosity level
+*/
+void fvLoadStellarGrid(char cFile[], int iVerbose) {
+  STELLARGRID *grid = &BaraffeGrid;
+  FILE *fp;
+  char *cData;
+  int32_t iaHeader[4];
+  long iSize;
+  size_t iNeeded, iBlock;
+  int iM, iA, iZ, iQuantity;
+
+  if (grid->pMap != NULL) {
+    if (strcmp(grid->cFile, cFile)) {
+      fprintf(stderr,
+              "ERROR: Only one stellar grid can be used, but both %s and %s "
+              "were requested.\n",
+              grid->cFile, cFile);
+      exit(EXIT_INPUT);
+    }
+    return;
+  }
+
+  fp = fopen(cFile, "rb");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open stellar grid %s.\n", cFile);
+    exit(EXIT_INPUT);
+  }
+  fseek(fp, 0, SEEK_END);
+  iSize = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+
+#ifdef VPLANET_ON_WINDOWS
+  cData = malloc(iSize);
+  if (cData == NULL || fread(cData, 1, iSize, fp) != (size_t)iSize) {
+    fprintf(stderr, "ERROR: Unable to read stellar grid %s.\n", cFile);
+    exit(EXIT_INPUT);
+  }
+#else
+  cData = mmap(NULL, iSize, PROT_READ, MAP_SHARED, fileno(fp), 0);
+  if (cData == MAP_FAILED) {
+    fprintf(stderr, "ERROR: Unable to map stellar grid %s.\n", cFile);
+    exit(EXIT_INPUT);
+  }
+#endif
+  fclose(fp);
+
+  if (iSize < STELLARGRID_HEADER ||
+      memcmp(cData, STELLARGRID_MAGIC, strlen(STELLARGRID_MAGIC))) {
+    fprintf(stderr, "ERROR: %s is not a VPLanet stellar grid.\n", cFile);
+    exit(EXIT_INPUT);
+  }
+  memcpy(iaHeader, cData + 8, sizeof(iaHeader));
+  iM = iaHeader[1];
+  iA = iaHeader[2];
+  iZ = iaHeader[3];
+  if ((iaHeader[0] == 1 && iZ == 0) || (iaHeader[0] == 2 && iZ >= 2)) {
+    iBlock  = (size_t)(iZ > 0 ? iZ : 1) * iM * iA;
+    iNeeded = STELLARGRID_HEADER + (iM + iA + iZ + 4 * iBlock) * sizeof(double);
+  } else {
+    iNeeded = 0;
+  }
+  if (iNeeded == 0 || iM < 4 || iA < 4 || (size_t)iSize != iNeeded) {
+    fprintf(stderr,
+            "ERROR: Stellar grid %s is inconsistent: version %d, %d masses, "
+            "%d ages, %d metallicities, %ld bytes.\n",
+            cFile, iaHeader[0], iM, iA, iZ, iSize);
+    exit(EXIT_INPUT);
+  }
+
+  grid->iMLen    = iM;
+  grid->iALen    = iA;
+  grid->iZLen    = (iZ > 0) ? iZ : 1;
+  grid->daMass   = (const double *)(cData + STELLARGRID_HEADER);
+  grid->daAge    = grid->daMass + iM;
+  grid->daMet    = (iZ > 0) ? grid->daAge + iA : NULL;
+  grid->daLogL   = grid->daAge + iA + iZ;
+  grid->daRadius = grid->daLogL + iBlock;
+  grid->daLogT   = grid->daRadius + iBlock;
+  grid->daRG     = grid->daLogT + iBlock;
+  grid->pMap     = cData;
+  grid->iMapSize = iSize;
+  strncpy(grid->cFile, cFile, OPTLEN - 1);
+  for (iQuantity = 0; iQuantity < 4; iQuantity++) {
+    // Drop any coefficients cached from the built-in grid
+    free(grid->daCoeff[iQuantity]);
+    free(grid->caCoeffSet[iQuantity]);
+    grid->daCoeff[iQuantity]    = NULL;
+    grid->caCoeffSet[iQuantity] = NULL;
+  }
+  // Tracks refer to cells of the built-in grid; stars add theirs later
+  fvFreeStellarTracks(grid);
+
+  if (iVerbose >= VERBINPUT) {
+    printf("INFO: Stellar grid %s: %d masses from %g to %g MSUN, %d ages "
+           "from %g to %g Gyr",
+           cFile, iM, grid->daMass[0], grid->daMass[iM - 1], iA,
+           grid->daAge[0], grid->daAge[iA - 1]);
+    if (iZ > 0) {
+      printf(", %d metallicities from %g to %g", iZ, grid->daMet[0],
+             grid->daMet[iZ - 1]);
+    }
+    printf(".\n");
+  }
 }
 
 /** Compute habitable zone limits from Kopparapu et al. (2013). Works with
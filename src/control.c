@@ -157,19 +157,24 @@ void InitializeControlEvolve(BODY *body, CONTROL *control, MODULE *module,
   int iBody, iModule, iSubStep;
 
   control->Evolve.fnBodyCopy =
-        malloc(control->Evolve.iNumBodies * sizeof(fnBodyCopyModule *));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(fnBodyCopyModule *));
   control->Evolve.iNumModules =
-        malloc(control->Evolve.iNumBodies * sizeof(int));
-  control->iNumMultiProps = malloc(control->Evolve.iNumBodies * sizeof(int));
+        ArenaAlloc(&control->Arena, control->Evolve.iNumBodies * sizeof(int));
+  control->iNumMultiProps =
+        ArenaAlloc(&control->Arena, control->Evolve.iNumBodies * sizeof(int));
   control->Evolve.tmpUpdate =
-        malloc(control->Evolve.iNumBodies * sizeof(UPDATE));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(UPDATE));
 
-  control->Evolve.tmpBody = malloc(control->Evolve.iNumBodies * sizeof(BODY));
+  control->Evolve.tmpBody =
+        ArenaAlloc(&control->Arena, control->Evolve.iNumBodies * sizeof(BODY));
   InitializeBodyModules(&control->Evolve.tmpBody, control->Evolve.iNumBodies);
 
   for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
     control->Evolve.fnBodyCopy[iBody] =
-          malloc(module->iNumModules[iBody] * sizeof(fnBodyCopyModule));
+          ArenaAlloc(&control->Arena,
+                     module->iNumModules[iBody] * sizeof(fnBodyCopyModule));
 
     for (iModule = 0; iModule < module->iNumModules[iBody]; iModule++) {
       control->Evolve.fnBodyCopy[iBody][iModule] = &BodyCopyNULL;
@@ -179,13 +184,17 @@ void InitializeControlEvolve(BODY *body, CONTROL *control, MODULE *module,
   /* Currently this only matters for RK4 integration. This should
      be generalized for any integration method. */
   if (control->Evolve.iOneStep == RUNGEKUTTA) {
-    control->Evolve.daDeriv = malloc(4 * sizeof(double **));
-    control->Evolve.daDerivProc = malloc(4 * sizeof(double ***));
+    control->Evolve.daDeriv =
+          ArenaAlloc(&control->Arena, 4 * sizeof(double **));
+    control->Evolve.daDerivProc =
+          ArenaAlloc(&control->Arena, 4 * sizeof(double ***));
     for (iSubStep = 0; iSubStep < 4; iSubStep++) {
       control->Evolve.daDeriv[iSubStep] =
-            malloc(control->Evolve.iNumBodies * sizeof(double *));
+            ArenaAlloc(&control->Arena,
+                       control->Evolve.iNumBodies * sizeof(double *));
       control->Evolve.daDerivProc[iSubStep] =
-            malloc(control->Evolve.iNumBodies * sizeof(double **));
+            ArenaAlloc(&control->Arena,
+                       control->Evolve.iNumBodies * sizeof(double **));
     }
   }
 
@@ -698,6 +707,12 @@ void Help(OPTIONS *options, OUTPUT *output, char exe[], int bLong) {
          "device.\n");
   printf("-h, -help              -- Display short help.\n");
   printf("-H, -Help              -- Display extended help.\n");
+  printf("-sweep <file>          -- Run every member of the parameter sweep "
+         "in a VSPACE file.\n");
+  printf("-server <fifo>         -- Run the input files named on each line "
+         "of a FIFO.\n");
+  printf("-c, -cores <num>       -- Number of worker processes for -sweep "
+         "and -server.\n");
   printf("====================   "
          "============================================================\n\n");
 
@@ -44,13 +44,14 @@ void InitializeBodyDistOrb(BODY *body, CONTROL *control, UPDATE *update,
     }
   }
 
-  body[iBody].iaGravPerts = malloc(body[iBody].iGravPerts * sizeof(int));
+  body[iBody].iaGravPerts =
+        ArenaAlloc(&control->Arena, body[iBody].iGravPerts * sizeof(int));
 }
 
 void InitializeUpdateTmpBodyDistOrb(BODY *body, CONTROL *control,
                                     UPDATE *update, int iBody) {
   control->Evolve.tmpBody[iBody].iaGravPerts =
-        malloc(body[iBody].iGravPerts * sizeof(int));
+        ArenaAlloc(&control->Arena, body[iBody].iGravPerts * sizeof(int));
 }
 
 /**************** DISTORB options ********************/
@@ -47,15 +47,15 @@ void InitializeUpdateTmpBodyDistRot(BODY *body, CONTROL *control,
     int iLine;
 
     control->Evolve.tmpBody[iBody].daSemiSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
+          ArenaAlloc(&control->Arena, body[iBody].iNLines * sizeof(double));
     control->Evolve.tmpBody[iBody].daHeccSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
+          ArenaAlloc(&control->Arena, body[iBody].iNLines * sizeof(double));
     control->Evolve.tmpBody[iBody].daKeccSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
+          ArenaAlloc(&control->Arena, body[iBody].iNLines * sizeof(double));
     control->Evolve.tmpBody[iBody].daPincSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
+          ArenaAlloc(&control->Arena, body[iBody].iNLines * sizeof(double));
     control->Evolve.tmpBody[iBody].daQincSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
+          ArenaAlloc(&control->Arena, body[iBody].iNLines * sizeof(double));
 
     for (iLine = 0; iLine < body[iBody].iNLines; iLine++) {
       control->Evolve.tmpBody[iBody].daSemiSeries[iLine] =
@@ -0,0 +1,884 @@
+/**
+  @file ensemble.c
+
+  @brief Several simulations integrated in lockstep by one process. Members
+  whose UPDATETABLEs have the same layout take their Runge-Kutta steps
+  together: the primary variables and derivatives of all members are stored
+  next to each other, so the substeps are loops over contiguous memory, and
+  the most common derivatives are evaluated for all members at once by the
+  batched kernels of their modules. Each member keeps its own timestep, so
+  the members stay bit for bit identical to separate runs. Members that
+  cannot be integrated in lockstep are integrated one after the other.
+
+  @date Oct 18 2026
+
+*/
+
+#include "vplanet.h"
+
+#ifndef VPLANET_ON_WINDOWS
+#include <fcntl.h>
+#endif
+
+/*!
+Return the batched kernel that replaces the derivative fnEqn, or NULL if
+there is none.
+*/
+fnEnsembleEquation fnEnsembleKernel(fnUpdateVariable fnEqn) {
+  if (fnEqn == &fdCPLDsemiDt) {
+    return &fvCPLDsemiDtEnsemble;
+  } else if (fnEqn == &fdCTLDsemiDt) {
+    return &fvCTLDsemiDtEnsemble;
+  } else if (fnEqn == &fdDRotRateDt) {
+    return &fvDRotRateDtEnsemble;
+  } else if (fnEqn == &fdTDotMan) {
+    return &fvTDotManEnsemble;
+  } else if (fnEqn == &fdTDotCore) {
+    return &fvTDotCoreEnsemble;
+  } else if (fnEqn == &fdD26AlNumManDt) {
+    return &fvD26AlNumManDtEnsemble;
+  } else if (fnEqn == &fdD40KNumManDt) {
+    return &fvD40KNumManDtEnsemble;
+  } else if (fnEqn == &fdD232ThNumManDt) {
+    return &fvD232ThNumManDtEnsemble;
+  } else if (fnEqn == &fdD238UNumManDt) {
+    return &fvD238UNumManDtEnsemble;
+  } else if (fnEqn == &fdD235UNumManDt) {
+    return &fvD235UNumManDtEnsemble;
+  } else if (fnEqn == &fdD26AlNumCoreDt) {
+    return &fvD26AlNumCoreDtEnsemble;
+  } else if (fnEqn == &fdD40KNumCoreDt) {
+    return &fvD40KNumCoreDtEnsemble;
+  } else if (fnEqn == &fdD232ThNumCoreDt) {
+    return &fvD232ThNumCoreDtEnsemble;
+  } else if (fnEqn == &fdD238UNumCoreDt) {
+    return &fvD238UNumCoreDtEnsemble;
+  } else if (fnEqn == &fdD235UNumCoreDt) {
+    return &fvD235UNumCoreDtEnsemble;
+  } else if (fnEqn == &fdD40KNumCrustDt) {
+    return &fvD40KNumCrustDtEnsemble;
+  } else if (fnEqn == &fdD232ThNumCrustDt) {
+    return &fvD232ThNumCrustDtEnsemble;
+  } else if (fnEqn == &fdD238UNumCrustDt) {
+    return &fvD238UNumCrustDtEnsemble;
+  } else if (fnEqn == &fdD235UNumCrustDt) {
+    return &fvD235UNumCrustDtEnsemble;
+  }
+  return NULL;
+}
+
+/* Output files are written relative to the working directory, so switch to
+   the member's directory before anything that may write one. */
+void EnsembleEnterMember(ENSEMBLE *ensemble, int iMember) {
+  if (ensemble->iCurrentMember == iMember) {
+    return;
+  }
+#ifndef VPLANET_ON_WINDOWS
+  if (fchdir(ensemble->iaDirFd[iMember]) != 0) {
+    fprintf(stderr, "ERROR: Unable to enter the directory of member %d.\n",
+            iMember);
+    exit(EXIT_WRITE);
+  }
+#endif
+  ensemble->iCurrentMember = iMember;
+}
+
+/*!
+Can the member be integrated in lockstep at all? It must be evolved with
+the Runge-Kutta integrator, and its modules must not write files of their
+own during the integration.
+*/
+int fbEnsembleLockstep(ENSEMBLE *ensemble, int iMember) {
+  CONTROL *control = &ensemble->Control[iMember];
+  BODY *body       = ensemble->pBody[iMember];
+  int iBody;
+
+  if (!(control->Evolve.bDoForward || control->Evolve.bDoBackward) ||
+      control->Evolve.iOneStep != RUNGEKUTTA) {
+    return 0;
+  }
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    if (body[iBody].bPoise || body[iBody].bDistOrb || body[iBody].bGalHabit) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/*!
+Does the member have the same bodies, auxiliary properties and UPDATETABLE
+layout as the reference member?
+*/
+int fbEnsembleMatches(ENSEMBLE *ensemble, int iMember, int iReference) {
+  CONTROL *control   = &ensemble->Control[iMember];
+  CONTROL *reference = &ensemble->Control[iReference];
+  UPDATETABLE *table = &control->UpdateTable;
+  UPDATETABLE *refTable = &reference->UpdateTable;
+  UPDATE *update        = ensemble->pUpdate[iReference];
+  int iBody, iModule, iRow, iEqn, iVar, iNumBodies;
+
+  if (control->Evolve.iNumBodies != reference->Evolve.iNumBodies ||
+      table->iNumRows != refTable->iNumRows ||
+      table->iNumEqns != refTable->iNumEqns) {
+    return 0;
+  }
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    if (control->Evolve.iNumModules[iBody] !=
+              reference->Evolve.iNumModules[iBody] ||
+        control->iNumMultiProps[iBody] != reference->iNumMultiProps[iBody]) {
+      return 0;
+    }
+    for (iModule = 0; iModule < control->Evolve.iNumModules[iBody];
+         iModule++) {
+      if (control->fnPropsAux[iBody][iModule] !=
+          reference->fnPropsAux[iBody][iModule]) {
+        return 0;
+      }
+    }
+    for (iModule = 0; iModule < control->iNumMultiProps[iBody]; iModule++) {
+      if (control->fnPropsAuxMulti[iBody][iModule] !=
+          reference->fnPropsAuxMulti[iBody][iModule]) {
+        return 0;
+      }
+    }
+  }
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    if (table->iaRowStart[iRow] != refTable->iaRowStart[iRow] ||
+        table->iaRowBody[iRow] != refTable->iaRowBody[iRow] ||
+        table->iaRowVar[iRow] != refTable->iaRowVar[iRow]) {
+      return 0;
+    }
+    iBody = refTable->iaRowBody[iRow];
+    iVar  = refTable->iaRowVar[iRow];
+    for (iEqn = refTable->iaRowStart[iRow];
+         iEqn < refTable->iaRowStart[iRow + 1]; iEqn++) {
+      iNumBodies =
+            update[iBody].iNumBodies[iVar][iEqn - refTable->iaRowStart[iRow]];
+      if (table->iaType[iEqn] != refTable->iaType[iEqn] ||
+          memcmp(table->iaBody[iEqn], refTable->iaBody[iEqn],
+                 iNumBodies * sizeof(int))) {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/*!
+Choose the members that are integrated in lockstep and allocate the arrays
+that hold their variables side by side.
+*/
+void InitializeEnsemble(ENSEMBLE *ensemble) {
+  int iMember, iSubStep, iRow, iEqn, iNumMembers = ensemble->iNumMembers;
+  UPDATETABLE *table;
+
+  ensemble->iReference = -1;
+  ensemble->bLockstep  = calloc(iNumMembers, sizeof(int));
+  ensemble->bActive    = calloc(iNumMembers, sizeof(int));
+  ensemble->iaActive   = calloc(iNumMembers, sizeof(int));
+  ensemble->iNumActive = 0;
+  for (iMember = 0; iMember < iNumMembers; iMember++) {
+    if (!fbEnsembleLockstep(ensemble, iMember)) {
+      continue;
+    }
+    if (ensemble->iReference == -1) {
+      ensemble->iReference = iMember;
+    }
+    ensemble->bLockstep[iMember] =
+          fbEnsembleMatches(ensemble, iMember, ensemble->iReference);
+  }
+  if (ensemble->iReference == -1) {
+    return;
+  }
+
+  table              = &ensemble->Control[ensemble->iReference].UpdateTable;
+  ensemble->iNumRows = table->iNumRows;
+  ensemble->iNumEqns = table->iNumEqns;
+
+  ensemble->daDir = calloc(iNumMembers, sizeof(double));
+  ensemble->daDt  = calloc(iNumMembers, sizeof(double));
+  ensemble->daVar = calloc(ensemble->iNumRows * iNumMembers, sizeof(double));
+  ensemble->daTmpVar =
+        calloc(ensemble->iNumRows * iNumMembers, sizeof(double));
+  ensemble->daRowDeriv =
+        calloc(ensemble->iNumRows * iNumMembers, sizeof(double));
+  ensemble->daEqnDeriv =
+        calloc(ensemble->iNumEqns * iNumMembers, sizeof(double));
+  for (iSubStep = 0; iSubStep < 4; iSubStep++) {
+    ensemble->daStepDeriv[iSubStep] =
+          calloc(ensemble->iNumRows * iNumMembers, sizeof(double));
+    ensemble->daStepEqnDeriv[iSubStep] =
+          calloc(ensemble->iNumEqns * iNumMembers, sizeof(double));
+  }
+
+  /* The members' tables are released when they finish, so the ensemble
+     keeps its own copy of the layout */
+  ensemble->iaRowStart = malloc((ensemble->iNumRows + 1) * sizeof(int));
+  ensemble->iaRowType  = malloc(ensemble->iNumRows * sizeof(int));
+  for (iRow = 0; iRow < ensemble->iNumRows; iRow++) {
+    ensemble->iaRowStart[iRow] = table->iaRowStart[iRow];
+    ensemble->iaRowType[iRow]  = table->iaType[table->iaRowStart[iRow]];
+  }
+  ensemble->iaRowStart[ensemble->iNumRows] = ensemble->iNumEqns;
+
+  ensemble->fnEqn    = malloc(ensemble->iNumEqns * sizeof(fnUpdateVariable));
+  ensemble->fnKernel = malloc(ensemble->iNumEqns * sizeof(fnEnsembleEquation));
+  for (iEqn = 0; iEqn < ensemble->iNumEqns; iEqn++) {
+    ensemble->fnEqn[iEqn]    = table->fnEqn[iEqn];
+    ensemble->fnKernel[iEqn] = fnEnsembleKernel(table->fnEqn[iEqn]);
+  }
+
+  ensemble->pLaneBody   = malloc(iNumMembers * sizeof(BODY *));
+  ensemble->pLaneSystem = malloc(iNumMembers * sizeof(SYSTEM *));
+  ensemble->iaLane      = malloc(iNumMembers * sizeof(int));
+  ensemble->daLane      = malloc(iNumMembers * sizeof(double));
+  ensemble->daWork      = malloc(ENSEMBLEWORK * iNumMembers * sizeof(double));
+}
+
+/* Rebuild the list of members that are still integrated */
+void EnsembleActiveMembers(ENSEMBLE *ensemble) {
+  int iMember;
+
+  ensemble->iNumActive = 0;
+  for (iMember = 0; iMember < ensemble->iNumMembers; iMember++) {
+    if (ensemble->bActive[iMember]) {
+      ensemble->iaActive[ensemble->iNumActive++] = iMember;
+    }
+  }
+}
+
+/*!
+PropertiesAuxiliary for every active member, either of the BODY arrays
+(bTmp = 0) or of the temporary BODY arrays of the Runge-Kutta substeps
+(bTmp = 1). The auxiliary functions are called in the same order as in
+PropertiesAuxiliary, each one for all members before the next, so that the
+CTL de/dt of all members can be computed by one batched kernel at the point
+where PropsAuxCTL would compute it.
+*/
+void EnsembleAuxiliary(ENSEMBLE *ensemble, int bTmp) {
+  CONTROL *reference;
+  UPDATE *update;
+  CONTROL *control;
+  BODY *body;
+  int iActive, iMember, iBody, iModule, bBatch;
+  int *iaBody;
+
+  if (ensemble->iNumActive == 0) {
+    return;
+  }
+  // All members call the same functions
+  reference = &ensemble->Control[ensemble->iaActive[0]];
+  update    = ensemble->pUpdate[ensemble->iaActive[0]];
+
+  for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+    iMember = ensemble->iaActive[iActive];
+    control = &ensemble->Control[iMember];
+    body = bTmp ? control->Evolve.tmpBody : ensemble->pBody[iMember];
+    PropsAuxGeneral(body, control);
+    ensemble->pLaneBody[iActive]   = body;
+    ensemble->pLaneSystem[iActive] = &ensemble->System[iMember];
+  }
+
+  for (iBody = 0; iBody < reference->Evolve.iNumBodies; iBody++) {
+    for (iModule = 0; iModule < reference->Evolve.iNumModules[iBody];
+         iModule++) {
+      bBatch = (reference->fnPropsAux[iBody][iModule] == &PropsAuxCTL &&
+                iBody > 0);
+      for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+        iMember                      = ensemble->iaActive[iActive];
+        control                      = &ensemble->Control[iMember];
+        control->Evolve.bBatchDeccDt = bBatch;
+        control->fnPropsAux[iBody][iModule](
+              ensemble->pLaneBody[iActive], &control->Evolve, &control->Io,
+              ensemble->pUpdate[iMember], iBody);
+        control->Evolve.bBatchDeccDt = 0;
+      }
+      if (bBatch) {
+        iaBody = update[iBody].iaBody[update[iBody].iHecc]
+                                     [update[iBody].iHeccEqtide];
+        fvCTLDeccDtEnsemble(ensemble->pLaneBody, ensemble->pLaneSystem, iaBody,
+                            ensemble->iNumActive, ensemble->daLane,
+                            ensemble->daWork);
+        for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+          ensemble->pLaneBody[iActive][iBody].dDeccDtEqtide =
+                ensemble->daLane[iActive];
+        }
+      }
+    }
+
+    for (iModule = 0; iModule < reference->iNumMultiProps[iBody]; iModule++) {
+      for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+        iMember = ensemble->iaActive[iActive];
+        control = &ensemble->Control[iMember];
+        control->fnPropsAuxMulti[iBody][iModule](
+              ensemble->pLaneBody[iActive], &control->Evolve, &control->Io,
+              ensemble->pUpdate[iMember], iBody);
+      }
+    }
+  }
+}
+
+/*!
+fdGetUpdateInfo for every active member, of either the UPDATETABLEs
+(bTmp = 0) or the temporary UPDATETABLEs (bTmp = 1). The equations are
+evaluated in table order, each one for all members before the next. An
+equation with a batched kernel is evaluated by the kernel for all members
+that still use it; ForceBehavior may have replaced it in some members.
+*/
+void EnsembleEquations(ENSEMBLE *ensemble, int bTmp) {
+  int iEqn, iActive, iMember, iLane, iNumLanes;
+  int iNumMembers = ensemble->iNumMembers;
+  UPDATETABLE *table;
+  BODY *body;
+  SYSTEM *system;
+  int *iaBody = NULL;
+
+  for (iEqn = 0; iEqn < ensemble->iNumEqns; iEqn++) {
+    iNumLanes = 0;
+    for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+      iMember = ensemble->iaActive[iActive];
+      if (bTmp) {
+        table = &ensemble->Control[iMember].TmpUpdateTable;
+        body  = ensemble->Control[iMember].Evolve.tmpBody;
+      } else {
+        table = &ensemble->Control[iMember].UpdateTable;
+        body  = ensemble->pBody[iMember];
+      }
+      system = &ensemble->System[iMember];
+      if (ensemble->fnKernel[iEqn] != NULL &&
+          table->fnEqn[iEqn] == ensemble->fnEqn[iEqn]) {
+        ensemble->pLaneBody[iNumLanes]   = body;
+        ensemble->pLaneSystem[iNumLanes] = system;
+        ensemble->iaLane[iNumLanes]      = iMember;
+        iaBody                           = table->iaBody[iEqn];
+        iNumLanes++;
+      } else {
+        table->daDerivProc[iEqn] =
+              table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+        ensemble->daEqnDeriv[iEqn * iNumMembers + iMember] =
+              table->daDerivProc[iEqn];
+      }
+    }
+    if (iNumLanes == 0) {
+      continue;
+    }
+
+    ensemble->fnKernel[iEqn](ensemble->pLaneBody, ensemble->pLaneSystem,
+                             iaBody, iNumLanes, ensemble->daLane,
+                             ensemble->daWork);
+    for (iLane = 0; iLane < iNumLanes; iLane++) {
+      iMember = ensemble->iaLane[iLane];
+      if (bTmp) {
+        table = &ensemble->Control[iMember].TmpUpdateTable;
+      } else {
+        table = &ensemble->Control[iMember].UpdateTable;
+      }
+      table->daDerivProc[iEqn] = ensemble->daLane[iLane];
+      ensemble->daEqnDeriv[iEqn * iNumMembers + iMember] =
+            ensemble->daLane[iLane];
+    }
+  }
+}
+
+/*!
+The part of RungeKutta4Step that only depends on the member itself: the
+derivatives at the start of the step and the member's timestep, which are
+then copied into the ensemble's arrays.
+*/
+void EnsembleBeginStep(ENSEMBLE *ensemble, int iMember) {
+  BODY *body         = ensemble->pBody[iMember];
+  CONTROL *control   = &ensemble->Control[iMember];
+  EVOLVE *evolve     = &control->Evolve;
+  UPDATETABLE *table = &control->UpdateTable;
+  double *daTmpDerivProc = control->TmpUpdateTable.daDerivProc;
+  int iNumMembers        = ensemble->iNumMembers;
+  int iRow, iEqn;
+  double dDt;
+
+  BodyCopy(evolve->tmpBody, body, evolve);
+
+  /* Derivatives at start */
+  dDt = fdGetTimeStep(body, control, &ensemble->System[iMember],
+                      evolve->tmpUpdate, ensemble->pfnUpdate[iMember]);
+
+  /* Adjust dt? */
+  if (evolve->bVarDt) {
+    dDt = AssignDt(dDt, (control->Io.dNextOutput - evolve->dTime),
+                   evolve->dEta);
+    if (evolve->iLimitRow >= 0) {
+      table->iaLimitCount[evolve->iLimitRow]++;
+    }
+  } else {
+    dDt = evolve->dTimeStep;
+  }
+  evolve->dCurrentDt       = dDt;
+  ensemble->daDt[iMember]  = dDt;
+  ensemble->daDir[iMember] = evolve->bDoForward ? 1 : -1;
+
+  for (iRow = 0; iRow < ensemble->iNumRows; iRow++) {
+    ensemble->daVar[iRow * iNumMembers + iMember] = *(table->pdVar[iRow]);
+  }
+  for (iEqn = 0; iEqn < ensemble->iNumEqns; iEqn++) {
+    ensemble->daEqnDeriv[iEqn * iNumMembers + iMember] = daTmpDerivProc[iEqn];
+  }
+}
+
+/*!
+RungeKutta4Substep for all members: sum the derivatives of each row into
+the substep's arrays. Finished members have a zero direction and their
+results are never used.
+*/
+void EnsembleSubstep(ENSEMBLE *ensemble, int iSubStep, int bSkipExplicit) {
+  int *iaRowStart      = ensemble->iaRowStart;
+  int iNumMembers      = ensemble->iNumMembers;
+  double *daDir        = ensemble->daDir;
+  double *daDeriv      = ensemble->daStepDeriv[iSubStep];
+  double *daDerivProc  = ensemble->daStepEqnDeriv[iSubStep];
+  double *daEqnDeriv   = ensemble->daEqnDeriv;
+  int iRow, iEqn, iType, iMember, iRowOff, iEqnOff;
+
+  for (iRow = 0; iRow < ensemble->iNumRows; iRow++) {
+    iType = ensemble->iaRowType[iRow];
+    if (bSkipExplicit && (iType == 0 || iType == 3 || iType == 10)) {
+      continue;
+    }
+    iRowOff = iRow * iNumMembers;
+    for (iMember = 0; iMember < iNumMembers; iMember++) {
+      daDeriv[iRowOff + iMember] = 0;
+    }
+    for (iEqn = iaRowStart[iRow]; iEqn < iaRowStart[iRow + 1]; iEqn++) {
+      iEqnOff = iEqn * iNumMembers;
+      for (iMember = 0; iMember < iNumMembers; iMember++) {
+        daDeriv[iRowOff + iMember] +=
+              daDir[iMember] * daEqnDeriv[iEqnOff + iMember];
+        daDerivProc[iEqnOff + iMember] = daEqnDeriv[iEqnOff + iMember];
+      }
+    }
+  }
+}
+
+/*!
+RungeKutta4Advance for all members: move the temporary primary variables to
+the point dFrac * dt along each member's step, then copy them into the
+active members' temporary UPDATETABLEs.
+*/
+void EnsembleAdvance(ENSEMBLE *ensemble, int iSubStep, double dFrac) {
+  UPDATETABLE *table;
+  int iNumMembers = ensemble->iNumMembers;
+  double *daDt    = ensemble->daDt;
+  double *daVar   = ensemble->daVar;
+  double *daTmpVar = ensemble->daTmpVar;
+  double *daDeriv  = ensemble->daStepDeriv[iSubStep];
+  int iRow, iType, iMember, iActive, iRowOff;
+
+  for (iRow = 0; iRow < ensemble->iNumRows; iRow++) {
+    iType   = ensemble->iaRowType[iRow];
+    iRowOff = iRow * iNumMembers;
+    if (iType == 0 || iType == 3 || iType == 10) {
+      // The VALUE of the variable, see RungeKutta4Advance
+      for (iMember = 0; iMember < iNumMembers; iMember++) {
+        daTmpVar[iRowOff + iMember] = daDeriv[iRowOff + iMember];
+      }
+    } else {
+      for (iMember = 0; iMember < iNumMembers; iMember++) {
+        daTmpVar[iRowOff + iMember] =
+              daVar[iRowOff + iMember] +
+              dFrac * daDt[iMember] * daDeriv[iRowOff + iMember];
+      }
+    }
+  }
+
+  for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+    iMember = ensemble->iaActive[iActive];
+    table   = &ensemble->Control[iMember].TmpUpdateTable;
+    for (iRow = 0; iRow < ensemble->iNumRows; iRow++) {
+      *(table->pdVar[iRow]) = daTmpVar[iRow * iNumMembers + iMember];
+    }
+  }
+}
+
+/*!
+One RungeKutta4Step of every active member.
+*/
+void EnsembleRungeKutta4Step(ENSEMBLE *ensemble) {
+  UPDATETABLE *table;
+  int *iaRowStart = ensemble->iaRowStart;
+  int iNumMembers = ensemble->iNumMembers;
+  double *daDt    = ensemble->daDt;
+  double *daVar   = ensemble->daVar;
+  double *daRowDeriv = ensemble->daRowDeriv;
+  double *daEqnDeriv = ensemble->daEqnDeriv;
+  double **daStep    = ensemble->daStepDeriv;
+  double **daStepEqn = ensemble->daStepEqnDeriv;
+  int iRow, iEqn, iType, iMember, iActive, iOff;
+
+  // Members that are not integrated keep a zero step
+  for (iMember = 0; iMember < iNumMembers; iMember++) {
+    daDt[iMember]            = 0;
+    ensemble->daDir[iMember] = 0;
+  }
+  for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+    EnsembleBeginStep(ensemble, ensemble->iaActive[iActive]);
+  }
+
+  /* Midpoint based on the derivatives at the start */
+  EnsembleSubstep(ensemble, 0, 0);
+  EnsembleAdvance(ensemble, 0, 0.5);
+  EnsembleAuxiliary(ensemble, 1);
+  EnsembleEquations(ensemble, 1);
+
+  /* Midpoint based on the first midpoint derivatives */
+  EnsembleSubstep(ensemble, 1, 0);
+  EnsembleAdvance(ensemble, 1, 0.5);
+  EnsembleAuxiliary(ensemble, 1);
+  EnsembleEquations(ensemble, 1);
+
+  /* End of the step based on the second midpoint derivatives */
+  EnsembleSubstep(ensemble, 2, 0);
+  EnsembleAdvance(ensemble, 2, 1);
+  EnsembleAuxiliary(ensemble, 1);
+  EnsembleEquations(ensemble, 1);
+
+  EnsembleSubstep(ensemble, 3, 1);
+
+  for (iRow = 0; iRow < ensemble->iNumRows; iRow++) {
+    iOff = iRow * iNumMembers;
+    for (iMember = 0; iMember < iNumMembers; iMember++) {
+      daRowDeriv[iOff + iMember] =
+            1. / 6 *
+            (daStep[0][iOff + iMember] + 2 * daStep[1][iOff + iMember] +
+             2 * daStep[2][iOff + iMember] + daStep[3][iOff + iMember]);
+    }
+    for (iEqn = iaRowStart[iRow]; iEqn < iaRowStart[iRow + 1]; iEqn++) {
+      iOff = iEqn * iNumMembers;
+      for (iMember = 0; iMember < iNumMembers; iMember++) {
+        daEqnDeriv[iOff + iMember] =
+              1. / 6 *
+              (daStepEqn[0][iOff + iMember] + 2 * daStepEqn[1][iOff + iMember] +
+               2 * daStepEqn[2][iOff + iMember] + daStepEqn[3][iOff + iMember]);
+      }
+    }
+
+    iType = ensemble->iaRowType[iRow];
+    iOff  = iRow * iNumMembers;
+    if (iType == 0 || iType == 3 || iType == 10) {
+      for (iMember = 0; iMember < iNumMembers; iMember++) {
+        daVar[iOff + iMember] = daStep[0][iOff + iMember];
+      }
+    } else {
+      for (iMember = 0; iMember < iNumMembers; iMember++) {
+        daVar[iOff + iMember] += daRowDeriv[iOff + iMember] * daDt[iMember];
+      }
+    }
+  }
+
+  for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+    iMember = ensemble->iaActive[iActive];
+    table   = &ensemble->Control[iMember].UpdateTable;
+    for (iRow = 0; iRow < ensemble->iNumRows; iRow++) {
+      table->daDeriv[iRow]  = daRowDeriv[iRow * iNumMembers + iMember];
+      *(table->pdVar[iRow]) = daVar[iRow * iNumMembers + iMember];
+    }
+    for (iEqn = 0; iEqn < ensemble->iNumEqns; iEqn++) {
+      table->daDerivProc[iEqn] = daEqnDeriv[iEqn * iNumMembers + iMember];
+    }
+  }
+}
+
+/*!
+The part of Evolve before the main loop, for one member.
+*/
+void EnsembleStartMember(ENSEMBLE *ensemble, int iMember) {
+  BODY *body       = ensemble->pBody[iMember];
+  CONTROL *control = &ensemble->Control[iMember];
+  SYSTEM *system   = &ensemble->System[iMember];
+  UPDATE *update   = ensemble->pUpdate[iMember];
+
+  EnsembleEnterMember(ensemble, iMember);
+  PropertiesAuxiliary(body, control, system, update);
+  control->Io.dNextOutput = control->Evolve.dTime + control->Io.dOutputTime;
+
+  // Get derivatives at start, useful for logging
+  fdGetTimeStep(body, control, system, update, ensemble->pfnUpdate[iMember]);
+
+  /* Write out initial conditions */
+  WriteOutput(body, control, &ensemble->Files[iMember], ensemble->Output,
+              system, update, ensemble->fnWrite);
+
+  UpdateCopy(control->Evolve.tmpUpdate, update, control->Evolve.iNumBodies);
+
+  control->Evolve.iStepsSinceLastOutput = 0;
+  control->Evolve.iTotalSteps           = 0;
+  ensemble->bActive[iMember]            = 1;
+}
+
+/*!
+Close a member's simulation. Members that reached their stop time report as
+Evolve does; halted members do not.
+*/
+void EnsembleFinishMember(ENSEMBLE *ensemble, int iMember, int bCompleted) {
+  CONTROL *control = &ensemble->Control[iMember];
+
+  EnsembleEnterMember(ensemble, iMember);
+  if (bCompleted) {
+    if (control->Io.iVerbose >= VERBPROG) {
+      printf("Evolution completed.\n");
+    }
+    ReportTimeStepLimits(ensemble->pBody[iMember], control,
+                         ensemble->pUpdate[iMember]);
+  }
+  FinishSimulation(ensemble->pBody[iMember], control,
+                   &ensemble->Files[iMember], &ensemble->Module[iMember],
+                   ensemble->Options, ensemble->Output,
+                   &ensemble->System[iMember], ensemble->pUpdate[iMember],
+                   ensemble->pfnUpdate[iMember], ensemble->fnWrite);
+  ensemble->bActive[iMember] = 0;
+}
+
+/* The ForceBehavior functions of one member, as in Evolve */
+void EnsembleForceBehavior(ENSEMBLE *ensemble, int iMember) {
+  BODY *body       = ensemble->pBody[iMember];
+  CONTROL *control = &ensemble->Control[iMember];
+  MODULE *module   = &ensemble->Module[iMember];
+  SYSTEM *system   = &ensemble->System[iMember];
+  UPDATE *update   = ensemble->pUpdate[iMember];
+  fnUpdateVariable ***fnUpdate = ensemble->pfnUpdate[iMember];
+  int iBody, iModule;
+
+  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+    for (iModule = 0; iModule < control->Evolve.iNumModules[iBody];
+         iModule++) {
+      control->fnForceBehavior[iBody][iModule](body, module, &control->Evolve,
+                                               &control->Io, system, update,
+                                               fnUpdate, iBody, iModule);
+    }
+    for (iModule = 0; iModule < control->iNumMultiForce[iBody]; iModule++) {
+      control->fnForceBehaviorMulti[iBody][iModule](
+            body, module, &control->Evolve, &control->Io, system, update,
+            fnUpdate, iBody, iModule);
+    }
+  }
+}
+
+/*!
+Evolve all lockstep members of the ensemble. Every pass of the loop is one
+pass of the loop in Evolve for each member that has not finished yet.
+*/
+void EvolveEnsemble(ENSEMBLE *ensemble) {
+  BODY *body;
+  CONTROL *control;
+  SYSTEM *system;
+  UPDATE *update;
+  int iActive, iMember, iBody;
+  double dDt;
+
+  for (iMember = 0; iMember < ensemble->iNumMembers; iMember++) {
+    if (ensemble->bLockstep[iMember]) {
+      EnsembleStartMember(ensemble, iMember);
+      if (ensemble->Control[iMember].Evolve.dTime >=
+          ensemble->Control[iMember].Evolve.dStopTime) {
+        EnsembleFinishMember(ensemble, iMember, 1);
+      }
+    }
+  }
+  EnsembleActiveMembers(ensemble);
+
+  while (ensemble->iNumActive > 0) {
+    EnsembleRungeKutta4Step(ensemble);
+
+    for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+      iMember = ensemble->iaActive[iActive];
+      EnsembleEnterMember(ensemble, iMember);
+      EnsembleForceBehavior(ensemble, iMember);
+    }
+
+    EnsembleEquations(ensemble, 0);
+
+    for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+      iMember = ensemble->iaActive[iActive];
+      body    = ensemble->pBody[iMember];
+      control = &ensemble->Control[iMember];
+      system  = &ensemble->System[iMember];
+      update  = ensemble->pUpdate[iMember];
+      dDt     = ensemble->daDt[iMember];
+      EnsembleEnterMember(ensemble, iMember);
+
+      /* Halt? */
+      if (fbCheckHalt(body, control, update, ensemble->pfnUpdate[iMember])) {
+        fdGetUpdateInfo(body, control, system, update,
+                        ensemble->pfnUpdate[iMember]);
+        WriteOutput(body, control, &ensemble->Files[iMember],
+                    ensemble->Output, system, update, ensemble->fnWrite);
+        EnsembleFinishMember(ensemble, iMember, 0);
+        continue;
+      }
+
+      for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
+        body[iBody].dAge += ensemble->daDir[iMember] * dDt;
+      }
+      control->Evolve.dTime += dDt;
+      control->Evolve.iStepsSinceLastOutput++;
+
+      /* Time for Output? */
+      if (control->Evolve.dTime >= control->Io.dNextOutput) {
+        control->Evolve.iTotalSteps += control->Evolve.iStepsSinceLastOutput;
+        WriteOutput(body, control, &ensemble->Files[iMember],
+                    ensemble->Output, system, update, ensemble->fnWrite);
+        control->Io.dNextOutput += control->Io.dOutputTime;
+        if (control->Evolve.dTime < control->Evolve.dStopTime) {
+          control->Evolve.iStepsSinceLastOutput = 0;
+        }
+      }
+    }
+    EnsembleActiveMembers(ensemble);
+
+    /* Get auxiliary properties for next step */
+    EnsembleAuxiliary(ensemble, 0);
+
+    for (iActive = 0; iActive < ensemble->iNumActive; iActive++) {
+      iMember = ensemble->iaActive[iActive];
+      control = &ensemble->Control[iMember];
+      control->Evolve.bFirstStep = 0;
+      CheckProgress(ensemble->pBody[iMember], control,
+                    &ensemble->System[iMember], ensemble->pUpdate[iMember]);
+      if (control->Evolve.dTime >= control->Evolve.dStopTime) {
+        EnsembleFinishMember(ensemble, iMember, 1);
+      }
+    }
+    EnsembleActiveMembers(ensemble);
+  }
+}
+
+/* Release the arrays allocated by RunEnsemble and InitializeEnsemble */
+void FreeEnsemble(ENSEMBLE *ensemble) {
+  int iSubStep;
+
+  if (ensemble->iReference >= 0) {
+    free(ensemble->daDir);
+    free(ensemble->daDt);
+    free(ensemble->daVar);
+    free(ensemble->daTmpVar);
+    free(ensemble->daRowDeriv);
+    free(ensemble->daEqnDeriv);
+    for (iSubStep = 0; iSubStep < 4; iSubStep++) {
+      free(ensemble->daStepDeriv[iSubStep]);
+      free(ensemble->daStepEqnDeriv[iSubStep]);
+    }
+    free(ensemble->iaRowStart);
+    free(ensemble->iaRowType);
+    free(ensemble->fnEqn);
+    free(ensemble->fnKernel);
+    free(ensemble->pLaneBody);
+    free(ensemble->pLaneSystem);
+    free(ensemble->iaLane);
+    free(ensemble->daLane);
+    free(ensemble->daWork);
+  }
+  free(ensemble->bLockstep);
+  free(ensemble->bActive);
+  free(ensemble->iaActive);
+  free(ensemble->iaDirFd);
+  free(ensemble->pBody);
+  free(ensemble->Control);
+  free(ensemble->Files);
+  free(ensemble->Module);
+  free(ensemble->System);
+  free(ensemble->pUpdate);
+  free(ensemble->pfnUpdate);
+  free(ensemble->fnOneStep);
+}
+
+/*!
+Read and integrate the iNumMembers simulations in the directories saDir,
+each described by the primary input file `infile` in its directory.
+Members with the same UPDATETABLE layout are integrated in lockstep, the
+others one after the other. Every member's output is written to its own
+directory. The OPTIONS and OUTPUT arrays are shared as in RunSimulation.
+*/
+void RunEnsemble(OPTIONS *options, OUTPUT *output, FILES *files,
+                 fnReadOption fnRead[], fnWriteOutput fnWrite[], char infile[],
+                 char **saDir, int iNumMembers, int iVerbose, int bOverwrite) {
+  ENSEMBLE ensemble;
+  CONTROL *control;
+  int iMember;
+
+  ensemble.iNumMembers    = iNumMembers;
+  ensemble.iCurrentMember = -1;
+  ensemble.Options        = options;
+  ensemble.Output         = output;
+  ensemble.fnWrite        = fnWrite;
+  ensemble.iaDirFd        = malloc(iNumMembers * sizeof(int));
+  ensemble.pBody          = malloc(iNumMembers * sizeof(BODY *));
+  ensemble.Control        = malloc(iNumMembers * sizeof(CONTROL));
+  ensemble.Files          = malloc(iNumMembers * sizeof(FILES));
+  ensemble.Module         = malloc(iNumMembers * sizeof(MODULE));
+  ensemble.System         = malloc(iNumMembers * sizeof(SYSTEM));
+  ensemble.pUpdate        = malloc(iNumMembers * sizeof(UPDATE *));
+  ensemble.pfnUpdate = malloc(iNumMembers * sizeof(fnUpdateVariable ***));
+  ensemble.fnOneStep = malloc(iNumMembers * sizeof(fnIntegrate));
+
+#ifndef VPLANET_ON_WINDOWS
+  ensemble.iHomeFd = open(".", O_RDONLY);
+  for (iMember = 0; iMember < iNumMembers; iMember++) {
+    ensemble.iaDirFd[iMember] = open(saDir[iMember], O_RDONLY);
+    if (ensemble.iaDirFd[iMember] < 0 || ensemble.iHomeFd < 0) {
+      fprintf(stderr, "ERROR: Unable to open directory %s.\n",
+              saDir[iMember]);
+      exit(EXIT_WRITE);
+    }
+  }
+#endif
+
+  for (iMember = 0; iMember < iNumMembers; iMember++) {
+    EnsembleEnterMember(&ensemble, iMember);
+    // ReadOptions records where each option was found
+    ResetOptionLocations(options);
+    ensemble.Files[iMember] = *files;
+    InitializeSimulation(&ensemble.pBody[iMember], &ensemble.Control[iMember],
+                         &ensemble.Files[iMember], &ensemble.Module[iMember],
+                         options, output, &ensemble.System[iMember],
+                         &ensemble.pUpdate[iMember],
+                         &ensemble.pfnUpdate[iMember],
+                         &ensemble.fnOneStep[iMember], fnRead, fnWrite, infile,
+                         iVerbose, bOverwrite);
+  }
+
+  InitializeEnsemble(&ensemble);
+
+  /* Members that are not integrated in lockstep run on their own */
+  for (iMember = 0; iMember < iNumMembers; iMember++) {
+    if (ensemble.bLockstep[iMember]) {
+      continue;
+    }
+    control = &ensemble.Control[iMember];
+    EnsembleEnterMember(&ensemble, iMember);
+    if (control->Evolve.bDoForward || control->Evolve.bDoBackward) {
+      Evolve(ensemble.pBody[iMember], control, &ensemble.Files[iMember],
+             &ensemble.Module[iMember], output, &ensemble.System[iMember],
+             ensemble.pUpdate[iMember], ensemble.pfnUpdate[iMember], fnWrite,
+             ensemble.fnOneStep[iMember]);
+    }
+    FinishSimulation(ensemble.pBody[iMember], control,
+                     &ensemble.Files[iMember], &ensemble.Module[iMember],
+                     options, output, &ensemble.System[iMember],
+                     ensemble.pUpdate[iMember], ensemble.pfnUpdate[iMember],
+                     fnWrite);
+  }
+
+  if (ensemble.iReference >= 0) {
+    EvolveEnsemble(&ensemble);
+  }
+
+#ifndef VPLANET_ON_WINDOWS
+  if (fchdir(ensemble.iHomeFd) != 0) {
+    fprintf(stderr, "ERROR: Unable to return to the working directory.\n");
+    exit(EXIT_WRITE);
+  }
+  for (iMember = 0; iMember < iNumMembers; iMember++) {
+    close(ensemble.iaDirFd[iMember]);
+  }
+  close(ensemble.iHomeFd);
+#endif
+
+  FreeEnsemble(&ensemble);
+}
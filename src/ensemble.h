@@ -0,0 +1,34 @@
+/**
+  @file ensemble.h
+
+  @brief Several simulations integrated in lockstep by one process.
+
+  @date Oct 18 2026
+
+*/
+
+#define ENSEMBLEWORK 24 /**< Scratch doubles per member of a batched kernel */
+
+/* @cond DOXYGEN_OVERRIDE */
+
+fnEnsembleEquation fnEnsembleKernel(fnUpdateVariable);
+void EnsembleEnterMember(ENSEMBLE *, int);
+int fbEnsembleLockstep(ENSEMBLE *, int);
+int fbEnsembleMatches(ENSEMBLE *, int, int);
+void InitializeEnsemble(ENSEMBLE *);
+void EnsembleActiveMembers(ENSEMBLE *);
+void EnsembleAuxiliary(ENSEMBLE *, int);
+void EnsembleEquations(ENSEMBLE *, int);
+void EnsembleBeginStep(ENSEMBLE *, int);
+void EnsembleSubstep(ENSEMBLE *, int, int);
+void EnsembleAdvance(ENSEMBLE *, int, double);
+void EnsembleRungeKutta4Step(ENSEMBLE *);
+void EnsembleStartMember(ENSEMBLE *, int);
+void EnsembleFinishMember(ENSEMBLE *, int, int);
+void EnsembleForceBehavior(ENSEMBLE *, int);
+void EvolveEnsemble(ENSEMBLE *);
+void FreeEnsemble(ENSEMBLE *);
+void RunEnsemble(OPTIONS *, OUTPUT *, FILES *, fnReadOption[], fnWriteOutput[],
+                 char[], char **, int, int, int);
+
+/* @endcond */
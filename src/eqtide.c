@@ -16,16 +16,19 @@ void InitializeControlEqtide(CONTROL *control, int iBody) {
 
   /* XXX We only want to initialize these values once, but if the user fails to
      instantiate eqtide for body 0, then the code segaults and fixing this is
-     hard. So we just re-malloc. This block of code causes memory to be permanently
-     lost, so should be fixed someday!
+     hard. So we just re-allocate. The earlier copies stay in the arena until
+     the end of the run.
      */
   control->Evolve.bForceEqSpin =
-        malloc(control->Evolve.iNumBodies * sizeof(int));
+        ArenaAlloc(&control->Arena, control->Evolve.iNumBodies * sizeof(int));
   control->Evolve.dMaxLockDiff =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
   control->Evolve.dSyncEcc =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
-  control->Evolve.bFixOrbit = malloc(control->Evolve.iNumBodies * sizeof(int));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
+  control->Evolve.bFixOrbit =
+        ArenaAlloc(&control->Arena, control->Evolve.iNumBodies * sizeof(int));
 }
 
 /* All the auxiliary properties for EQTIDE calculations need to be included
@@ -99,9 +102,11 @@ void BodyCopyEqtide(BODY *dest, BODY *src, int iTideModel, int iNumBodies,
 
 void InitializeBodyEqtide(BODY *body, CONTROL *control, UPDATE *update,
                           int iBody, int iModule) {
-  body[iBody].iaTidePerts = malloc(body[iBody].iTidePerts * sizeof(int));
+  body[iBody].iaTidePerts =
+        ArenaAlloc(&control->Arena, body[iBody].iTidePerts * sizeof(int));
   body[iBody].daDoblDtEqtide =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
 }
 
 void InitializeUpdateTmpBodyEqtide(BODY *body, CONTROL *control, UPDATE *update,
@@ -109,32 +114,38 @@ void InitializeUpdateTmpBodyEqtide(BODY *body, CONTROL *control, UPDATE *update,
   int iPert;
 
   control->Evolve.tmpBody[iBody].dTidalChi =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
   control->Evolve.tmpBody[iBody].dTidalZ =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
 
   control->Evolve.tmpBody[iBody].iaTidePerts =
-        malloc(body[iBody].iTidePerts * sizeof(int));
+        ArenaAlloc(&control->Arena, body[iBody].iTidePerts * sizeof(int));
   control->Evolve.tmpBody[iBody].daDoblDtEqtide =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
 
   if (control->Evolve.iEqtideModel == CPL) {
     control->Evolve.tmpBody[iBody].iTidalEpsilon =
-          malloc(control->Evolve.iNumBodies * sizeof(int *));
+          ArenaAlloc(&control->Arena,
+                     control->Evolve.iNumBodies * sizeof(int *));
     for (iPert = 0; iPert < control->Evolve.iNumBodies; iPert++) {
       control->Evolve.tmpBody[iBody].iTidalEpsilon[iPert] =
-            malloc(10 * sizeof(int));
+            ArenaAlloc(&control->Arena, 10 * sizeof(int));
     }
   }
 
   if (control->Evolve.iEqtideModel == CTL) {
     control->Evolve.tmpBody[iBody].dTidalF =
-          malloc(control->Evolve.iNumBodies * sizeof(double *));
+          ArenaAlloc(&control->Arena,
+                     control->Evolve.iNumBodies * sizeof(double *));
     control->Evolve.tmpBody[iBody].dTidalBeta =
-          malloc(control->Evolve.iNumBodies * sizeof(double));
+          ArenaAlloc(&control->Arena,
+                     control->Evolve.iNumBodies * sizeof(double));
     for (iPert = 0; iPert < control->Evolve.iNumBodies; iPert++) {
       control->Evolve.tmpBody[iBody].dTidalF[iPert] =
-            malloc(5 * sizeof(double));
+            ArenaAlloc(&control->Arena, 5 * sizeof(double));
     }
   }
 }
@@ -624,8 +635,12 @@ void ReadTidePerts(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                     control->Io.iVerbose);
     /* Now do some initializing */
     body[iFile - 1].iTidePerts = iNumIndices;
+    /* The names are only needed until VerifyPerturbersEqtide, so they
+       live in the simulation's arena */
+    body[iFile - 1].saTidePerts =
+          ArenaAlloc(&control->Arena,
+                     iNumIndices * sizeof(*body[iFile - 1].saTidePerts));
     for (iBody = 0; iBody < iNumIndices; iBody++) {
-      memset(body[iFile - 1].saTidePerts[iBody], '\0', NAMELEN);
       strcpy(body[iFile - 1].saTidePerts[iBody], saTmp[iBody]);
     }
     UpdateFoundOptionMulti(&files->Infile[iFile], options, lTmp, iNumLines,
@@ -3780,7 +3795,12 @@ void PropsAuxCTL(BODY *body, EVOLVE *evolve, IO *io, UPDATE *update,
     fdaCTLZ(body, body[iBody].dSemi, iBody, 0);
     body[iBody].dTidalBeta[0] = fdCTLBeta(body[iBody].dEcc);
     fdaChi(body, body[iBody].dMeanMotion, body[iBody].dSemi, iBody, 0);
-    PropsAuxOrbiterCTL(body, update, iBody);
+    if (evolve->bBatchDeccDt) {
+      // The ensemble computes de/dt for all its members at once
+      PropsAuxOrbiterGeneral(body, iBody);
+    } else {
+      PropsAuxOrbiterCTL(body, update, iBody);
+    }
   }
 
   for (iPert = 0; iPert < body[iBody].iTidePerts; iPert++) {
@@ -4238,6 +4258,95 @@ orbiter, iaBody[0] = central body */
   }
 }
 
+/*! fdCPLDsemiDt for several members of an ensemble. The members' inputs are
+ * gathered into contiguous arrays first, then the derivative of every member
+ * is computed with the same operations in the same order as fdCPLDsemiDt.
+ */
+void fvCPLDsemiDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                          int iNumLanes, double *daDeriv, double *daWork) {
+  int iB0 = iaBody[0], iB1 = iaBody[1], iLane;
+  BODY *body;
+  double dQ, dA, dP0, dP1, dL0, dL1;
+  double *daSemi  = daWork;
+  double *daMass0 = daWork + iNumLanes;
+  double *daMass1 = daWork + 2 * iNumLanes;
+  double *daZ0    = daWork + 3 * iNumLanes;
+  double *daZ1    = daWork + 4 * iNumLanes;
+  double *daEccSq = daWork + 5 * iNumLanes;
+  double *daSin0  = daWork + 6 * iNumLanes;
+  double *daSin1  = daWork + 7 * iNumLanes;
+  // Epsilons 0, 1, 2, 5 and 8 of the orbiter, then of the central body
+  double *daEps0  = daWork + 8 * iNumLanes;
+  double *daEps1  = daWork + 13 * iNumLanes;
+  double *daLock0 = daWork + 18 * iNumLanes;
+  double *daLock1 = daWork + 19 * iNumLanes;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    body                          = pBody[iLane];
+    daSemi[iLane]                 = body[iB0].dSemi;
+    daMass0[iLane]                = body[iB0].dMass;
+    daMass1[iLane]                = body[iB1].dMass;
+    daZ0[iLane]                   = body[iB0].dTidalZ[iB1];
+    daZ1[iLane]                   = body[iB1].dTidalZ[iB0];
+    daEccSq[iLane]                = body[iB0].dEccSq;
+    daSin0[iLane]                 = sin(body[iB0].dObliquity);
+    daSin1[iLane]                 = sin(body[iB1].dObliquity);
+    daEps0[iLane]                 = body[iB0].iTidalEpsilon[iB1][0];
+    daEps0[iNumLanes + iLane]     = body[iB0].iTidalEpsilon[iB1][1];
+    daEps0[2 * iNumLanes + iLane] = body[iB0].iTidalEpsilon[iB1][2];
+    daEps0[3 * iNumLanes + iLane] = body[iB0].iTidalEpsilon[iB1][5];
+    daEps0[4 * iNumLanes + iLane] = body[iB0].iTidalEpsilon[iB1][8];
+    daEps1[iLane]                 = body[iB1].iTidalEpsilon[iB0][0];
+    daEps1[iNumLanes + iLane]     = body[iB1].iTidalEpsilon[iB0][1];
+    daEps1[2 * iNumLanes + iLane] = body[iB1].iTidalEpsilon[iB0][2];
+    daEps1[3 * iNumLanes + iLane] = body[iB1].iTidalEpsilon[iB0][5];
+    daEps1[4 * iNumLanes + iLane] = body[iB1].iTidalEpsilon[iB0][8];
+    daLock0[iLane]                = body[iB0].bTideLock;
+    daLock1[iLane]                = body[iB1].bTideLock;
+  }
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    dQ = daSemi[iLane] * daSemi[iLane] /
+         (4 * BIGG * daMass0[iLane] * daMass1[iLane]);
+    dA = -daSemi[iLane] * daSemi[iLane] /
+         (BIGG * daMass0[iLane] * daMass1[iLane]);
+    // Terms of a body that is not locked
+    dP0 = 4 * daEps0[iLane] +
+          daEccSq[iLane] * (-20 * daEps0[iLane] +
+                            147. / 2 * daEps0[iNumLanes + iLane] +
+                            0.5 * daEps0[2 * iNumLanes + iLane] -
+                            3 * daEps0[3 * iNumLanes + iLane]) -
+          4 * daSin0[iLane] * daSin0[iLane] *
+                (daEps0[iLane] - daEps0[4 * iNumLanes + iLane]);
+    dP1 = 4 * daEps1[iLane] +
+          daEccSq[iLane] * (-20 * daEps1[iLane] +
+                            147. / 2 * daEps1[iNumLanes + iLane] +
+                            0.5 * daEps1[2 * iNumLanes + iLane] -
+                            3 * daEps1[3 * iNumLanes + iLane]) -
+          4 * daSin1[iLane] * daSin1[iLane] *
+                (daEps1[iLane] - daEps1[4 * iNumLanes + iLane]);
+    // Terms of a locked body
+    dL0 = 7.0 * daEccSq[iLane] + daSin0[iLane] * daSin0[iLane];
+    dL1 = 7.0 * daEccSq[iLane] + daSin1[iLane] * daSin1[iLane];
+
+    if (!daLock0[iLane] && daLock1[iLane]) {
+      daDeriv[iLane] = (0.0 + dQ * daZ0[iLane] * dP0) +
+                       dA * daZ1[iLane] * dL1 * daEps1[2 * iNumLanes + iLane];
+    } else if (daLock0[iLane] && !daLock1[iLane]) {
+      daDeriv[iLane] =
+            (0.0 + dA * daZ0[iLane] * dL0 * daEps0[2 * iNumLanes + iLane]) +
+            dQ * daZ1[iLane] * dP1;
+    } else if (daLock0[iLane] && daLock1[iLane]) {
+      daDeriv[iLane] =
+            dA * ((0.0 + daZ0[iLane] * dL0 * daEps0[2 * iNumLanes + iLane]) +
+                  daZ1[iLane] * dL1 * daEps1[2 * iNumLanes + iLane]);
+    } else {
+      daDeriv[iLane] =
+            dQ * ((0.0 + daZ0[iLane] * dP0) + daZ1[iLane] * dP1);
+    }
+  }
+}
+
 /* Hecc and Kecc calculated by chain rule, e.g. dh/dt = de/dt * dh/de. */
 
 double fdCPLDeccDt(BODY *body, int *iaBody) {
@@ -4544,6 +4653,99 @@ double fdCTLDeccDt(BODY *body, UPDATE *update, int *iaBody) {
          (2 * BIGG * body[iaBody[0]].dMass * body[iaBody[1]].dMass) * dSum;
 }
 
+/*! fdCTLDsemiDt (bSemi = 1) or fdCTLDeccDt (bSemi = 0) for several members
+ * of an ensemble. The two differ only in their coefficients, so they share
+ * the gathering of the members' inputs. The arithmetic follows the scalar
+ * functions operation by operation.
+ */
+void fvCTLOrbitEnsemble(BODY **pBody, int *iaBody, int iNumLanes,
+                        double *daDeriv, double *daWork, int bSemi) {
+  int iB0 = iaBody[0], iB1 = iaBody[1], iLane;
+  BODY *body;
+  double dSum;
+  double *daSemi   = daWork;
+  double *daMass0  = daWork + iNumLanes;
+  double *daMass1  = daWork + 2 * iNumLanes;
+  double *daZ0     = daWork + 3 * iNumLanes;
+  double *daZ1     = daWork + 4 * iNumLanes;
+  double *daCos0   = daWork + 5 * iNumLanes;
+  double *daCos1   = daWork + 6 * iNumLanes;
+  double *daRot0   = daWork + 7 * iNumLanes;
+  double *daRot1   = daWork + 8 * iNumLanes;
+  double *daMean   = daWork + 9 * iNumLanes;
+  double *daEcc    = daWork + 10 * iNumLanes;
+  double *daFSpin  = daWork + 11 * iNumLanes; // dTidalF[][1] or [][3]
+  double *daFOrbit = daWork + 12 * iNumLanes; // dTidalF[][0] or [][2]
+  double *daBSpin  = daWork + 13 * iNumLanes; // beta^12 or beta^10
+  double *daBOrbit = daWork + 14 * iNumLanes; // beta^15 or beta^13
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    body            = pBody[iLane];
+    daSemi[iLane]   = body[iB0].dSemi;
+    daMass0[iLane]  = body[iB0].dMass;
+    daMass1[iLane]  = body[iB1].dMass;
+    daZ0[iLane]     = body[iB0].dTidalZ[iB1];
+    daZ1[iLane]     = body[iB1].dTidalZ[iB0];
+    daCos0[iLane]   = cos(body[iB0].dObliquity);
+    daCos1[iLane]   = cos(body[iB1].dObliquity);
+    daRot0[iLane]   = body[iB0].dRotRate;
+    daRot1[iLane]   = body[iB1].dRotRate;
+    daMean[iLane]   = body[iB0].dMeanMotion;
+    daEcc[iLane]    = body[iB0].dEcc;
+    if (bSemi) {
+      daFSpin[iLane]  = body[iB0].dTidalF[iB1][1];
+      daFOrbit[iLane] = body[iB0].dTidalF[iB1][0];
+      daBSpin[iLane]  = pow(body[iB0].dTidalBeta[iB1], 12);
+      daBOrbit[iLane] = pow(body[iB0].dTidalBeta[iB1], 15);
+    } else {
+      daFSpin[iLane]  = body[iB0].dTidalF[iB1][3];
+      daFOrbit[iLane] = body[iB0].dTidalF[iB1][2];
+      daBSpin[iLane]  = pow(body[iB0].dTidalBeta[iB1], 10);
+      daBOrbit[iLane] = pow(body[iB0].dTidalBeta[iB1], 13);
+    }
+  }
+
+  if (bSemi) {
+    for (iLane = 0; iLane < iNumLanes; iLane++) {
+      dSum = 0;
+      dSum += daZ0[iLane] *
+              (daCos0[iLane] * daFSpin[iLane] * daRot0[iLane] /
+                     (daBSpin[iLane] * daMean[iLane]) -
+               daFOrbit[iLane] / daBOrbit[iLane]);
+      dSum += daZ1[iLane] *
+              (daCos1[iLane] * daFSpin[iLane] * daRot1[iLane] /
+                     (daBSpin[iLane] * daMean[iLane]) -
+               daFOrbit[iLane] / daBOrbit[iLane]);
+      daDeriv[iLane] = 2 * daSemi[iLane] * daSemi[iLane] /
+                       (BIGG * daMass0[iLane] * daMass1[iLane]) * dSum;
+    }
+  } else {
+    for (iLane = 0; iLane < iNumLanes; iLane++) {
+      dSum = 0;
+      dSum += daZ0[iLane] *
+              (daCos0[iLane] * daFSpin[iLane] * daRot0[iLane] /
+                     (daBSpin[iLane] * daMean[iLane]) -
+               18 * daFOrbit[iLane] / (11 * daBOrbit[iLane]));
+      dSum += daZ1[iLane] *
+              (daCos1[iLane] * daFSpin[iLane] * daRot1[iLane] /
+                     (daBSpin[iLane] * daMean[iLane]) -
+               18 * daFOrbit[iLane] / (11 * daBOrbit[iLane]));
+      daDeriv[iLane] = 11 * daSemi[iLane] * daEcc[iLane] /
+                       (2 * BIGG * daMass0[iLane] * daMass1[iLane]) * dSum;
+    }
+  }
+}
+
+void fvCTLDsemiDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                          int iNumLanes, double *daDeriv, double *daWork) {
+  fvCTLOrbitEnsemble(pBody, iaBody, iNumLanes, daDeriv, daWork, 1);
+}
+
+void fvCTLDeccDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                         int iNumLanes, double *daDeriv, double *daWork) {
+  fvCTLOrbitEnsemble(pBody, iaBody, iNumLanes, daDeriv, daWork, 0);
+}
+
 double fdCTLDrotrateDt(BODY *body, SYSTEM *system, int *iaBody) {
   /* Note if tidally locked, ForceBehavior will fix the rotation
      rate and override this derivative. */
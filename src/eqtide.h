@@ -309,6 +309,8 @@ double fdCPLDsemiDtBody(BODY, double, double, double);
 double fdCPLDeccDt(BODY *, int *);
 double fdDEdTCPLEqtide(BODY *, SYSTEM *, int *);
 double fdCPLDeccDtLocked(BODY *, UPDATE *, int *);
+void fvCPLDsemiDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                          double *);
 
 /******************** CTL Functions ********************/
 
@@ -342,6 +344,10 @@ double fdCTLDHeccDt(BODY *, SYSTEM *, int *);
 double fdCTLDKeccDt(BODY *, SYSTEM *, int *);
 double fdDEdTCTLEqtide(BODY *, SYSTEM *, int *);
 double fdCTLDoblDt(BODY *, int *);
+void fvCTLOrbitEnsemble(BODY **, int *, int, double *, double *, int);
+void fvCTLDsemiDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                          double *);
+void fvCTLDeccDtEnsemble(BODY **, SYSTEM **, int *, int, double *, double *);
 
 /******************** DB15 Functions ********************/
 double fdPowerEqtideDB15(BODY *, int);
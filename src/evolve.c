@@ -119,213 +119,368 @@ double AssignDt(double dMin, double dNextOutput, double dEta) {
   return dMin;
 }
 
+/*
+ * Timescale kernels. Each evaluates the equations of one row (primary
+ * variable) or one equation of an UPDATETABLE, stores the derivatives in
+ * daDerivProc and returns the new minimum timescale dMin. The kernel of each
+ * row and equation is chosen once by InitializeTimeStep, so fdGetTimeStep
+ * does not re-examine the equation types on every step.
+ */
+
+/* The variable does not require a derivative, but is calculated explicitly
+   as a function of age (type 0). */
+double fdTimeStepExplicit(BODY *body, CONTROL *control, SYSTEM *system,
+                          UPDATETABLE *table, int iRow, double dMin) {
+  int iEqn, iEnd = table->iaRowStart[iRow + 1];
+  double dVarNow, dVarTotal, dMinNow;
+
+  dVarNow = *table->pdVar[iRow];
+  for (iEqn = table->iaRowStart[iRow]; iEqn < iEnd; iEqn++) {
+    table->daDerivProc[iEqn] =
+          table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  }
+  if (control->Evolve.bFirstStep) {
+    control->Evolve.bFirstStep = 0;
+    return control->Evolve.dTimeStep;
+  }
+  /* Sum over all equations giving new value of the variable */
+  dVarTotal = 0.;
+  for (iEqn = table->iaRowStart[iRow]; iEqn < iEnd; iEqn++) {
+    dVarTotal += table->daDerivProc[iEqn];
+  }
+  // Prevent division by zero
+  if (dVarNow != dVarTotal) {
+    dMinNow =
+          fabs(dVarNow / ((dVarNow - dVarTotal) / control->Evolve.dTimeStep));
+    if (dMinNow < dMin) {
+      dMin = dMinNow;
+    }
+  }
+  return dMin;
+}
+
+/* The variable does not require a derivative, but is calculated explicitly
+   as a function of age and is a sinusoidal quantity, e.g. h,k,p,q in
+   DistOrb (type 3). */
+double fdTimeStepSinusoidal(BODY *body, CONTROL *control, SYSTEM *system,
+                            UPDATETABLE *table, int iRow, double dMin) {
+  int iEqn, iEnd = table->iaRowStart[iRow + 1];
+  double dVarNow, dVarTotal, dMinNow;
+
+  dVarNow = *table->pdVar[iRow];
+  for (iEqn = table->iaRowStart[iRow]; iEqn < iEnd; iEqn++) {
+    table->daDerivProc[iEqn] =
+          table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  }
+  if (control->Evolve.bFirstStep) {
+    control->Evolve.bFirstStep = 0;
+    return control->Evolve.dTimeStep;
+  }
+  /* Sum over all equations giving new value of the variable */
+  dVarTotal = 0.;
+  for (iEqn = table->iaRowStart[iRow]; iEqn < iEnd; iEqn++) {
+    dVarTotal += table->daDerivProc[iEqn];
+  }
+  // Prevent division by zero
+  if (dVarNow != dVarTotal) {
+    dMinNow = fabs(1.0 / ((dVarNow - dVarTotal) / control->Evolve.dTimeStep));
+    if (dMinNow < dMin) {
+      dMin = dMinNow;
+    }
+  }
+  return dMin;
+}
+
+/* Equations that are integrated in the matrix but are NOT allowed to dictate
+   timestepping. These are derived quantities, like lost energy, that must be
+   integrated as primary variables to keep track of them properly, i.e. lost
+   energy depends on changing radii, which are integrated. But in this case,
+   since they are derived quantities, they should NOT participate in timestep
+   selection - dflemin3 (type 5) */
+double fdTimeStepDerived(BODY *body, CONTROL *control, SYSTEM *system,
+                         UPDATETABLE *table, int iRow, double dMin) {
+  int iEqn;
+
+  for (iEqn = table->iaRowStart[iRow]; iEqn < table->iaRowStart[iRow + 1];
+       iEqn++) {
+    table->daDerivProc[iEqn] =
+          table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  }
+  return dMin;
+}
+
+/* Integration for binary, where parameters are computed as explicit
+   functions of time outside the matrix, so the timescale is the time until
+   the next output (type 10). */
+double fdTimeStepOutput(BODY *body, CONTROL *control, SYSTEM *system,
+                        UPDATETABLE *table, int iRow, double dMin) {
+  if (control->Io.dNextOutput < dMin) {
+    dMin = control->Io.dNextOutput;
+  }
+  return dMin;
+}
+
+/* The variable is controlled by time derivatives; each equation has its own
+   kernel. */
+double fdTimeStepRates(BODY *body, CONTROL *control, SYSTEM *system,
+                       UPDATETABLE *table, int iRow, double dMin) {
+  int iEqn;
+
+  for (iEqn = table->iaRowStart[iRow]; iEqn < table->iaRowStart[iRow + 1];
+       iEqn++) {
+    dMin = table->fnEqnTimeStep[iEqn](body, control, system, table, iRow, iEqn,
+                                      dMin);
+  }
+  return dMin;
+}
+
+/* A polar/sinusoidal quantity controlled by a time derivative (type 2) */
+double fdTimeStepPolar(BODY *body, CONTROL *control, SYSTEM *system,
+                       UPDATETABLE *table, int iRow, int iEqn, double dMin) {
+  double dMinNow;
+
+  table->daDerivProc[iEqn] =
+        table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  if (table->daDerivProc[iEqn] != 0) {
+    dMinNow = fabs(1.0 / table->daDerivProc[iEqn]);
+    if (dMinNow < dMin) {
+      dMin = dMinNow;
+    }
+  }
+  return dMin;
+}
+
+/* The ?Obl variables require special treatment because they can
+   overconstrain obliquity and PrecA (type 2) */
+double fdTimeStepPolarObl(BODY *body, CONTROL *control, SYSTEM *system,
+                          UPDATETABLE *table, int iRow, int iEqn,
+                          double dMin) {
+  int iBody = table->iaRowBody[iRow];
+  double dMinNow;
+
+  table->daDerivProc[iEqn] =
+        table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  if (table->daDerivProc[iEqn] != 0) {
+    if (body[iBody].dObliquity != 0) {
+      dMinNow =
+            fabs(sin(body[iBody].dObliquity) / table->daDerivProc[iEqn]);
+    } else { // Obliquity is 0, so its evolution shouldn't impact the timestep
+      dMinNow = dHUGE;
+    }
+    if (dMinNow < dMin) {
+      dMin = dMinNow;
+    }
+  }
+  return dMin;
+}
+
+/* Eccentricity vector components, limited by the eccentricity (type 2) */
+double fdTimeStepPolarEcc(BODY *body, CONTROL *control, SYSTEM *system,
+                          UPDATETABLE *table, int iRow, int iEqn,
+                          double dMin) {
+  int iBody = table->iaRowBody[iRow];
+  double dMinNow;
+
+  table->daDerivProc[iEqn] =
+        table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  if (table->daDerivProc[iEqn] != 0) {
+    if (body[iBody].dEcc != 0) {
+      dMinNow = fabs(body[iBody].dEcc / table->daDerivProc[iEqn]);
+    } else { // Eccentricity is 0, so its evolution shouldn't impact the
+             // timestep
+      dMinNow = dHUGE;
+    }
+    if (dMinNow < dMin) {
+      dMin = dMinNow;
+    }
+  }
+  return dMin;
+}
+
+/* Ice sheets, which enforce a minimum step size, otherwise dDt -> 0 real
+   fast (type 9) */
+double fdTimeStepIce(BODY *body, CONTROL *control, SYSTEM *system,
+                     UPDATETABLE *table, int iRow, int iEqn, double dMin) {
+  int iBody = table->iaRowBody[iRow];
+  double dMinNow, dMinIce;
+
+  table->daDerivProc[iEqn] =
+        table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  if (table->daDerivProc[iEqn] != 0 && *(table->pdVar[iRow]) != 0) {
+    dMinNow = fabs((*(table->pdVar[iRow])) / table->daDerivProc[iEqn]);
+    if (dMinNow < dMin) {
+      dMinIce = control->Halt[iBody].iMinIceDt *
+                (2 * PI / body[iBody].dMeanMotion) / control->Evolve.dEta;
+      if (dMinNow < dMinIce) {
+        dMin = dMinIce;
+      } else {
+        dMin = dMinNow;
+      }
+    }
+  }
+  return dMin;
+}
+
+/* SpiNBody: As x,y,z can cross over 0, the usual x/(dx/dt) timestep doesn't
+   work. This version compares the orbital radius to velocity. Probably room
+   for improvement here. (type 7) */
+double fdTimeStepOrbit(BODY *body, CONTROL *control, SYSTEM *system,
+                       UPDATETABLE *table, int iRow, int iEqn, double dMin) {
+  int iBody = table->iaRowBody[iRow];
+  double dMinNow;
+
+  if ((control->Evolve.bSpiNBodyDistOrb == 0) ||
+      (control->Evolve.bUsingSpiNBody == 1)) {
+    table->daDerivProc[iEqn] =
+          table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+    dMinNow = sqrt((body[iBody].dPositionX * body[iBody].dPositionX +
+                    body[iBody].dPositionY * body[iBody].dPositionY +
+                    body[iBody].dPositionZ * body[iBody].dPositionZ) /
+                   (body[iBody].dVelX * body[iBody].dVelX +
+                    body[iBody].dVelY * body[iBody].dVelY +
+                    body[iBody].dVelZ * body[iBody].dVelZ));
+    if (dMinNow < dMin) {
+      dMin = dMinNow;
+    }
+  }
+  return dMin;
+}
+
+/* The parameter is controlled by a time derivative (type 1) */
+double fdTimeStepRate(BODY *body, CONTROL *control, SYSTEM *system,
+                      UPDATETABLE *table, int iRow, int iEqn, double dMin) {
+  double dMinNow;
+
+  table->daDerivProc[iEqn] =
+        table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
+  if (!bFloatComparison(table->daDerivProc[iEqn], 0.0) &&
+      !bFloatComparison(*(table->pdVar[iRow]), 0.0)) {
+    dMinNow = fabs((*(table->pdVar[iRow])) / table->daDerivProc[iEqn]);
+    if (dMinNow < dMin) {
+      dMin = dMinNow;
+    }
+  }
+  return dMin;
+}
+
+/**
+  Choose the timescale kernel of every row and equation from the equation
+  types. Must be called after all modules have set iaType, and the types must
+  not change afterwards.
+
+@param control Pointer to the CONTROL struct
+@param update The UPDATE array
+*/
+void InitializeTimeStep(CONTROL *control, UPDATE *update) {
+  UPDATETABLE *table = &control->UpdateTable;
+  int iRow, iBody, iVar, iEqn, iType;
+
+  table->fnRowTimeStep = ArenaAlloc(
+        &control->Arena, table->iNumRows * sizeof(fnTimeStepVariable));
+  table->fnEqnTimeStep = ArenaAlloc(
+        &control->Arena, table->iNumEqns * sizeof(fnTimeStepEquation));
+  table->iaLimitCount =
+        ArenaAlloc(&control->Arena, table->iNumRows * sizeof(int));
+
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    iBody = table->iaRowBody[iRow];
+    iVar  = table->iaRowVar[iRow];
+    iType = table->iaType[table->iaRowStart[iRow]];
+
+    if (iType == 0) {
+      table->fnRowTimeStep[iRow] = &fdTimeStepExplicit;
+    } else if (iType == 5) {
+      table->fnRowTimeStep[iRow] = &fdTimeStepDerived;
+    } else if (iType == 10) {
+      table->fnRowTimeStep[iRow] = &fdTimeStepOutput;
+    } else if (iType == 3) {
+      table->fnRowTimeStep[iRow] = &fdTimeStepSinusoidal;
+    } else {
+      table->fnRowTimeStep[iRow] = &fdTimeStepRates;
+    }
+
+    for (iEqn = table->iaRowStart[iRow]; iEqn < table->iaRowStart[iRow + 1];
+         iEqn++) {
+      if (table->iaType[iEqn] == 2) {
+        if (iVar == update[iBody].iXobl || iVar == update[iBody].iYobl ||
+            iVar == update[iBody].iZobl) {
+          table->fnEqnTimeStep[iEqn] = &fdTimeStepPolarObl;
+        } else if (iVar == update[iBody].iHecc ||
+                   iVar == update[iBody].iKecc) {
+          table->fnEqnTimeStep[iEqn] = &fdTimeStepPolarEcc;
+        } else {
+          table->fnEqnTimeStep[iEqn] = &fdTimeStepPolar;
+        }
+      } else if (table->iaType[iEqn] == 9) {
+        table->fnEqnTimeStep[iEqn] = &fdTimeStepIce;
+      } else if (table->iaType[iEqn] == 7) {
+        table->fnEqnTimeStep[iEqn] = &fdTimeStepOrbit;
+      } else {
+        table->fnEqnTimeStep[iEqn] = &fdTimeStepRate;
+      }
+    }
+  }
+
+  /* The temporary UPDATE has the same equations */
+  control->TmpUpdateTable.fnRowTimeStep = table->fnRowTimeStep;
+  control->TmpUpdateTable.fnEqnTimeStep = table->fnEqnTimeStep;
+  control->TmpUpdateTable.iaLimitCount  = table->iaLimitCount;
+  control->Evolve.iLimitRow             = -1;
+}
+
 double fdGetTimeStep(BODY *body, CONTROL *control, SYSTEM *system,
                      UPDATE *update, fnUpdateVariable ***fnUpdate) {
   /* Fills the Update arrays with the derivatives
    * or new values. It returns the smallest timescale for use
-   * in variable timestepping. Uses either a 4th order Runge-Kutte integrator or
-   * an Euler step.
+   * in variable timestepping, and records the row that set it in
+   * control->Evolve.iLimitRow. Uses either a 4th order Runge-Kutte
+   * integrator or an Euler step.
    */
 
-  int iBody, iVar, iEqn; // Dummy counting variables
-  EVOLVE
-  integr; // Dummy EVOLVE struct so we don't have to dereference control a lot
-  double dVarNow, dMinNow, dMin = dHUGE,
-                           dVarTotal; // Intermediate storage variables
-
-  integr = control->Evolve;
+  int iRow; // Dummy counting variable
+  UPDATETABLE *table = fpUpdateTable(control, update);
+  double dMin, dMinNow; // Intermediate storage variables
 
-  dMin = dHUGE;
+  dMin                      = dHUGE;
+  control->Evolve.iLimitRow = -1;
 
-  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
-    if (update[iBody].iNumVars > 0) {
-      for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
-
-        // The parameter does not require a derivative, but is calculated
-        // explicitly as a function of age.
-        /*
-        printf("%d %d\n",iBody,iVar);
-        fflush(stdout);
-        */
-        if (update[iBody].iaType[iVar][0] == 0) {
-          dVarNow = *update[iBody].pdVar[iVar];
-          for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-            update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                  body, system, update[iBody].iaBody[iVar][iEqn]);
-          }
-          if (control->Evolve.bFirstStep) {
-            dMin                       = integr.dTimeStep;
-            control->Evolve.bFirstStep = 0;
-          } else {
-            /* Sum over all equations giving new value of the variable */
-            dVarTotal = 0.;
-            for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-              dVarTotal += update[iBody].daDerivProc[iVar][iEqn];
-            }
-            // Prevent division by zero
-            if (dVarNow != dVarTotal) {
-              dMinNow =
-                    fabs(dVarNow / ((dVarNow - dVarTotal) / integr.dTimeStep));
-              if (dMinNow < dMin) {
-                dMin = dMinNow;
-              }
-            }
-          }
-          /* Equations that are integrated in the matrix but are NOT allowed to
-           dictate timestepping.  These are derived quantities, like lost
-           energy, that must be integrated as primary variables to keep track of
-           them properly, i.e. lost energy depends on changing radii, which are
-           integrated.  But in this case, since they are derived quantities,
-           they should NOT participate in timestep selection - dflemin3
-         */
-        } else if (update[iBody].iaType[iVar][0] == 5) {
-          // continue;
-          for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-            update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                  body, system, update[iBody].iaBody[iVar][iEqn]);
-          }
-          /* Integration for binary, where parameters can be computed via
-         derivatives, or as an explicit function of age */
-        } else if (update[iBody].iaType[iVar][0] == 10) {
-          /* Equations not in matrix, computing things as explicit function of
-           time, so we set dMin to time until next output
-           Figure out time until next output */
-          dMinNow = control->Io.dNextOutput;
-          if (dMinNow < dMin) {
-            dMin = dMinNow;
-          }
-          /* The parameter does not require a derivative, but is calculated
-            explicitly as a function of age and is a sinusoidal quantity
-            (e.g. h,k,p,q in DistOrb) */
-        } else if (update[iBody].iaType[iVar][0] == 3) {
-          dVarNow = *update[iBody].pdVar[iVar];
-          for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-            update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                  body, system, update[iBody].iaBody[iVar][iEqn]);
-          }
-          if (control->Evolve.bFirstStep) {
-            dMin                       = integr.dTimeStep;
-            control->Evolve.bFirstStep = 0;
-          } else {
-            /* Sum over all equations giving new value of the variable */
-            dVarTotal = 0.;
-            for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-              dVarTotal += update[iBody].daDerivProc[iVar][iEqn];
-            }
-            // Prevent division by zero
-            if (dVarNow != dVarTotal) {
-              dMinNow = fabs(1.0 / ((dVarNow - dVarTotal) / integr.dTimeStep));
-              if (dMinNow < dMin) {
-                dMin = dMinNow;
-              }
-            }
-          }
-          /* The parameter is a "polar/sinusoidal quantity" and
-            controlled by a time derivative */
-        } else {
-          for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-            if (update[iBody].iaType[iVar][iEqn] == 2) {
-              update[iBody].daDerivProc[iVar][iEqn] =
-                    fnUpdate[iBody][iVar][iEqn](
-                          body, system, update[iBody].iaBody[iVar][iEqn]);
-              // if (update[iBody].daDerivProc[iVar][iEqn] != 0 &&
-              // *(update[iBody].pdVar[iVar]) != 0) {
-              if (update[iBody].daDerivProc[iVar][iEqn] != 0) {
-                /* ?Obl require special treatment because they can
-                    overconstrain obliquity and PrecA */
-                if (iVar == update[iBody].iXobl ||
-                    iVar == update[iBody].iYobl ||
-                    iVar == update[iBody].iZobl) {
-                  if (body[iBody].dObliquity != 0) {
-                    dMinNow = fabs(sin(body[iBody].dObliquity) /
-                                   update[iBody].daDerivProc[iVar][iEqn]);
-                  } else { // Obliquity is 0, so its evolution shouldn't impact
-                           // the timestep
-                    dMinNow = dHUGE;
-                  }
-                } else if (iVar == update[iBody].iHecc ||
-                           iVar == update[iBody].iKecc) {
-                  if (body[iBody].dEcc != 0) {
-                    dMinNow = fabs(body[iBody].dEcc /
-                                   update[iBody].daDerivProc[iVar][iEqn]);
-                  } else { // Eccentricity is 0, so its evolution shouldn't
-                           // impact the timestep
-                    dMinNow = dHUGE;
-                  }
-                } else {
-                  dMinNow = fabs(1.0 / update[iBody].daDerivProc[iVar][iEqn]);
-                }
-                if (dMinNow < dMin) {
-                  dMin = dMinNow;
-                }
-              }
-              // enforce a minimum step size for ice sheets, otherwise dDt -> 0
-              // real fast
-            } else if (update[iBody].iaType[iVar][iEqn] == 9) {
-              update[iBody].daDerivProc[iVar][iEqn] =
-                    fnUpdate[iBody][iVar][iEqn](
-                          body, system, update[iBody].iaBody[iVar][iEqn]);
-              if (update[iBody].daDerivProc[iVar][iEqn] != 0 &&
-                  *(update[iBody].pdVar[iVar]) != 0) {
-                dMinNow = fabs((*(update[iBody].pdVar[iVar])) /
-                               update[iBody].daDerivProc[iVar][iEqn]);
-                if (dMinNow < dMin) {
-                  if (dMinNow < control->Halt[iBody].iMinIceDt *
-                                      (2 * PI / body[iBody].dMeanMotion) /
-                                      control->Evolve.dEta) {
-                    dMin = control->Halt[iBody].iMinIceDt *
-                           (2 * PI / body[iBody].dMeanMotion) /
-                           control->Evolve.dEta;
-                  } else {
-                    dMin = dMinNow;
-                  }
-                }
-              }
-              /* SpiNBody timestep: As x,y,z can cross over 0, the usual
-                  x/(dx/dt) timstep doesn't work. This version compares the
-                 orbital
-                  radius to velocity. Probably room for improvement here. */
-            } else if (update[iBody].iaType[iVar][iEqn] == 7) {
-              if ((control->Evolve.bSpiNBodyDistOrb == 0) ||
-                  (control->Evolve.bUsingSpiNBody == 1)) {
-                update[iBody].daDerivProc[iVar][iEqn] =
-                      fnUpdate[iBody][iVar][iEqn](
-                            body, system, update[iBody].iaBody[iVar][iEqn]);
-                dMinNow =
-                      sqrt((body[iBody].dPositionX * body[iBody].dPositionX +
-                            body[iBody].dPositionY * body[iBody].dPositionY +
-                            body[iBody].dPositionZ * body[iBody].dPositionZ) /
-                           (body[iBody].dVelX * body[iBody].dVelX +
-                            body[iBody].dVelY * body[iBody].dVelY +
-                            body[iBody].dVelZ * body[iBody].dVelZ));
-                if (dMinNow < dMin) {
-                  dMin = dMinNow;
-                }
-              }
-            } else {
-              // The parameter is controlled by a time derivative
-              update[iBody].daDerivProc[iVar][iEqn] =
-                    fnUpdate[iBody][iVar][iEqn](
-                          body, system, update[iBody].iaBody[iVar][iEqn]);
-              if (!bFloatComparison(update[iBody].daDerivProc[iVar][iEqn],
-                                    0.0) &&
-                  !bFloatComparison(*(update[iBody].pdVar[iVar]), 0.0)) {
-                dMinNow = fabs((*(update[iBody].pdVar[iVar])) /
-                               update[iBody].daDerivProc[iVar][iEqn]);
-                if (dMinNow < dMin) {
-                  dMin = dMinNow;
-                }
-              }
-            }
-          } // for loop
-        }   // else polar/sinusoidal
-      }     // for iNumVars
-    }       // if (update[iBody].iNumVars > 0)
-  }         // for loop iNumBodies
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    dMinNow = table->fnRowTimeStep[iRow](body, control, system, table, iRow,
+                                         dMin);
+    if (dMinNow != dMin) {
+      dMin                      = dMinNow;
+      control->Evolve.iLimitRow = iRow;
+    }
+  }
 
   return dMin;
 }
 
+/**
+  Print how often each primary variable set the timescale. Only runs with
+  variable timesteps and iVerbose >= VERBALL get the report.
+
+@param body A pointer to the current BODY struct
+@param control A pointer to the integration CONTROL struct
+@param update A pointer to the UPDATE struct
+*/
+void ReportTimeStepLimits(BODY *body, CONTROL *control, UPDATE *update) {
+  UPDATETABLE *table = &control->UpdateTable;
+  int iRow, iBody, iVar;
+
+  if (control->Io.iVerbose < VERBALL || !control->Evolve.bVarDt) {
+    return;
+  }
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    if (table->iaLimitCount[iRow] > 0) {
+      iBody = table->iaRowBody[iRow];
+      iVar  = table->iaRowVar[iRow];
+      printf("Timestep set by %s's %s: %d steps\n", body[iBody].cName,
+             update[iBody].saVarName[iVar], table->iaLimitCount[iRow]);
+    }
+  }
+}
+
 
 void fdGetUpdateInfo(BODY *body, CONTROL *control, SYSTEM *system,
                      UPDATE *update, fnUpdateVariable ***fnUpdate) {
@@ -333,23 +488,13 @@ void fdGetUpdateInfo(BODY *body, CONTROL *control, SYSTEM *system,
    * or new values..
    */
 
-  int iBody, iVar, iEqn, iNumBodies, iNumVars,
-        iNumEqns; // Dummy counting variables
-  double dVarNow, dMinNow, dMin = dHUGE,
-                           dVarTotal; // Intermediate storage variables
+  int iEqn; // Dummy counting variable
+  UPDATETABLE *table = fpUpdateTable(control, update);
 
-  iNumBodies = control->Evolve.iNumBodies;
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    if (update[iBody].iNumVars > 0) {
-      iNumVars = update[iBody].iNumVars;
-      for (iVar = 0; iVar < iNumVars; iVar++) {
-        iNumEqns = update[iBody].iNumEqns[iVar];
-        for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-          update[iBody].daDerivProc[iVar][iEqn] = fnUpdate[iBody][iVar][iEqn](
-                body, system, update[iBody].iaBody[iVar][iEqn]);
-        }
-      }
-    }
+  /* The equations of all bodies are stored consecutively */
+  for (iEqn = 0; iEqn < table->iNumEqns; iEqn++) {
+    table->daDerivProc[iEqn] =
+          table->fnEqn[iEqn](body, system, table->iaBody[iEqn]);
   }
 }
 
@@ -358,8 +503,8 @@ void EulerStep(BODY *body, CONTROL *control, SYSTEM *system, UPDATE *update,
                fnUpdateVariable ***fnUpdate, double *dDt, int iDir) {
   /* Compute and apply an Euler update step to a given parameter (x = dx/dt *
    * dt) */
-  int iBody, iVar, iEqn;
-  double dFoo;
+  int iRow, iEqn;
+  UPDATETABLE *table = &control->UpdateTable;
 
   /* Adjust dt? */
   if (control->Evolve.bVarDt) {
@@ -367,29 +512,81 @@ void EulerStep(BODY *body, CONTROL *control, SYSTEM *system, UPDATE *update,
     *dDt = fdGetTimeStep(body, control, system, update, fnUpdate);
     *dDt = AssignDt(*dDt, (control->Io.dNextOutput - control->Evolve.dTime),
                     control->Evolve.dEta);
+    if (control->Evolve.iLimitRow >= 0) {
+      table->iaLimitCount[control->Evolve.iLimitRow]++;
+    }
   }
 
-  for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
-    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
-      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-        if (update[iBody].iaType[iVar][iEqn] == 0) {
-          *(update[iBody].pdVar[iVar]) = update[iBody].daDerivProc[iVar][iEqn];
-        } else {
-          /* Update the parameter in the BODY struct! Be careful! */
-          *(update[iBody].pdVar[iVar]) +=
-                iDir * update[iBody].daDerivProc[iVar][iEqn] * (*dDt);
-        }
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    for (iEqn = table->iaRowStart[iRow]; iEqn < table->iaRowStart[iRow + 1];
+         iEqn++) {
+      if (table->iaType[iEqn] == 0) {
+        *(table->pdVar[iRow]) = table->daDerivProc[iEqn];
+      } else {
+        /* Update the parameter in the BODY struct! Be careful! */
+        *(table->pdVar[iRow]) += iDir * table->daDerivProc[iEqn] * (*dDt);
       }
     }
   }
 }
 
+/* Sum the temporary derivatives of each row into the substep's arrays. If
+   bSkipExplicit is set, rows that are explicit functions of age are left
+   untouched. */
+void RungeKutta4Substep(CONTROL *control, int iSubStep, int iDir,
+                        int bSkipExplicit) {
+  EVOLVE *evolve     = &(control->Evolve);
+  UPDATETABLE *table = &control->UpdateTable;
+  double *daTmpDerivProc = control->TmpUpdateTable.daDerivProc;
+  double *daDeriv        = evolve->daStepDeriv[iSubStep];
+  double *daDerivProc    = evolve->daStepDerivProc[iSubStep];
+  int iRow, iEqn, iType;
+  double dDerivVar;
+
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    iType = table->iaType[table->iaRowStart[iRow]];
+    if (bSkipExplicit && (iType == 0 || iType == 3 || iType == 10)) {
+      continue;
+    }
+    dDerivVar = 0;
+    for (iEqn = table->iaRowStart[iRow]; iEqn < table->iaRowStart[iRow + 1];
+         iEqn++) {
+      dDerivVar += iDir * daTmpDerivProc[iEqn];
+      daDerivProc[iEqn] = daTmpDerivProc[iEqn];
+    }
+    daDeriv[iRow] = dDerivVar;
+  }
+}
+
+/* Move the temporary primary variables to the point dFrac * dDt along the
+   step, using the derivatives of substep iSubStep. */
+void RungeKutta4Advance(CONTROL *control, int iSubStep, double dFrac,
+                        double dDt) {
+  UPDATETABLE *table = &control->UpdateTable;
+  double **pdTmpVar  = control->TmpUpdateTable.pdVar;
+  double *daDeriv    = control->Evolve.daStepDeriv[iSubStep];
+  int iRow, iType;
+
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    iType = table->iaType[table->iaRowStart[iRow]];
+    if (iType == 0 || iType == 3 || iType == 10) {
+      // LUGER: Note that this is the VALUE of the variable getting passed,
+      // contrary to what the names suggest These values are updated in the
+      // tmpUpdate struct so that equations which are dependent upon them will
+      // be evaluated with higher accuracy
+      *(pdTmpVar[iRow]) = daDeriv[iRow];
+    } else {
+      *(pdTmpVar[iRow]) = *(table->pdVar[iRow]) + dFrac * dDt * daDeriv[iRow];
+    }
+  }
+}
+
 void RungeKutta4Step(BODY *body, CONTROL *control, SYSTEM *system,
                      UPDATE *update, fnUpdateVariable ***fnUpdate, double *dDt,
                      int iDir) {
   /* Compute and apply a 4th order Runge-Kutta update step a given parameter. */
-  int iBody, iVar, iEqn, iSubStep, iNumBodies, iNumVars, iNumEqns;
-  double dFoo, dDelta;
+  int iRow, iEqn, iType;
+  UPDATETABLE *table = &control->UpdateTable;
 
   EVOLVE *evolve = &(
         control->Evolve); // Save Evolve as a variable for speed and legibility
@@ -406,51 +603,18 @@ void RungeKutta4Step(BODY *body, CONTROL *control, SYSTEM *system,
     /*  This is minimum dynamical timescale */
     *dDt = AssignDt(*dDt, (control->Io.dNextOutput - evolve->dTime),
                     evolve->dEta);
+    if (evolve->iLimitRow >= 0) {
+      table->iaLimitCount[evolve->iLimitRow]++;
+    }
   } else {
     *dDt = evolve->dTimeStep;
   }
 
   evolve->dCurrentDt = *dDt;
-  iNumBodies         = evolve->iNumBodies;
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    // int thread_num = omp_get_thread_num();
-    // int cpu_num = sched_getcpu();
-    // printf("Thread %3d is running on CPU %3d\n", thread_num, cpu_num);
-    double daDerivVar;
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      iNumEqns   = update[iBody].iNumEqns[iVar];
-      for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-        daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-        evolve->daDerivProc[0][iBody][iVar][iEqn] =
-              evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-      }
-      evolve->daDeriv[0][iBody][iVar] = daDerivVar;
-    }
-  }
 
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest These values are updated in the
-        // tmpUpdate struct so that equations which are dependent upon them will
-        // be evaluated with higher accuracy
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              evolve->daDeriv[0][iBody][iVar];
-      } else {
-        /* While we're in this loop, move each parameter to the midpoint of the
-         * timestep */
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              *(update[iBody].pdVar[iVar]) +
-              0.5 * (*dDt) * evolve->daDeriv[0][iBody][iVar];
-      }
-    }
-  }
+  /* While we're at it, move each parameter to the midpoint of the timestep */
+  RungeKutta4Substep(control, 0, iDir, 0);
+  RungeKutta4Advance(control, 0, 0.5, *dDt);
 
   /* First midpoint derivative.*/
   PropertiesAuxiliary(evolve->tmpBody, control, system, update);
@@ -458,43 +622,10 @@ void RungeKutta4Step(BODY *body, CONTROL *control, SYSTEM *system,
   fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
                   fnUpdate);
 
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    double daDerivVar;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      iNumEqns   = update[iBody].iNumEqns[iVar];
-      for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-        daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-        evolve->daDerivProc[1][iBody][iVar][iEqn] =
-              evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-      }
-      evolve->daDeriv[1][iBody][iVar] = daDerivVar;
-    }
-  }
-
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest These values are updated in the
-        // tmpUpdate struct so that equations which are dependent upon them will
-        // be evaluated with higher accuracy
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              evolve->daDeriv[1][iBody][iVar];
-      } else {
-        /* While we're in this loop, move each parameter to the midpoint
-        of the timestep based on the midpoint derivative. */
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              *(update[iBody].pdVar[iVar]) +
-              0.5 * (*dDt) * evolve->daDeriv[1][iBody][iVar];
-      }
-    }
-  }
+  /* Move each parameter to the midpoint of the timestep based on the
+     midpoint derivative. */
+  RungeKutta4Substep(control, 1, iDir, 0);
+  RungeKutta4Advance(control, 1, 0.5, *dDt);
 
   /* Second midpoint derivative */
   PropertiesAuxiliary(evolve->tmpBody, control, system, update);
@@ -502,43 +633,10 @@ void RungeKutta4Step(BODY *body, CONTROL *control, SYSTEM *system,
   fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
                   fnUpdate);
 
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    double daDerivVar;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      iNumEqns   = update[iBody].iNumEqns[iVar];
-      for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-        daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-        evolve->daDerivProc[2][iBody][iVar][iEqn] =
-              evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-      }
-      evolve->daDeriv[2][iBody][iVar] = daDerivVar;
-    }
-  }
-
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest These values are updated in the
-        // tmpUpdate struct so that equations which are dependent upon them will
-        // be evaluated with higher accuracy
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              evolve->daDeriv[2][iBody][iVar];
-      } else {
-        /* While we're in this loop, move each parameter to the end of
-        the timestep based on the second midpoint derivative. */
-        *(evolve->tmpUpdate[iBody].pdVar[iVar]) =
-              *(update[iBody].pdVar[iVar]) +
-              *dDt * evolve->daDeriv[2][iBody][iVar];
-      }
-    }
-  }
+  /* Move each parameter to the end of the timestep based on the second
+     midpoint derivative. */
+  RungeKutta4Substep(control, 2, iDir, 0);
+  RungeKutta4Advance(control, 2, 1, *dDt);
 
   /* Full step derivative */
   PropertiesAuxiliary(evolve->tmpBody, control, system, update);
@@ -546,55 +644,31 @@ void RungeKutta4Step(BODY *body, CONTROL *control, SYSTEM *system,
   fdGetUpdateInfo(evolve->tmpBody, control, system, evolve->tmpUpdate,
                   fnUpdate);
 
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    double daDerivVar;
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      daDerivVar = 0;
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // NOTHING!
-      } else {
-        evolve->daDeriv[3][iBody][iVar] = 0;
-        iNumEqns                        = update[iBody].iNumEqns[iVar];
-        for (iEqn = 0; iEqn < iNumEqns; iEqn++) {
-          daDerivVar += iDir * evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-          evolve->daDerivProc[3][iBody][iVar][iEqn] =
-                evolve->tmpUpdate[iBody].daDerivProc[iVar][iEqn];
-        }
-        evolve->daDeriv[3][iBody][iVar] = daDerivVar;
-      }
-    }
-  }
+  RungeKutta4Substep(control, 3, iDir, 1);
+
   /* Now do the update -- Note the pointer to the home of the actual
    * variables!!! */
-  for (iBody = 0; iBody < iNumBodies; iBody++) {
-    iNumVars = update[iBody].iNumVars;
-    for (iVar = 0; iVar < iNumVars; iVar++) {
-      update[iBody].daDeriv[iVar] = 1. / 6 *
-                                    (evolve->daDeriv[0][iBody][iVar] +
-                                     2 * evolve->daDeriv[1][iBody][iVar] +
-                                     2 * evolve->daDeriv[2][iBody][iVar] +
-                                     evolve->daDeriv[3][iBody][iVar]);
-      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
-        update[iBody].daDerivProc[iVar][iEqn] =
-              1. / 6 *
-              (evolve->daDerivProc[0][iBody][iVar][iEqn] +
-               2 * evolve->daDerivProc[1][iBody][iVar][iEqn] +
-               2 * evolve->daDerivProc[2][iBody][iVar][iEqn] +
-               evolve->daDerivProc[3][iBody][iVar][iEqn]);
-      }
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    table->daDeriv[iRow] =
+          1. / 6 *
+          (evolve->daStepDeriv[0][iRow] + 2 * evolve->daStepDeriv[1][iRow] +
+           2 * evolve->daStepDeriv[2][iRow] + evolve->daStepDeriv[3][iRow]);
+    for (iEqn = table->iaRowStart[iRow]; iEqn < table->iaRowStart[iRow + 1];
+         iEqn++) {
+      table->daDerivProc[iEqn] = 1. / 6 *
+                                 (evolve->daStepDerivProc[0][iEqn] +
+                                  2 * evolve->daStepDerivProc[1][iEqn] +
+                                  2 * evolve->daStepDerivProc[2][iEqn] +
+                                  evolve->daStepDerivProc[3][iEqn]);
+    }
 
-      if (update[iBody].iaType[iVar][0] == 0 ||
-          update[iBody].iaType[iVar][0] == 3 ||
-          update[iBody].iaType[iVar][0] == 10) {
-        // LUGER: Note that this is the VALUE of the variable getting passed,
-        // contrary to what the names suggest
-        *(update[iBody].pdVar[iVar]) = evolve->daDeriv[0][iBody][iVar];
-      } else {
-        *(update[iBody].pdVar[iVar]) += update[iBody].daDeriv[iVar] * (*dDt);
-      }
+    iType = table->iaType[table->iaRowStart[iRow]];
+    if (iType == 0 || iType == 3 || iType == 10) {
+      // LUGER: Note that this is the VALUE of the variable getting passed,
+      // contrary to what the names suggest
+      *(table->pdVar[iRow]) = evolve->daStepDeriv[0][iRow];
+    } else {
+      *(table->pdVar[iRow]) += table->daDeriv[iRow] * (*dDt);
     }
   }
 }
@@ -714,5 +788,6 @@ void Evolve(BODY *body, CONTROL *control, FILES *files, MODULE *module,
   if (control->Io.iVerbose >= VERBPROG) {
     printf("Evolution completed.\n");
   }
+  ReportTimeStepLimits(body, control, update);
   //     printf("%d\n",body[1].iBadImpulse);
 }
@@ -16,11 +16,38 @@
 
 /* @cond DOXYGEN_OVERRIDE */
 
+void PropsAuxGeneral(BODY *, CONTROL *);
 void PropertiesAuxiliary(BODY *, CONTROL *, SYSTEM *, UPDATE *);
 void fdGetUpdateInfo(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                      fnUpdateVariable ***);
+double fdTimeStepExplicit(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int,
+                          double);
+double fdTimeStepSinusoidal(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int,
+                            double);
+double fdTimeStepDerived(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int,
+                         double);
+double fdTimeStepOutput(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int,
+                        double);
+double fdTimeStepRates(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int,
+                       double);
+double fdTimeStepPolar(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int, int,
+                       double);
+double fdTimeStepPolarObl(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int, int,
+                          double);
+double fdTimeStepPolarEcc(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int, int,
+                          double);
+double fdTimeStepIce(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int, int,
+                     double);
+double fdTimeStepOrbit(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int, int,
+                       double);
+double fdTimeStepRate(BODY *, CONTROL *, SYSTEM *, UPDATETABLE *, int, int,
+                      double);
+void CheckProgress(BODY *, CONTROL *, SYSTEM *, UPDATE *);
+double AssignDt(double, double, double);
+void InitializeTimeStep(CONTROL *, UPDATE *);
 double fdGetTimeStep(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                      fnUpdateVariable ***);
+void ReportTimeStepLimits(BODY *, CONTROL *, UPDATE *);
 void CalculateDerivatives(BODY *, SYSTEM *, UPDATE *, fnUpdateVariable ***,
                           int);
 
@@ -30,6 +57,8 @@ void Evolve(BODY *, CONTROL *, FILES *, MODULE *, OUTPUT *, SYSTEM *, UPDATE *,
 void EulerStep(BODY *, CONTROL *, SYSTEM *, UPDATE *, fnUpdateVariable ***,
                double *, int);
 
+void RungeKutta4Substep(CONTROL *, int, int, int);
+void RungeKutta4Advance(CONTROL *, int, double, double);
 void RungeKutta4Step(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                      fnUpdateVariable ***, double *, int);
 
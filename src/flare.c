@@ -922,15 +922,33 @@ void InitializeBodyFlare(BODY *body, CONTROL *control, UPDATE *update,
                          int iBody, int iModule) {
   // double *daEnergyERGXUV, *daLXUVFlare, *daFFD, *daEnergyJOUXUV, *daLogEner;
   // double *daLogEnerXUV, *daEnergyERG, *daEnergyJOU, *daEnerJOU;
-  body[iBody].daEnergyERGXUV = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daLXUVFlare    = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daEnergyJOUXUV = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daFFD          = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daLogEner      = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daLogEnerXUV   = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daEnergyERG    = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daEnergyJOU    = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
-  body[iBody].daEnerJOU      = malloc((body[iBody].iEnergyBin+1) * sizeof(double));
+  body[iBody].daEnergyERGXUV =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daLXUVFlare =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daEnergyJOUXUV =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daFFD =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daLogEner =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daLogEnerXUV =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daEnergyERG =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daEnergyJOU =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
+  body[iBody].daEnerJOU =
+        ArenaAlloc(&control->Arena,
+                   (body[iBody].iEnergyBin + 1) * sizeof(double));
 
   body[iBody].dLXUVFlare = fdLXUVFlare(body, control->Evolve.dTimeStep, iBody);
 }
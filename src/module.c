@@ -916,6 +916,10 @@ void InitializeBodyModules(BODY **body, int iNumBodies) {
     (*body)[iBody].bThermint = 0;
     (*body)[iBody].bSpiNBody = 0;
     (*body)[iBody].bMagmOc   = 0;
+
+    (*body)[iBody].StarMemo.dHZRG14Temperature = NAN;
+    (*body)[iBody].StarMemo.dBondiTemperature  = NAN;
+    (*body)[iBody].StarMemo.dBondiRadius       = NAN;
   }
 }
 
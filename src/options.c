@@ -4657,6 +4657,25 @@ void InitializeOptionsGeneral(OPTIONS *options, fnReadOption fnRead[]) {
 */
 }
 
+/**
+Forget where the options were found, so that the same OPTIONS array can be
+used to read another set of input files in the same process (see
+ensemble.c).
+
+@param options OPTIONS array set up by InitializeOptions
+*/
+void ResetOptionLocations(OPTIONS *options) {
+  int iOpt, iFile;
+
+  for (iOpt = 0; iOpt < MODULEOPTEND; iOpt++) {
+    for (iFile = 0; iFile < MAXFILES; iFile++) {
+      options[iOpt].iLine[iFile] = -1;
+      memset(options[iOpt].cFile[iFile], '\0', OPTLEN);
+      sprintf(options[iOpt].cFile[iFile], "null");
+    }
+  }
+}
+
 void InitializeOptions(OPTIONS *options, fnReadOption *fnRead) {
   int iBody, iOpt, iFile, iModule;
 
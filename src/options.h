@@ -122,6 +122,7 @@
 void GetWords(char cLine[], char[MAXARRAY][OPTLEN], int *, int *);
 
 void InitializeOptions(OPTIONS *, fnReadOption *);
+void ResetOptionLocations(OPTIONS *);
 void ReadOptions(BODY **, CONTROL *, FILES *, MODULE *, OPTIONS *, OUTPUT *,
                  SYSTEM *, UPDATE **, fnReadOption *, char[]);
 
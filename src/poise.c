@@ -19,24 +19,16 @@ void BodyCopyPoise(BODY *dest, BODY *src, int iTideModel, int iNumBodies,
 void InitializeUpdateTmpBodyPoise(BODY *body, CONTROL *control, UPDATE *update,
                                   int iBody) {
   if (body[iBody].bReadOrbitOblData) {
-    int iLine;
-
-    control->Evolve.tmpBody[iBody].daSemiSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
-    control->Evolve.tmpBody[iBody].daHeccSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
-    control->Evolve.tmpBody[iBody].daKeccSeries =
-          malloc(body[iBody].iNLines * sizeof(double));
-
-
-    for (iLine = 0; iLine < body[iBody].iNLines; iLine++) {
-      control->Evolve.tmpBody[iBody].daSemiSeries[iLine] =
-            body[iBody].daSemiSeries[iLine];
-      control->Evolve.tmpBody[iBody].daHeccSeries[iLine] =
-            body[iBody].daHeccSeries[iLine];
-      control->Evolve.tmpBody[iBody].daKeccSeries[iLine] =
-            body[iBody].daKeccSeries[iLine];
-    }
+    /* The series are never written, and may be mapped from the file, so
+       the copies share them */
+    control->Evolve.tmpBody[iBody].iNLines       = body[iBody].iNLines;
+    control->Evolve.tmpBody[iBody].daTimeSeries  = body[iBody].daTimeSeries;
+    control->Evolve.tmpBody[iBody].daSemiSeries  = body[iBody].daSemiSeries;
+    control->Evolve.tmpBody[iBody].daEccSeries   = body[iBody].daEccSeries;
+    control->Evolve.tmpBody[iBody].daArgPSeries  = body[iBody].daArgPSeries;
+    control->Evolve.tmpBody[iBody].daLongASeries = body[iBody].daLongASeries;
+    control->Evolve.tmpBody[iBody].daOblSeries   = body[iBody].daOblSeries;
+    control->Evolve.tmpBody[iBody].daPrecASeries = body[iBody].daPrecASeries;
   }
 }
 
@@ -586,6 +578,39 @@ void ReadOLRModel(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   }
 }
 
+void ReadAnnualSolver(BODY *body, CONTROL *control, FILES *files,
+                      OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter can exist in any file, but only once */
+  int lTmp = -1;
+  char cTmp[OPTLEN];
+
+  /* Equilibrium solver for the annual model, use #defined variables */
+
+  AddOptionString(files->Infile[iFile].cIn, options->cName, cTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    if (!memcmp(sLower(cTmp), "rel", 3)) {
+      body[iFile - 1].iAnnualSolver = ANNRELAX;
+    } else if (!memcmp(sLower(cTmp), "and", 3)) {
+      body[iFile - 1].iAnnualSolver = ANNANDERSON;
+    } else {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr,
+                "ERROR: Unknown argument to %s: %s."
+                " Options are relax or anderson.\n",
+                options->cName, cTmp);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &body[iFile - 1].iAnnualSolver,
+                     files->iNumInputs);
+  }
+}
+
 void ReadGeography(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                    SYSTEM *system, int iFile) {
   /* This parameter can exist in any file, but only once */
@@ -992,6 +1017,58 @@ void ReadRefHeight(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   }
 }
 
+void ReadInsolTol(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
+                 SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    if (dTmp < 0) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be >= 0.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    body[iFile - 1].dInsolTol = dTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    if (iFile > 0) {
+      body[iFile - 1].dInsolTol = options->dDefault;
+    }
+  }
+}
+
+void ReadSeasPeriodTol(BODY *body, CONTROL *control, FILES *files,
+                       OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    if (dTmp < 0) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be >= 0.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    body[iFile - 1].dSeasPeriodTol = dTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    if (iFile > 0) {
+      body[iFile - 1].dSeasPeriodTol = options->dDefault;
+    }
+  }
+}
+
 void ReadSpinUpTol(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                    SYSTEM *system, int iFile) {
   /* This parameter cannot exist in primary file */
@@ -1064,6 +1141,67 @@ void ReadNumYears(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
   }
 }
 
+void ReadRadTables(BODY *body, CONTROL *control, FILES *files,
+                   OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1, bTmp;
+
+  AddOptionBool(files->Infile[iFile].cIn, options->cName, &bTmp, &lTmp,
+                control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    body[iFile - 1].bRadTables = bTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &body[iFile - 1].bRadTables, files->iNumInputs);
+  }
+}
+
+void ReadRadTableTemps(BODY *body, CONTROL *control, FILES *files,
+                       OPTIONS *options, SYSTEM *system, int iFile) {
+  int lTmp = -1, iTmp;
+  AddOptionInt(files->Infile[iFile].cIn, options->cName, &iTmp, &lTmp,
+               control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    if (iTmp < 1) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be >= 1.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    body[iFile - 1].iRadTableTemps = iTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &body[iFile - 1].iRadTableTemps,
+                     files->iNumInputs);
+  }
+}
+
+void ReadRadTableZeniths(BODY *body, CONTROL *control, FILES *files,
+                         OPTIONS *options, SYSTEM *system, int iFile) {
+  int lTmp = -1, iTmp;
+  AddOptionInt(files->Infile[iFile].cIn, options->cName, &iTmp, &lTmp,
+               control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    if (iTmp < 1) {
+      if (control->Io.iVerbose >= VERBERR) {
+        fprintf(stderr, "ERROR: %s must be >= 1.\n", options->cName);
+      }
+      LineExit(files->Infile[iFile].cIn, lTmp);
+    }
+    body[iFile - 1].iRadTableZeniths = iTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    AssignDefaultInt(options, &body[iFile - 1].iRadTableZeniths,
+                     files->iNumInputs);
+  }
+}
+
 void ReadIceDt(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
                SYSTEM *system, int iFile) {
   int lTmp = -1, iTmp;
@@ -1123,6 +1261,33 @@ void ReadMinIceSheetHeight(BODY *body, CONTROL *control, FILES *files,
   }
 }
 
+void ReadIceHeightTol(BODY *body, CONTROL *control, FILES *files,
+                      OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    if (dTmp < 0) {
+      body[iFile - 1].dIceHeightTol =
+            dTmp * dNegativeDouble(*options, files->Infile[iFile].cIn,
+                                   control->Io.iVerbose);
+    } else {
+      body[iFile - 1].dIceHeightTol =
+            dTmp * fdUnitsLength(control->Units[iFile].iLength);
+    }
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else {
+    if (iFile > 0) {
+      body[iFile - 1].dIceHeightTol = options->dDefault;
+    }
+  }
+}
+
 void InitializeOptionsPoise(OPTIONS *options, fnReadOption fnRead[]) {
   sprintf(options[OPT_LATCELLNUM].cName, "iLatCellNum");
   sprintf(options[OPT_LATCELLNUM].cDescr, "Number of latitude cells used in"
@@ -1148,6 +1313,16 @@ void InitializeOptionsPoise(OPTIONS *options, fnReadOption fnRead[]) {
   sprintf(options[OPT_FILEORBITOBLDATA].cDefault, "Obl_data.txt");
   options[OPT_FILEORBITOBLDATA].iType = 3;
   fnRead[OPT_FILEORBITOBLDATA]        = &ReadFileOrbitOblData;
+  sprintf(options[OPT_FILEORBITOBLDATA].cLongDescr,
+          "Each row holds the time, semi-major axis, eccentricity, argument\n"
+          "of pericenter, longitude of the ascending node, obliquity and\n"
+          "precession angle. Text files list them in the body's units, one\n"
+          "row per line. Binary files start with \"VPLORBOB\" and the int32\n"
+          "values 1 and the number of rows, followed by each column in turn\n"
+          "as doubles in SI units and radians; they are memory-mapped, so\n"
+          "even very long series load at once. The data are interpolated\n"
+          "linearly in time and must span the whole integration; backward\n"
+          "integrations run through negative times.\n");
 
   sprintf(options[OPT_PLANCKA].cName, "dPlanckA");
   sprintf(options[OPT_PLANCKA].cDescr, "Constant 'A' used in OLR calculation");
@@ -1329,6 +1504,22 @@ void InitializeOptionsPoise(OPTIONS *options, fnReadOption fnRead[]) {
   options[OPT_OLRMODEL].bMultiFile = 1;
   fnRead[OPT_OLRMODEL]             = &ReadOLRModel;
 
+  sprintf(options[OPT_ANNUALSOLVER].cName, "sAnnualSolver");
+  sprintf(options[OPT_ANNUALSOLVER].cDescr,
+          "Equilibrium solver for the annual model: relax or anderson");
+  sprintf(options[OPT_ANNUALSOLVER].cDefault, "relax");
+  options[OPT_ANNUALSOLVER].dDefault   = ANNRELAX;
+  options[OPT_ANNUALSOLVER].iType      = 3;
+  options[OPT_ANNUALSOLVER].bMultiFile = 1;
+  fnRead[OPT_ANNUALSOLVER]             = &ReadAnnualSolver;
+  sprintf(options[OPT_ANNUALSOLVER].cLongDescr,
+          "By default the annual model relaxes to equilibrium by marching in\n"
+          "pseudo-time, which can take thousands of steps near an ice-albedo\n"
+          "bifurcation. With anderson, the same step is used as a fixed-point\n"
+          "map and accelerated with Anderson mixing, starting from the\n"
+          "previous equilibrium. If that fails to converge, the model falls\n"
+          "back to relaxation.\n");
+
   sprintf(options[OPT_SKIPSEASENABLED].cName, "bSkipSeasEnabled");
   sprintf(options[OPT_SKIPSEASENABLED].cDescr, "Run annual before seasonal and"
                                                " allow skip seas?");
@@ -1609,6 +1800,101 @@ void InitializeOptionsPoise(OPTIONS *options, fnReadOption fnRead[]) {
   options[OPT_SPINUPTOL].bMultiFile = 1;
   fnRead[OPT_SPINUPTOL]             = &ReadSpinUpTol;
 
+  sprintf(options[OPT_SEASPERIODTOL].cName, "dSeasPeriodTol");
+  sprintf(options[OPT_SEASPERIODTOL].cDescr,
+          "Year-over-year change that ends the seasonal model early");
+  sprintf(options[OPT_SEASPERIODTOL].cDefault, "0 deg C");
+  sprintf(options[OPT_SEASPERIODTOL].cDimension, "temperature");
+  options[OPT_SEASPERIODTOL].dDefault   = 0;
+  options[OPT_SEASPERIODTOL].iType      = 2;
+  options[OPT_SEASPERIODTOL].bMultiFile = 1;
+  fnRead[OPT_SEASPERIODTOL]             = &ReadSeasPeriodTol;
+  sprintf(options[OPT_SEASPERIODTOL].cLongDescr,
+          "When positive, the seasonal model stops before iNumYears orbits\n"
+          "once its cycle is periodic: no temperature at any latitude and\n"
+          "step differs from the previous orbit by more than this, and no\n"
+          "ice balance differs by more than would warm the land by this much\n"
+          "in one step. The remaining orbits are taken to repeat the last\n"
+          "one. The output SeasYears reports how many orbits were run.\n");
+
+  sprintf(options[OPT_RADTABLES].cName, "bRadTables");
+  sprintf(options[OPT_RADTABLES].cDescr,
+          "Interpolate OLR and TOA albedo fits from tables (with bCalcAB)?");
+  sprintf(options[OPT_RADTABLES].cDefault, "0");
+  sprintf(options[OPT_RADTABLES].cDimension, "nd");
+  options[OPT_RADTABLES].dDefault   = 0;
+  options[OPT_RADTABLES].iType      = 0;
+  options[OPT_RADTABLES].bMultiFile = 1;
+  fnRead[OPT_RADTABLES]             = &ReadRadTables;
+  sprintf(options[OPT_RADTABLES].cLongDescr,
+          "When set, with iOLRModel wk97 or hm16, the fits to the OLR, its\n"
+          "slope and the top-of-atmosphere albedo are tabulated at startup\n"
+          "for the body's pCO2, and then interpolated with cubic\n"
+          "(Catmull-Rom) splines. Temperatures outside the tables (150-400 K\n"
+          "for the OLR) fall back to the fits themselves. The resolution is\n"
+          "set by iRadTableTemps and iRadTableZeniths; with the defaults the\n"
+          "relative error of the OLR is near 1e-7 and the albedo is within\n"
+          "1e-5 of the fit, except over open ocean within a few degrees of\n"
+          "the terminator, where the kink of its zenith-angle dependence\n"
+          "leaves errors near 1e-3. The sms09 model has closed forms that\n"
+          "are cheaper than the tables.\n");
+
+  sprintf(options[OPT_RADTABLETEMPS].cName, "iRadTableTemps");
+  sprintf(options[OPT_RADTABLETEMPS].cDescr,
+          "Temperature intervals of each OLR and TOA albedo table");
+  sprintf(options[OPT_RADTABLETEMPS].cDefault, "250");
+  sprintf(options[OPT_RADTABLETEMPS].cDimension, "nd");
+  options[OPT_RADTABLETEMPS].dDefault   = 250;
+  options[OPT_RADTABLETEMPS].iType      = 1;
+  options[OPT_RADTABLETEMPS].bMultiFile = 1;
+  fnRead[OPT_RADTABLETEMPS]             = &ReadRadTableTemps;
+
+  sprintf(options[OPT_RADTABLEZENITHS].cName, "iRadTableZeniths");
+  sprintf(options[OPT_RADTABLEZENITHS].cDescr,
+          "Zenith angle intervals (over 0-180 degrees) of the TOA albedo "
+          "tables");
+  sprintf(options[OPT_RADTABLEZENITHS].cDefault, "90");
+  sprintf(options[OPT_RADTABLEZENITHS].cDimension, "nd");
+  options[OPT_RADTABLEZENITHS].dDefault   = 90;
+  options[OPT_RADTABLEZENITHS].iType      = 1;
+  options[OPT_RADTABLEZENITHS].bMultiFile = 1;
+  fnRead[OPT_RADTABLEZENITHS]             = &ReadRadTableZeniths;
+
+  sprintf(options[OPT_ICEHEIGHTTOL].cName, "dIceHeightTol");
+  sprintf(options[OPT_ICEHEIGHTTOL].cDescr,
+          "Ice height error per step of the adaptive ice sheet model");
+  sprintf(options[OPT_ICEHEIGHTTOL].cDefault, "0");
+  sprintf(options[OPT_ICEHEIGHTTOL].cDimension, "length");
+  options[OPT_ICEHEIGHTTOL].dDefault   = 0;
+  options[OPT_ICEHEIGHTTOL].iType      = 2;
+  options[OPT_ICEHEIGHTTOL].bMultiFile = 1;
+  options[OPT_ICEHEIGHTTOL].dNeg       = 1; // Convert to SI
+  sprintf(options[OPT_ICEHEIGHTTOL].cNeg, "meters");
+  fnRead[OPT_ICEHEIGHTTOL] = &ReadIceHeightTol;
+  sprintf(options[OPT_ICEHEIGHTTOL].cLongDescr,
+          "When positive, the ice sheet model picks its own step instead of\n"
+          "iIceDt orbits: each step is compared with two steps of half the\n"
+          "length, and is shortened until no ice height differs by more than\n"
+          "this. The step then grows again as the ice allows. The first step\n"
+          "is iIceDt orbits long.\n");
+
+  sprintf(options[OPT_INSOLTOL].cName, "dInsolTol");
+  sprintf(options[OPT_INSOLTOL].cDescr,
+          "Change in orbit or obliquity that recalculates insolation");
+  sprintf(options[OPT_INSOLTOL].cDefault, "0");
+  sprintf(options[OPT_INSOLTOL].cDimension, "nd");
+  options[OPT_INSOLTOL].dDefault   = 0;
+  options[OPT_INSOLTOL].iType      = 2;
+  options[OPT_INSOLTOL].bMultiFile = 1;
+  fnRead[OPT_INSOLTOL]             = &ReadInsolTol;
+  sprintf(options[OPT_INSOLTOL].cLongDescr,
+          "The daily insolation is reused until the luminosity, semi-major\n"
+          "axis, eccentricity, longitude of pericenter plus precession angle\n"
+          "or obliquity changes by more than this fraction of its value (or\n"
+          "by this much, for values smaller than one, such as angles in\n"
+          "radians). The default of 0 recalculates it whenever any of them\n"
+          "changes at all.\n");
+
   sprintf(options[OPT_MINICEHEIGHT].cName, "dMinIceSheetHeight");
   sprintf(options[OPT_MINICEHEIGHT].cDescr, "Minimum ice sheet height for a"
                                             " latitude to be considered"
@@ -1781,12 +2067,168 @@ void VerifyOLR(BODY *body, OPTIONS *options, char cFile[], int iBody,
       // LCOV_EXCL_STOP
     }
   }
+
+  if (body[iBody].bRadTables && body[iBody].iOLRModel == SMS09) {
+    /* Its OLR and albedo are closed forms, cheaper than interpolating */
+    if (iVerbose >= VERBINPUT) {
+      fprintf(stderr,
+              "WARNING: %s = 1 has no effect with %s = sms09 in File: %s. "
+              "The fits are evaluated directly.\n",
+              options[OPT_RADTABLES].cName, options[OPT_OLRMODEL].cName,
+              cFile);
+    }
+    body[iBody].bRadTables = 0;
+  }
 }
 
-void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
+/**
+Reads a text orbit and obliquity file. Each line holds the time, semi-major
+axis, eccentricity, argument of pericenter, longitude of the ascending node,
+obliquity and precession angle, in the units of the body's input file.
+
+@param body Struct containing all body information and variables
+@param control Struct containing control information
+@param fileorb Open forcing file
+@param iBody Body in question
+*/
+void fvReadOrbitOblText(BODY *body, CONTROL *control, FILE *fileorb,
                         int iBody) {
   int iNLines, iLine, c;
-  double dttmp, datmp, detmp, ditmp, daptmp, dlatmp, dmatmp, dobltmp, dprecatmp;
+  double dttmp, datmp, detmp, daptmp, dlatmp, dobltmp, dprecatmp;
+
+  iNLines = 0;
+  while ((c = getc(fileorb)) != EOF) {
+    if (c == '\n')
+      iNLines++; // add 1 for each new line
+  }
+  rewind(fileorb);
+
+  body[iBody].iNLines       = iNLines;
+  body[iBody].daTimeSeries  = malloc(iNLines * sizeof(double));
+  body[iBody].daSemiSeries  = malloc(iNLines * sizeof(double));
+  body[iBody].daEccSeries   = malloc(iNLines * sizeof(double));
+  body[iBody].daArgPSeries  = malloc(iNLines * sizeof(double));
+  body[iBody].daLongASeries = malloc(iNLines * sizeof(double));
+  body[iBody].daOblSeries   = malloc(iNLines * sizeof(double));
+  body[iBody].daPrecASeries = malloc(iNLines * sizeof(double));
+
+  for (iLine = 0; iLine < iNLines; iLine++) {
+    if (fscanf(fileorb, "%lf %lf %lf %lf %lf %lf %lf", &dttmp, &datmp, &detmp,
+               &daptmp, &dlatmp, &dobltmp, &dprecatmp) != 7) {
+      fprintf(stderr, "ERROR: Incorrect number of columns in line %d of "
+                      "orbit-obliquity file %s.\n",
+              iLine + 1, body[iBody].cFileOrbitOblData);
+      exit(EXIT_INPUT);
+    }
+
+    body[iBody].daTimeSeries[iLine] =
+          dttmp * fdUnitsTime(control->Units[iBody + 1].iTime);
+    body[iBody].daSemiSeries[iLine] =
+          datmp * fdUnitsLength(control->Units[iBody + 1].iLength);
+    body[iBody].daEccSeries[iLine] = detmp;
+
+    if (control->Units[iBody + 1].iAngle == 0) {
+      body[iBody].daArgPSeries[iLine]  = daptmp;
+      body[iBody].daLongASeries[iLine] = dlatmp;
+      body[iBody].daOblSeries[iLine]   = dobltmp;
+      body[iBody].daPrecASeries[iLine] = dprecatmp;
+    } else {
+      body[iBody].daArgPSeries[iLine]  = daptmp * DEGRAD;
+      body[iBody].daLongASeries[iLine] = dlatmp * DEGRAD;
+      body[iBody].daOblSeries[iLine]   = dobltmp * DEGRAD;
+      body[iBody].daPrecASeries[iLine] = dprecatmp * DEGRAD;
+    }
+  }
+}
+
+/**
+Maps a binary orbit and obliquity file. The file starts with the 8
+characters "VPLORBOB", followed by int32 values for the format version (1)
+and the number of rows. Then come ORBOBLCOLS blocks of that many doubles:
+the times [s], semi-major axes [m], eccentricities, arguments of pericenter,
+longitudes of the ascending node, obliquities and precession angles [rad].
+The series point straight into the file, which on POSIX systems is mapped
+read-only, so only the pages the integration reaches are ever read.
+
+@param body Struct containing all body information and variables
+@param fileorb Open forcing file
+@param iBody Body in question
+*/
+void fvMapOrbitOblData(BODY *body, FILE *fileorb, int iBody) {
+  char *cData;
+  int32_t iaHeader[2];
+  long iSize;
+  double *daCol;
+
+  fseek(fileorb, 0, SEEK_END);
+  iSize = ftell(fileorb);
+  fseek(fileorb, 0, SEEK_SET);
+  if (iSize < ORBOBLHEADER) {
+    fprintf(stderr,
+            "ERROR: Orbit-obliquity file %s is inconsistent: %ld bytes are "
+            "shorter than its %d byte header.\n",
+            body[iBody].cFileOrbitOblData, iSize, ORBOBLHEADER);
+    exit(EXIT_INPUT);
+  }
+
+#ifdef VPLANET_ON_WINDOWS
+  cData = malloc(iSize);
+  if (cData == NULL || fread(cData, 1, iSize, fileorb) != (size_t)iSize) {
+    fprintf(stderr, "ERROR: Unable to read orbit-obliquity file %s.\n",
+            body[iBody].cFileOrbitOblData);
+    exit(EXIT_INPUT);
+  }
+#else
+  cData = mmap(NULL, iSize, PROT_READ, MAP_SHARED, fileno(fileorb), 0);
+  if (cData == MAP_FAILED) {
+    fprintf(stderr, "ERROR: Unable to map orbit-obliquity file %s.\n",
+            body[iBody].cFileOrbitOblData);
+    exit(EXIT_INPUT);
+  }
+#endif
+
+  memcpy(iaHeader, cData + strlen(ORBOBLMAGIC), sizeof(iaHeader));
+  if (iaHeader[0] != 1 || iaHeader[1] < 2 ||
+      (size_t)iSize != ORBOBLHEADER + (size_t)ORBOBLCOLS * iaHeader[1] *
+                                            sizeof(double)) {
+    fprintf(stderr,
+            "ERROR: Orbit-obliquity file %s is inconsistent: version %d, %d "
+            "rows, %ld bytes.\n",
+            body[iBody].cFileOrbitOblData, iaHeader[0], iaHeader[1], iSize);
+    exit(EXIT_INPUT);
+  }
+
+  body[iBody].iNLines       = iaHeader[1];
+  daCol                     = (double *)(cData + ORBOBLHEADER);
+  body[iBody].daTimeSeries  = daCol;
+  body[iBody].daSemiSeries  = daCol + iaHeader[1];
+  body[iBody].daEccSeries   = daCol + 2 * iaHeader[1];
+  body[iBody].daArgPSeries  = daCol + 3 * iaHeader[1];
+  body[iBody].daLongASeries = daCol + 4 * iaHeader[1];
+  body[iBody].daOblSeries   = daCol + 5 * iaHeader[1];
+  body[iBody].daPrecASeries = daCol + 6 * iaHeader[1];
+}
+
+/**
+Time of the forcing series at a given time of the integration. Backward
+integrations run through the series towards negative times.
+
+@param evolve Struct containing evolution information
+@param dTime Time since the start of the integration
+@return Time in the forcing series
+*/
+double fdOrbitOblTime(EVOLVE *evolve, double dTime) {
+  if (evolve->bDoForward) {
+    return dTime;
+  }
+  return -dTime;
+}
+
+void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
+                        int iBody) {
+  char cMagic[sizeof(ORBOBLMAGIC)] = {0};
+  int iLine;
+  double dStart, dEnd, dFirst, dLast;
   FILE *fileorb;
 
   if (body[iBody].bReadOrbitOblData) {
@@ -1795,100 +2237,74 @@ void VerifyOrbitOblData(BODY *body, CONTROL *control, OPTIONS *options,
               options[OPT_FILEORBITOBLDATA].cName,
               options[OPT_READORBITOBLDATA].cName, body[iBody].cName);
       exit(EXIT_INPUT);
+    }
+    if (body[iBody].bDistOrb || body[iBody].bDistRot) {
+      fprintf(stderr,
+              "ERROR: Cannot set %s = 1 when using DistOrb or DistRot for "
+              "body %s.\n",
+              options[OPT_READORBITOBLDATA].cName, body[iBody].cName);
+      exit(EXIT_INPUT);
+    }
+    fileorb = fopen(body[iBody].cFileOrbitOblData, "rb");
+    if (fileorb == NULL) {
+      printf("ERROR: File %s not found.\n", body[iBody].cFileOrbitOblData);
+      exit(EXIT_INPUT);
+    }
+    if (fread(cMagic, 1, strlen(ORBOBLMAGIC), fileorb) ==
+              strlen(ORBOBLMAGIC) &&
+        !strcmp(cMagic, ORBOBLMAGIC)) {
+      fvMapOrbitOblData(body, fileorb, iBody);
     } else {
-      fileorb = fopen(body[iBody].cFileOrbitOblData, "r");
-      if (fileorb == NULL) {
-        printf("ERROR: File %s not found.\n", body[iBody].cFileOrbitOblData);
-        exit(EXIT_INPUT);
-      }
-      iNLines = 0;
-      while ((c = getc(fileorb)) != EOF) {
-        if (c == '\n')
-          iNLines++; // add 1 for each new line
-      }
       rewind(fileorb);
-
-      body[iBody].iNLines       = iNLines;
-      body[iBody].daTimeSeries  = malloc(iNLines * sizeof(double));
-      body[iBody].daSemiSeries  = malloc(iNLines * sizeof(double));
-      body[iBody].daEccSeries   = malloc(iNLines * sizeof(double));
-      body[iBody].daArgPSeries  = malloc(iNLines * sizeof(double));
-      body[iBody].daLongASeries = malloc(iNLines * sizeof(double));
-      body[iBody].daOblSeries   = malloc(iNLines * sizeof(double));
-      body[iBody].daPrecASeries = malloc(iNLines * sizeof(double));
-
-      body[iBody].daHeccSeries = malloc(iNLines * sizeof(double));
-      body[iBody].daKeccSeries = malloc(iNLines * sizeof(double));
-
-      printf("file open\n");
-
-      iLine = 0;
-      while (feof(fileorb) == 0) {
-        if (fscanf(fileorb, "%lf %lf %lf %lf %lf %lf %lf", &dttmp, &datmp, &detmp,
-              &daptmp, &dlatmp, &dobltmp, &dprecatmp) != 7) {
-                fprintf(stderr,"ERROR: Incorrect number of columns in orbit-obliquity file.");
-                exit(EXIT_INPUT);
-        }
-
-        body[iBody].daTimeSeries[iLine] =
-              dttmp * fdUnitsTime(control->Units[iBody + 1].iTime);
-        body[iBody].daSemiSeries[iLine] =
-              datmp * fdUnitsLength(control->Units[iBody + 1].iLength);
-        body[iBody].daEccSeries[iLine] = detmp;
-
-        if (control->Units[iBody + 1].iAngle == 0) {
-          body[iBody].daArgPSeries[iLine]  = daptmp;
-          body[iBody].daLongASeries[iLine] = dlatmp;
-          body[iBody].daOblSeries[iLine]   = dobltmp;
-          body[iBody].daPrecASeries[iLine] = dprecatmp;
-        } else {
-          body[iBody].daArgPSeries[iLine]  = daptmp * DEGRAD;
-          body[iBody].daLongASeries[iLine] = dlatmp * DEGRAD;
-          body[iBody].daOblSeries[iLine]   = dobltmp * DEGRAD;
-          body[iBody].daPrecASeries[iLine] = dprecatmp * DEGRAD;
-        }
-        body[iBody].daHeccSeries[iLine] = body[iBody].daEccSeries[iLine] *
-                                          sin(body[iBody].daArgPSeries[iLine] +
-                                              body[iBody].daLongASeries[iLine]);
-        body[iBody].daKeccSeries[iLine] = body[iBody].daEccSeries[iLine] *
-                                          cos(body[iBody].daArgPSeries[iLine] +
-                                              body[iBody].daLongASeries[iLine]);
-
-        iLine++;
-      }
-      fclose(fileorb);
+      fvReadOrbitOblText(body, control, fileorb, iBody);
     }
-    body[iBody].iCurrentStep = 0;
-    if (control->Evolve.bVarDt) {
-      fprintf(stderr,
-              "ERROR: Cannot use variable time step (%s = 1) if %s = 1\n",
-              options[OPT_VARDT].cName, options[OPT_READORBITDATA].cName);
+    fclose(fileorb);
+
+    if (body[iBody].iNLines < 2) {
+      fprintf(stderr, "ERROR: Orbit-obliquity file %s needs at least 2 rows.\n",
+              body[iBody].cFileOrbitOblData);
       exit(EXIT_INPUT);
     }
-    if (control->Evolve.bDoForward) {
-      if (body[iBody].daTimeSeries[1] != control->Evolve.dTimeStep) {
-        fprintf(stderr,
-                "ERROR: Time step size (%s = 1) must match orbital data if %s "
-                "= 1\n",
-                options[OPT_TIMESTEP].cName, options[OPT_READORBITDATA].cName);
-        exit(EXIT_INPUT);
-      }
-    } else if (control->Evolve.bDoBackward) {
-      if (body[iBody].daTimeSeries[1] != -1 * control->Evolve.dTimeStep) {
+    if (control->Io.iVerbose >= VERBINPUT) {
+      printf("INFO: Read %d rows of orbit and obliquity data from %s.\n",
+             body[iBody].iNLines, body[iBody].cFileOrbitOblData);
+    }
+
+    /* Only the time column is read here; the other series are only read as
+       the integration reaches them */
+    for (iLine = 1; iLine < body[iBody].iNLines; iLine++) {
+      if ((body[iBody].daTimeSeries[iLine] - body[iBody].daTimeSeries[0]) *
+                (body[iBody].daTimeSeries[iLine] -
+                 body[iBody].daTimeSeries[iLine - 1]) <=
+          0) {
         fprintf(stderr,
-                "ERROR: Time step size (%s = 1) must match orbital data if %s "
-                "= 1\n",
-                options[OPT_TIMESTEP].cName, options[OPT_READORBITDATA].cName);
+                "ERROR: Times in orbit-obliquity file %s are not monotonic "
+                "at row %d.\n",
+                body[iBody].cFileOrbitOblData, iLine + 1);
         exit(EXIT_INPUT);
       }
     }
-    if (iNLines < (control->Evolve.dStopTime / control->Evolve.dTimeStep + 1)) {
+
+    /* The data are interpolated in time, so any time step will do, but they
+       must cover the whole integration */
+    dStart = fdOrbitOblTime(&control->Evolve, 0);
+    dEnd   = fdOrbitOblTime(&control->Evolve, control->Evolve.dStopTime);
+    dFirst = body[iBody].daTimeSeries[0];
+    dLast  = body[iBody].daTimeSeries[body[iBody].iNLines - 1];
+    if (dFirst > dLast) {
+      dFirst = dLast;
+      dLast  = body[iBody].daTimeSeries[0];
+    }
+    if (dFirst > fmin(dStart, dEnd) || dLast < fmax(dStart, dEnd)) {
       fprintf(stderr,
               "ERROR: Input orbit data must at least as long as vplanet "
               "integration (%f years)\n",
               control->Evolve.dStopTime / YEARSEC);
       exit(EXIT_INPUT);
     }
+
+    body[iBody].iCurrentStep = 0;
+    fvOrbitOblAtTime(body, iBody, dStart);
   }
 }
 
@@ -1903,11 +2319,18 @@ void InitializeLatGrid(BODY *body, int iBody) {
   int iLats;
   dDelta_x = 2.0 / body[iBody].iNumLats;
 
-  body[iBody].daLats = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daLats    = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daSinLats = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daCosLats = malloc(body[iBody].iNumLats * sizeof(double));
+  body[iBody].daTanLats = malloc(body[iBody].iNumLats * sizeof(double));
 
   for (iLats = 0; iLats < body[iBody].iNumLats; iLats++) {
     SinLat                    = (-1.0 + dDelta_x / 2.) + iLats * dDelta_x;
     body[iBody].daLats[iLats] = asin(SinLat);
+    /* Kept for the insolation, which needs these every day */
+    body[iBody].daSinLats[iLats] = sin(body[iBody].daLats[iLats]);
+    body[iBody].daCosLats[iLats] = cos(body[iBody].daLats[iLats]);
+    body[iBody].daTanLats[iLats] = tan(body[iBody].daLats[iLats]);
   }
 }
 
@@ -1986,6 +2409,9 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
         malloc((body[iBody].iNumLats + 1) * sizeof(double));
   body[iBody].daDIceHeightDy = malloc(body[iBody].iNumLats * sizeof(double));
   body[iBody].daDeclination  = malloc(body[iBody].iNDays * sizeof(double));
+  body[iBody].daInsolKey     = malloc(INSOLKEYLEN * sizeof(double));
+  body[iBody].bInsolKeySet   = 0;
+  body[iBody].iNumYearsRun   = 0;
   body[iBody].daTGrad        = malloc(body[iBody].iNumLats * sizeof(double));
   body[iBody].daDMidPt       = malloc(body[iBody].iNumLats * sizeof(double));
   body[iBody].daDeltaTempL   = malloc(body[iBody].iNumLats * sizeof(double));
@@ -2018,6 +2444,10 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
   body[iBody].dTGlobal      = 0.0;
   body[iBody].dAlbedoGlobal = 0.0;
 
+  if (body[iBody].bRadTables) {
+    fvInitRadTables(body, iBody);
+  }
+
   if (body[iBody].bDistRot == 0) {
     body[iBody].dPrecA0 = body[iBody].dPrecA;
   }
@@ -2037,16 +2467,33 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daPlanckBAnn = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daMClim      = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daMEulerAnn  = malloc(body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daMEulerCopyAnn =
-          malloc(body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daInvMAnn    = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daSourceF    = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTempTerms  = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTmpTempAnn = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTmpTempTerms = malloc(body[iBody].iNumLats * sizeof(double));
-    body[iBody].iaRowswapAnn   = malloc(body[iBody].iNumLats * sizeof(int));
-    body[iBody].daScaleAnn     = malloc(body[iBody].iNumLats * sizeof(double));
-    body[iBody].daUnitVAnn     = malloc(body[iBody].iNumLats * sizeof(double));
+    if (body[iBody].iAnnualSolver == ANNANDERSON) {
+      body[iBody].daAndersonDF = malloc(ANDERSONDEPTH * sizeof(double *));
+      body[iBody].daAndersonDG = malloc(ANDERSONDEPTH * sizeof(double *));
+      body[iBody].daAndersonQ  = malloc(ANDERSONDEPTH * sizeof(double *));
+      body[iBody].daAndersonR  = malloc(ANDERSONDEPTH * sizeof(double *));
+      for (iLat = 0; iLat < ANDERSONDEPTH; iLat++) {
+        body[iBody].daAndersonDF[iLat] =
+              malloc(body[iBody].iNumLats * sizeof(double));
+        body[iBody].daAndersonDG[iLat] =
+              malloc(body[iBody].iNumLats * sizeof(double));
+        body[iBody].daAndersonQ[iLat] =
+              malloc(body[iBody].iNumLats * sizeof(double));
+        body[iBody].daAndersonR[iLat] = malloc(ANDERSONDEPTH * sizeof(double));
+      }
+      body[iBody].daAndersonF = malloc(body[iBody].iNumLats * sizeof(double));
+      body[iBody].daAndersonFOld =
+            malloc(body[iBody].iNumLats * sizeof(double));
+      body[iBody].daAndersonGOld =
+            malloc(body[iBody].iNumLats * sizeof(double));
+      body[iBody].daAndersonGamma = malloc(ANDERSONDEPTH * sizeof(double));
+      body[iBody].daTempAnnStart =
+            malloc(body[iBody].iNumLats * sizeof(double));
+    }
 
     body[iBody].daDiffusionAnn[0] = body[iBody].dDiffCoeff;
     for (iLat = 0; iLat <= body[iBody].iNumLats; iLat++) {
@@ -2058,19 +2505,15 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
         body[iBody].dTGlobal +=
               body[iBody].daTempAnn[iLat] / body[iBody].iNumLats;
         body[iBody].daInsol[iLat] = malloc(body[iBody].iNDays * sizeof(double));
-        body[iBody].daMClim[iLat] =
-              malloc(body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMDiffAnn[iLat] =
-              malloc(body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMEulerAnn[iLat] =
-              malloc(body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMEulerCopyAnn[iLat] =
-              malloc(body[iBody].iNumLats * sizeof(double));
-        body[iBody].daInvMAnn[iLat] =
-              malloc(body[iBody].iNumLats * sizeof(double));
+        /* Annual matrices are tridiagonal, so only the diagonals are kept */
+        body[iBody].daMClim[iLat]     = malloc(ANNDIAGS * sizeof(double));
+        body[iBody].daMDiffAnn[iLat]  = malloc(ANNDIAGS * sizeof(double));
+        body[iBody].daMEulerAnn[iLat] = malloc(ANNDIAGS * sizeof(double));
       }
 
-      if (body[iBody].bCalcAB) {
+      if (iLat == body[iBody].iNumLats) {
+        /* The last pass only sets the diffusion at the north pole */
+      } else if (body[iBody].bCalcAB) {
         /* Calculate A and B from williams and kasting 97 result */
         body[iBody].daPlanckBAnn[iLat] = fdOLRdTwk97(body, iBody, iLat, ANN);
         body[iBody].daPlanckAAnn[iLat] =
@@ -2153,6 +2596,7 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daTempMaxLW    = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTempMaxLand  = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTempMaxWater = malloc(body[iBody].iNumLats * sizeof(double));
+    body[iBody].iaSnowballLat  = malloc(body[iBody].iNumLats * sizeof(int));
     body[iBody].daTempMinLW    = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daTempDaily   = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daFluxOutLand = malloc(body[iBody].iNumLats * sizeof(double));
@@ -2162,10 +2606,7 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daSeaIceHeight = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daMEulerSea =
           malloc(2 * body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daMEulerCopySea =
-          malloc(2 * body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daMInit   = malloc(2 * body[iBody].iNumLats * sizeof(double *));
-    body[iBody].daInvMSea = malloc(2 * body[iBody].iNumLats * sizeof(double *));
+    body[iBody].daMInit = malloc(2 * body[iBody].iNumLats * sizeof(double *));
     body[iBody].daSourceL = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daSourceW = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daSourceLW = malloc(2 * body[iBody].iNumLats * sizeof(double));
@@ -2174,7 +2615,10 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daMDiffSea = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].iaRowswapSea = malloc(2 * body[iBody].iNumLats * sizeof(int));
     body[iBody].daScaleSea = malloc(2 * body[iBody].iNumLats * sizeof(double));
-    body[iBody].daUnitVSea = malloc(2 * body[iBody].iNumLats * sizeof(double));
+    body[iBody].daMatrixKeySea =
+          malloc(SEAMATRIXKEYLEN(body[iBody].iNumLats) * sizeof(double));
+    body[iBody].bMatrixKeySeaSet   = 0;
+    body[iBody].bMatrixSeaFactored = 0;
     body[iBody].daAlbedoLand  = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daAlbedoWater = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daLambdaSea =
@@ -2209,6 +2653,10 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daFluxOutDaily =
           malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daIceBalance = malloc(body[iBody].iNumLats * sizeof(double *));
+    if (body[iBody].dSeasPeriodTol > 0) {
+      body[iBody].daIceBalancePrev =
+            malloc(body[iBody].iNumLats * sizeof(double *));
+    }
     body[iBody].daIceMass    = malloc(body[iBody].iNumLats * sizeof(double *));
     body[iBody].daIceBalanceAnnual =
           malloc(body[iBody].iNumLats * sizeof(double));
@@ -2230,6 +2678,16 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
     body[iBody].daIceFlowAvg    = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daBedrockH      = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daBedrockHEq    = malloc(body[iBody].iNumLats * sizeof(double));
+    if (body[iBody].dIceHeightTol > 0) {
+      body[iBody].daIceSheetSave = malloc(ICESTATEVARS * sizeof(double *));
+      for (iLat = 0; iLat < ICESTATEVARS; iLat++) {
+        body[iBody].daIceSheetSave[iLat] =
+              malloc((body[iBody].iNumLats + 1) * sizeof(double));
+      }
+      body[iBody].daIceHeightFull =
+            malloc(body[iBody].iNumLats * sizeof(double));
+      body[iBody].dIceDtAdapt = 0;
+    }
     body[iBody].daPlanckASea    = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daPlanckBSea    = malloc(body[iBody].iNumLats * sizeof(double));
     body[iBody].daDiffusionSea =
@@ -2289,6 +2747,10 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
                      sizeof(double));
         body[iBody].daIceBalance[iLat] =
               malloc(body[iBody].iNStepInYear * sizeof(double));
+        if (body[iBody].dSeasPeriodTol > 0) {
+          body[iBody].daIceBalancePrev[iLat] =
+                malloc(body[iBody].iNStepInYear * sizeof(double));
+        }
         body[iBody].daMLand[iLat] =
               malloc(body[iBody].iNumLats * sizeof(double));
         body[iBody].daMWater[iLat] =
@@ -2302,23 +2764,16 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
               malloc(body[iBody].iNumYears * body[iBody].iNStepInYear *
                      sizeof(double));
 
-        /* Seasonal matrix is 2n x 2n to couple land and ocean */
+        /* Seasonal matrix is 2n x 2n to couple land and ocean. It is
+           banded, so the Euler matrix only stores the band and its fill. */
         body[iBody].daMEulerSea[2 * iLat] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
+              malloc(SEABANDWIDTH * sizeof(double));
         body[iBody].daMInit[2 * iLat] =
               malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMEulerCopySea[2 * iLat] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daInvMSea[2 * iLat] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
         body[iBody].daMEulerSea[2 * iLat + 1] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
+              malloc(SEABANDWIDTH * sizeof(double));
         body[iBody].daMInit[2 * iLat + 1] =
               malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daMEulerCopySea[2 * iLat + 1] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
-        body[iBody].daInvMSea[2 * iLat + 1] =
-              malloc(2 * body[iBody].iNumLats * sizeof(double));
 
         body[iBody].daIceMassTmp[iLat]    = 0.0;
         body[iBody].daIceBalanceAvg[iLat] = 0.0;
@@ -2331,12 +2786,12 @@ void InitializeClimateParams(BODY *body, int iBody, int iVerbose) {
         body[iBody].daScaleSea[2 * iLat]     = 0.;
         body[iBody].daScaleSea[2 * iLat + 1] = 0.;
         for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-          body[iBody].daMInit[2 * iLat][jLat]             = 0.;
-          body[iBody].daMEulerSea[2 * iLat][jLat]         = 0.;
-          body[iBody].daMEulerCopySea[2 * iLat][jLat]     = 0.;
-          body[iBody].daMInit[2 * iLat + 1][jLat]         = 0.;
-          body[iBody].daMEulerSea[2 * iLat + 1][jLat]     = 0.;
-          body[iBody].daMEulerCopySea[2 * iLat + 1][jLat] = 0.;
+          body[iBody].daMInit[2 * iLat][jLat]     = 0.;
+          body[iBody].daMInit[2 * iLat + 1][jLat] = 0.;
+        }
+        for (jLat = 0; jLat < SEABANDWIDTH; jLat++) {
+          body[iBody].daMEulerSea[2 * iLat][jLat]     = 0.;
+          body[iBody].daMEulerSea[2 * iLat + 1][jLat] = 0.;
         }
 
         if (body[iBody].bIceSheets) {
@@ -2639,6 +3094,7 @@ void VerifyPoise(BODY *body, CONTROL *control, FILES *files, OPTIONS *options,
     VerifyDynEllip(body, control, options, files->Infile[iBody + 1].cIn, iBody,
                    control->Io.iVerbose);
   }
+  VerifyOrbitOblData(body, control, options, iBody);
 
   /* Initialize climate arrays */
   InitializeLatGrid(body, iBody);
@@ -2711,6 +3167,14 @@ void WriteSnowball(BODY *body, CONTROL *control, OUTPUT *output, SYSTEM *system,
   strcpy(cUnit, "");
 }
 
+void WriteSeasYears(BODY *body, CONTROL *control, OUTPUT *output,
+                    SYSTEM *system, UNITS *units, UPDATE *update, int iBody,
+                    double *dTmp, char cUnit[]) {
+  /* Orbits the seasonal model needed in its last run */
+  *dTmp = (double)body[iBody].iNumYearsRun;
+  strcpy(cUnit, "");
+}
+
 void WriteIceCapNorthLand(BODY *body, CONTROL *control, OUTPUT *output,
                           SYSTEM *system, UNITS *units, UPDATE *update,
                           int iBody, double *dTmp, char cUnit[]) {
@@ -4449,6 +4913,18 @@ void InitializeOutputPoise(OUTPUT *output, fnWriteOutput fnWrite[]) {
         "edge. "
         "If not present, return 0. Note that some ice belts may in fact have a "
         "southern edge at the equator.");
+
+  sprintf(output[OUT_SEASYEARS].cName, "SeasYears");
+  sprintf(output[OUT_SEASYEARS].cDescr,
+          "Orbits the seasonal model ran before its cycle was periodic.");
+  output[OUT_SEASYEARS].bNeg       = 0;
+  output[OUT_SEASYEARS].iNum       = 1;
+  output[OUT_SEASYEARS].iModuleBit = POISE;
+  fnWrite[OUT_SEASYEARS]           = &WriteSeasYears;
+  sprintf(output[OUT_SEASYEARS].cLongDescr,
+          "Number of orbits the last run of the seasonal model integrated. "
+          "With dSeasPeriodTol > 0 the run stops once an orbit repeats the "
+          "previous one; otherwise this is iNumYears.");
 }
 
 /************ POISE Logging Functions **************/
@@ -4508,20 +4984,82 @@ void AddModulePoise(CONTROL *control, MODULE *module, int iBody, int iModule) {
 }
 
 /************* POISE Functions ***********/
-void UpdateOrbitOblData(BODY *body, EVOLVE *evolve, int iBody) {
-  body[iBody].dSemi      = body[iBody].daSemiSeries[body[iBody].iCurrentStep];
-  body[iBody].dEcc       = body[iBody].daEccSeries[body[iBody].iCurrentStep];
-  body[iBody].dArgP      = body[iBody].daArgPSeries[body[iBody].iCurrentStep];
-  body[iBody].dLongA     = body[iBody].daLongASeries[body[iBody].iCurrentStep];
-  body[iBody].dObliquity = body[iBody].daOblSeries[body[iBody].iCurrentStep];
-  body[iBody].dPrecA     = body[iBody].daPrecASeries[body[iBody].iCurrentStep];
+/**
+Interpolates between two angles along the shorter arc.
 
-  body[iBody].dXobl = sin(body[iBody].dObliquity) * cos(body[iBody].dPrecA);
-  body[iBody].dYobl = sin(body[iBody].dObliquity) * sin(body[iBody].dPrecA);
-  body[iBody].dZobl = cos(body[iBody].dObliquity);
+@param dAngle0 Angle at the start of the interval
+@param dAngle1 Angle at the end of the interval
+@param dFrac Fraction of the interval elapsed
+@return Interpolated angle
+*/
+double fdInterpAngle(double dAngle0, double dAngle1, double dFrac) {
+  double dDiff;
+
+  dDiff = dAngle1 - dAngle0;
+  dDiff -= 2 * PI * floor((dDiff + PI) / (2 * PI));
+  return dAngle0 + dFrac * dDiff;
+}
+
+/**
+Sets the orbit and obliquity to the forcing data at time dTime of the
+series, interpolating linearly between rows (angles along the shorter arc).
+iCurrentStep is kept as the row at or before dTime, so the search only walks
+the rows passed since the last call. The series may run forward or backward
+in time.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param dTime Time in the forcing series
+*/
+void fvOrbitOblAtTime(BODY *body, int iBody, double dTime) {
+  int iRow, iLast;
+  double dSign, dFrac;
+  double *daTime = body[iBody].daTimeSeries;
+
+  iLast = body[iBody].iNLines - 1;
+  dSign = (daTime[iLast] >= daTime[0]) ? 1.0 : -1.0;
+  iRow  = body[iBody].iCurrentStep;
+  while (iRow < iLast - 1 && dSign * daTime[iRow + 1] <= dSign * dTime) {
+    iRow++;
+  }
+  while (iRow > 0 && dSign * daTime[iRow] > dSign * dTime) {
+    iRow--;
+  }
+  body[iBody].iCurrentStep = iRow;
+  dFrac = (dTime - daTime[iRow]) / (daTime[iRow + 1] - daTime[iRow]);
+
+  body[iBody].dSemi =
+        body[iBody].daSemiSeries[iRow] +
+        dFrac * (body[iBody].daSemiSeries[iRow + 1] -
+                 body[iBody].daSemiSeries[iRow]);
+  body[iBody].dEcc = body[iBody].daEccSeries[iRow] +
+                     dFrac * (body[iBody].daEccSeries[iRow + 1] -
+                              body[iBody].daEccSeries[iRow]);
+  body[iBody].dObliquity = body[iBody].daOblSeries[iRow] +
+                           dFrac * (body[iBody].daOblSeries[iRow + 1] -
+                                    body[iBody].daOblSeries[iRow]);
+  body[iBody].dArgP =
+        fdInterpAngle(body[iBody].daArgPSeries[iRow],
+                      body[iBody].daArgPSeries[iRow + 1], dFrac);
+  body[iBody].dLongA =
+        fdInterpAngle(body[iBody].daLongASeries[iRow],
+                      body[iBody].daLongASeries[iRow + 1], dFrac);
+  body[iBody].dPrecA =
+        fdInterpAngle(body[iBody].daPrecASeries[iRow],
+                      body[iBody].daPrecASeries[iRow + 1], dFrac);
+
+  body[iBody].dXobl = sin(body[iBody].dObliquity) * cos(body[iBody].dPrecA);
+  body[iBody].dYobl = sin(body[iBody].dObliquity) * sin(body[iBody].dPrecA);
+  body[iBody].dZobl = cos(body[iBody].dObliquity);
+
+  body[iBody].dHecc =
+        body[iBody].dEcc * sin(body[iBody].dArgP + body[iBody].dLongA);
+  body[iBody].dKecc =
+        body[iBody].dEcc * cos(body[iBody].dArgP + body[iBody].dLongA);
+}
 
-  body[iBody].dHecc = body[iBody].daHeccSeries[body[iBody].iCurrentStep];
-  body[iBody].dKecc = body[iBody].daKeccSeries[body[iBody].iCurrentStep];
+void UpdateOrbitOblData(BODY *body, EVOLVE *evolve, int iBody) {
+  fvOrbitOblAtTime(body, iBody, fdOrbitOblTime(evolve, evolve->dTime));
 }
 
 /**
@@ -4696,6 +5234,21 @@ int fbIceFreeSea(BODY *body, int iBody) {
   return 1;
 }
 
+/**
+Is the ocean at latitude iLat frozen, by the test of fvSnowball?
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param iLat Latitude cell in question
+@return 1 if the ocean counts as frozen, 0 otherwise
+*/
+int fbSnowballLat(BODY *body, int iBody, int iLat) {
+  if (body[iBody].bSeaIceModel) {
+    return (body[iBody].daSeaIceHeight[iLat] >= body[iBody].dMinIceHeight);
+  }
+  return (body[iBody].daTempMaxWater[iLat] <= body[iBody].dFrzTSeaIce);
+}
+
 /**
 Determines if planet has entered snowball state
 
@@ -4709,15 +5262,7 @@ void fvSnowball(BODY *body, int iBody) {
   int iLat, iNum = 0;
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    if (body[iBody].bSeaIceModel) {
-      if (body[iBody].daSeaIceHeight[iLat] >= body[iBody].dMinIceHeight) {
-        iNum++;
-      }
-    } else {
-      if (body[iBody].daTempMaxWater[iLat] <= body[iBody].dFrzTSeaIce) {
-        iNum++;
-      }
-    }
+    iNum += fbSnowballLat(body, iBody, iLat);
   }
   if (iNum == body[iBody].iNumLats) {
     body[iBody].bSnowball = 1;
@@ -5319,7 +5864,10 @@ void ForceBehaviorPoise(BODY *body, MODULE *module, EVOLVE *evolve, IO *io,
     }
   }
 
-  if (body[iBody].bDistRot == 0) {
+  if (body[iBody].bReadOrbitOblData) {
+
+    UpdateOrbitOblData(body, evolve, iBody);
+  } else if (body[iBody].bDistRot == 0) {
 
     fvPrecessionExplicit(body, evolve, iBody);
     if (body[iBody].bForceObliq) {
@@ -5435,7 +5983,7 @@ Calculates insolation at each latitude for a single "iNday" of the year/orbit
 void fvDailyInsolation(BODY *body, int iBody, int iDay) {
 
   int iLat;
-  double dSconst, dSinDelta, dCosDelta, dTanDelta, dDelta, HA;
+  double dSconst, dSinDelta, dCosDelta, dTanDelta, dDelta, HA, dCosHA;
 
   // HA = dHourAngle ,dSconst = dStellarConst,dSinDelta = dSinDelta,
   // dCosDelta =
@@ -5449,61 +5997,70 @@ void fvDailyInsolation(BODY *body, int iBody, int iDay) {
   dDelta    = asin(dSinDelta);
   body[iBody].daDeclination[iDay] = dDelta;
 
+  /* The sun never sets where cos(HA) = -tan(lat)*tan(delta) <= -1 and never
+     rises where it is >= 1, which covers both hemispheres and seasons */
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    if (dDelta > 0.0) {
-      /* Northern summer */
-      if (body[iBody].daLats[iLat] >= (PI / 2. - dDelta)) {
-        /* white night/no sunset */
-        body[iBody].daInsol[iLat][iDay] =
-              dSconst * sin(body[iBody].daLats[iLat]) * dSinDelta /
-              (body[iBody].dAstroDist * body[iBody].dAstroDist);
-
-      } else if (-body[iBody].daLats[iLat] >= (PI / 2. - dDelta) &&
-                 body[iBody].daLats[iLat] < 0.0) {
-        /* polar darkness/no sunrise */
-        body[iBody].daInsol[iLat][iDay] = 0.0;
-      } else {
-        /* regular iNday/night cycle */
-        HA = acos(-tan(body[iBody].daLats[iLat]) * dTanDelta);
-        body[iBody].daInsol[iLat][iDay] =
-              dSconst *
-              (HA * sin(body[iBody].daLats[iLat]) * dSinDelta +
-               cos(body[iBody].daLats[iLat]) * dCosDelta * sin(HA)) /
-              (PI * (body[iBody].dAstroDist * body[iBody].dAstroDist));
-      }
+    dCosHA = -body[iBody].daTanLats[iLat] * dTanDelta;
+    if (!(dCosHA > -1.0)) {
+      /* white night/no sunset */
+      body[iBody].daInsol[iLat][iDay] =
+            dSconst * body[iBody].daSinLats[iLat] * dSinDelta /
+            (body[iBody].dAstroDist * body[iBody].dAstroDist);
+    } else if (dCosHA >= 1.0) {
+      /* polar darkness/no sunrise */
+      body[iBody].daInsol[iLat][iDay] = 0.0;
     } else {
-      /* Southern summer */
-      if (-body[iBody].daLats[iLat] >= (PI / 2. + dDelta) &&
-          body[iBody].daLats[iLat] < 0.0) {
-        /* white night/no sunset */
-        body[iBody].daInsol[iLat][iDay] =
-              dSconst * sin(body[iBody].daLats[iLat]) * dSinDelta /
-              (body[iBody].dAstroDist * body[iBody].dAstroDist);
-
-      } else if (body[iBody].daLats[iLat] >= (PI / 2. + dDelta)) {
-        /* polar darkness/no sunrise */
-        body[iBody].daInsol[iLat][iDay] = 0.0;
-
-      } else {
-
-        /* regular iNday/night cycle */
-        HA = acos(-tan(body[iBody].daLats[iLat]) * dTanDelta);
-        body[iBody].daInsol[iLat][iDay] =
-              dSconst *
-              (HA * sin(body[iBody].daLats[iLat]) * dSinDelta +
-               cos(body[iBody].daLats[iLat]) * dCosDelta * sin(HA)) /
-              (PI * (body[iBody].dAstroDist * body[iBody].dAstroDist));
-      }
+      /* regular iNday/night cycle */
+      HA = acos(dCosHA);
+      body[iBody].daInsol[iLat][iDay] =
+            dSconst *
+            (HA * body[iBody].daSinLats[iLat] * dSinDelta +
+             body[iBody].daCosLats[iLat] * dCosDelta * sin(HA)) /
+            (PI * (body[iBody].dAstroDist * body[iBody].dAstroDist));
     }
   }
 }
 
 /**
-Calculates insolation at each latitude over the entire year/orbit
+Checks whether the orbit and spin that set the insolation have moved by
+more than dInsolTol since the insolation was last calculated. Each input
+may change by dInsolTol times its magnitude, or by dInsolTol when its
+magnitude is below one (angles in radians, eccentricity). If they have
+moved, records the current values.
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
+@return 1 if the insolation must be calculated again, 0 otherwise
 */
+int fbInsolationChanged(BODY *body, int iBody) {
+  int iKey, bChanged;
+  double daKey[INSOLKEYLEN];
+
+  daKey[0] = body[0].dLuminosity;
+  daKey[1] = body[iBody].dSemi;
+  daKey[2] = body[iBody].dHecc;
+  daKey[3] = body[iBody].dKecc;
+  daKey[4] = body[iBody].dEcc;
+  daKey[5] = body[iBody].dLongP + body[iBody].dPrecA;
+  daKey[6] = body[iBody].dObliquity;
+
+  bChanged = !body[iBody].bInsolKeySet;
+  for (iKey = 0; iKey < INSOLKEYLEN && !bChanged; iKey++) {
+    if (!(fabs(daKey[iKey] - body[iBody].daInsolKey[iKey]) <=
+          body[iBody].dInsolTol * fmax(fabs(body[iBody].daInsolKey[iKey]),
+                                       1.0))) {
+      bChanged = 1;
+    }
+  }
+  if (bChanged) {
+    for (iKey = 0; iKey < INSOLKEYLEN; iKey++) {
+      body[iBody].daInsolKey[iKey] = daKey[iKey];
+    }
+    body[iBody].bInsolKeySet = 1;
+  }
+  return bChanged;
+}
+
 void fvAnnualInsolation(BODY *body, int iBody) {
   int iDays, iLat;
   double dLongP, dTrueA, dEccA, dMeanL, dEcc;
@@ -5523,8 +6080,18 @@ void fvAnnualInsolation(BODY *body, int iBody) {
   body[iBody].dObliquity = atan2(sqrt((body[iBody].dXobl * body[iBody].dXobl) +
                                       (body[iBody].dYobl * body[iBody].dYobl)),
                                  body[iBody].dZobl);
-  dEccA                  = fdEccTrueAnomaly(dTrueA, dEcc);
-  dMeanL                 = dEccA - dEcc * sin(dEccA) + dLongP;
+
+  if (!fbInsolationChanged(body, iBody)) {
+    /* Leave the orbit where a full calculation would */
+    body[iBody].dTrueL     = body[iBody].dInsolTrueL;
+    body[iBody].dMeanA     = body[iBody].dInsolMeanA;
+    body[iBody].dEccA      = body[iBody].dInsolEccA;
+    body[iBody].dAstroDist = body[iBody].dInsolAstroDist;
+    return;
+  }
+
+  dEccA  = fdEccTrueAnomaly(dTrueA, dEcc);
+  dMeanL = dEccA - dEcc * sin(dEccA) + dLongP;
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     body[iBody].daAnnualInsol[iLat] = 0.0;
@@ -5575,6 +6142,10 @@ void fvAnnualInsolation(BODY *body, int iBody) {
       }
     }
   }
+  body[iBody].dInsolTrueL     = body[iBody].dTrueL;
+  body[iBody].dInsolMeanA     = body[iBody].dMeanA;
+  body[iBody].dInsolEccA      = body[iBody].dEccA;
+  body[iBody].dInsolAstroDist = body[iBody].dAstroDist;
 }
 
 /**
@@ -5613,65 +6184,239 @@ void fvAlbedoAnnual(BODY *body, int iBody) {
 }
 
 /**
-Inverts the matrix for the annual EBM
+Factors a tridiagonal matrix for the Thomas algorithm. Row i of daTri holds
+the subdiagonal, diagonal and superdiagonal entries A[i][i-1], A[i][i] and
+A[i][i+1]. On return the subdiagonal holds the elimination multipliers and
+the diagonal the pivots; the superdiagonal is unchanged. No pivoting is
+done, which is stable for the diagonally dominant matrices of the EBM.
+
+@param daTri Tridiagonal matrix, factored in place
+@param iSize Number of rows
+*/
+void fvTridiagDecomp(double **daTri, int iSize) {
+  int iRow;
 
-@param body Struct containing all body information and variables
-@param iBody Body in question
+  if (daTri[0][1] == 0) {
+    daTri[0][1] = TEENY;
+  }
+  for (iRow = 1; iRow < iSize; iRow++) {
+    daTri[iRow][0] /= daTri[iRow - 1][1];
+    daTri[iRow][1] -= daTri[iRow][0] * daTri[iRow - 1][2];
+    if (daTri[iRow][1] == 0) {
+      daTri[iRow][1] = TEENY;
+    }
+  }
+}
+
+/**
+Solves a tridiagonal system factored by fvTridiagDecomp in O(N).
+
+@param daTri Factors from fvTridiagDecomp
+@param daSoln Right-hand side on input, solution on output
+@param iSize Number of rows
 */
-void fvMatrixInvertAnnual(BODY *body, int iBody) {
-  int iLat, jLat;
+void fvTridiagSolve(double **daTri, double *daSoln, int iSize) {
+  int iRow;
+
+  for (iRow = 1; iRow < iSize; iRow++) {
+    daSoln[iRow] -= daTri[iRow][0] * daSoln[iRow - 1];
+  }
+  daSoln[iSize - 1] /= daTri[iSize - 1][1];
+  for (iRow = iSize - 2; iRow >= 0; iRow--) {
+    daSoln[iRow] =
+          (daSoln[iRow] - daTri[iRow][2] * daSoln[iRow + 1]) / daTri[iRow][1];
+  }
+}
 
-  LUDecomp(body[iBody].daMEulerAnn, body[iBody].daMEulerCopyAnn,
-           body[iBody].daScaleAnn, body[iBody].iaRowswapAnn,
-           body[iBody].iNumLats);
+/**
+Multiplies a tridiagonal matrix, stored as for fvTridiagDecomp, by a vector
+and adds the product to daProduct.
 
-  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      if (jLat == iLat) {
-        body[iBody].daUnitVAnn[jLat] = 1.0;
-      } else {
-        body[iBody].daUnitVAnn[jLat] = 0.0;
+@param daTri Tridiagonal matrix
+@param daVector Vector to multiply
+@param daProduct Vector the product is added to
+@param iSize Number of rows
+*/
+void fvTridiagMultAdd(double **daTri, double *daVector, double *daProduct,
+                      int iSize) {
+  int iRow;
+
+  for (iRow = 0; iRow < iSize; iRow++) {
+    if (iRow > 0) {
+      daProduct[iRow] += daTri[iRow][0] * daVector[iRow - 1];
+    }
+    daProduct[iRow] += daTri[iRow][1] * daVector[iRow];
+    if (iRow < iSize - 1) {
+      daProduct[iRow] += daTri[iRow][2] * daVector[iRow + 1];
+    }
+  }
+}
+
+/**
+LU decomposition with scaled partial pivoting of a band matrix. Row i of
+daBand holds the entries of columns i - iLower to i + iLower + iUpper, i.e.
+A[i][j] is daBand[i][j - i + iLower]; the last iLower of them start out as
+zero and receive the fill from row interchanges. The factors overwrite
+daBand. Work and storage are O(N) for a fixed bandwidth.
+
+@param daBand Band matrix, width 2 * iLower + iUpper + 1, factored in place
+@param daScale Work space for the row scale factors, length iSize
+@param iaRowswap Row interchanged with each row, length iSize
+@param iSize Number of rows
+@param iLower Number of subdiagonals
+@param iUpper Number of superdiagonals
+*/
+void fvBandLUDecomp(double **daBand, double *daScale, int *iaRowswap,
+                    int iSize, int iLower, int iUpper) {
+  int i, j, k, iPivot, iLast, iLastCol;
+  double dScaleTmp, dFactor, dDummy;
+
+  for (i = 0; i < iSize; i++) {
+    daScale[i] = 0.0;
+    for (j = 0; j <= iLower + iUpper; j++) {
+      if (fabs(daBand[i][j]) > daScale[i]) {
+        daScale[i] = fabs(daBand[i][j]);
       }
     }
+    if (daScale[i] == 0.0) {
+      fprintf(stderr, "Singular matrix in routine fvBandLUDecomp");
+      exit(EXIT_INPUT);
+    }
+    daScale[i] = 1.0 / daScale[i];
+  }
 
-    LUSolve(body[iBody].daMEulerCopyAnn, body[iBody].daUnitVAnn,
-            body[iBody].iaRowswapAnn, body[iBody].iNumLats);
+  for (k = 0; k < iSize; k++) {
+    iLast    = (k + iLower < iSize - 1) ? k + iLower : iSize - 1;
+    iLastCol = (k + iLower + iUpper < iSize - 1) ? k + iLower + iUpper
+                                                 : iSize - 1;
 
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      body[iBody].daInvMAnn[jLat][iLat] = body[iBody].daUnitVAnn[jLat];
+    // Pivot on the largest scaled entry on or below the diagonal
+    dScaleTmp = 0.0;
+    iPivot    = k;
+    for (i = k; i <= iLast; i++) {
+      if (fabs(daScale[i] * daBand[i][k - i + iLower]) >= dScaleTmp) {
+        dScaleTmp = fabs(daScale[i] * daBand[i][k - i + iLower]);
+        iPivot    = i;
+      }
+    }
+    if (iPivot != k) {
+      for (j = k; j <= iLastCol; j++) {
+        dDummy                          = daBand[k][j - k + iLower];
+        daBand[k][j - k + iLower]       = daBand[iPivot][j - iPivot + iLower];
+        daBand[iPivot][j - iPivot + iLower] = dDummy;
+      }
+      dDummy          = daScale[k];
+      daScale[k]      = daScale[iPivot];
+      daScale[iPivot] = dDummy;
+    }
+    iaRowswap[k] = iPivot;
+
+    if (daBand[k][iLower] == 0) {
+      daBand[k][iLower] = TEENY;
+    }
+    for (i = k + 1; i <= iLast; i++) {
+      dFactor                   = daBand[i][k - i + iLower] / daBand[k][iLower];
+      daBand[i][k - i + iLower] = dFactor;
+      for (j = k + 1; j <= iLastCol; j++) {
+        daBand[i][j - i + iLower] -= dFactor * daBand[k][j - k + iLower];
+      }
+    }
+  }
+}
+
+/**
+Solves a system of equations with a band matrix factored by fvBandLUDecomp.
+
+@param daBand Factors from fvBandLUDecomp
+@param daSoln Right-hand side on input, solution on output
+@param iaRowswap Row interchanges from fvBandLUDecomp
+@param iSize Number of rows
+@param iLower Number of subdiagonals
+@param iUpper Number of superdiagonals
+*/
+void fvBandLUSolve(double **daBand, double *daSoln, int *iaRowswap, int iSize,
+                   int iLower, int iUpper) {
+  int i, j, iLast;
+  double dSum, dDummy;
+
+  // Forward substitution with the unit lower factor
+  for (i = 0; i < iSize; i++) {
+    if (iaRowswap[i] != i) {
+      dDummy               = daSoln[i];
+      daSoln[i]            = daSoln[iaRowswap[i]];
+      daSoln[iaRowswap[i]] = dDummy;
+    }
+    iLast = (i + iLower < iSize - 1) ? i + iLower : iSize - 1;
+    for (j = i + 1; j <= iLast; j++) {
+      daSoln[j] -= daBand[j][i - j + iLower] * daSoln[i];
+    }
+  }
+
+  // Back substitution with the upper factor
+  for (i = iSize - 1; i >= 0; i--) {
+    dSum  = 0.0;
+    iLast = (i + iLower + iUpper < iSize - 1) ? i + iLower + iUpper
+                                              : iSize - 1;
+    for (j = i + 1; j <= iLast; j++) {
+      dSum += daBand[i][j - i + iLower] * daSoln[j];
     }
+    daSoln[i] = (daSoln[i] - dSum) / daBand[i][iLower];
   }
 }
 
 /**
-Inverts the matrix for the seasonal EBM
+Copies the band of daMInit into the Euler matrix of the seasonal EBM. Land
+and water temperatures alternate, so a latitude couples to its neighbors two
+rows away and to the other surface type in the next or previous row.
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
 */
-void fvMatrixInvertSeasonal(BODY *body, int iBody) {
-  int iLat, jLat;
-
-  LUDecomp(body[iBody].daMEulerSea, body[iBody].daMEulerCopySea,
-           body[iBody].daScaleSea, body[iBody].iaRowswapSea,
-           2 * body[iBody].iNumLats);
+void fvMatrixBandSeasonal(BODY *body, int iBody) {
+  int iRow, jCol, iSize = 2 * body[iBody].iNumLats;
 
-  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      if (jLat == iLat) {
-        body[iBody].daUnitVSea[jLat] = 1.0;
-      } else {
-        body[iBody].daUnitVSea[jLat] = 0.0;
+  for (iRow = 0; iRow < iSize; iRow++) {
+    for (jCol = 0; jCol < SEABANDWIDTH; jCol++) {
+      body[iBody].daMEulerSea[iRow][jCol] = 0.0;
+    }
+    for (jCol = iRow - SEABANDLO; jCol <= iRow + SEABANDUP; jCol++) {
+      if (jCol >= 0 && jCol < iSize) {
+        body[iBody].daMEulerSea[iRow][jCol - iRow + SEABANDLO] =
+              body[iBody].daMInit[iRow][jCol];
       }
     }
+  }
+}
 
-    LUSolve(body[iBody].daMEulerCopySea, body[iBody].daUnitVSea,
-            body[iBody].iaRowswapSea, 2 * body[iBody].iNumLats);
+/**
+Factors the Euler matrix for the seasonal EBM, which is then applied by
+fvMatrixSolveSeasonal.
 
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daInvMSea[jLat][iLat] = body[iBody].daUnitVSea[jLat];
-    }
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvMatrixFactorSeasonal(BODY *body, int iBody) {
+  fvBandLUDecomp(body[iBody].daMEulerSea, body[iBody].daScaleSea,
+                 body[iBody].iaRowswapSea, 2 * body[iBody].iNumLats,
+                 SEABANDLO, SEABANDUP);
+}
+
+/**
+Solves for the temperatures after one step of the seasonal EBM, placing the
+land and water temperatures from daSourceLW in daTmpTempSea.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvMatrixSolveSeasonal(BODY *body, int iBody) {
+  int iLat;
+
+  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
+    body[iBody].daTmpTempSea[iLat] = body[iBody].daSourceLW[iLat];
   }
+  fvBandLUSolve(body[iBody].daMEulerSea, body[iBody].daTmpTempSea,
+                body[iBody].iaRowswapSea, 2 * body[iBody].iNumLats, SEABANDLO,
+                SEABANDUP);
 }
 
 /**
@@ -5730,79 +6475,71 @@ operation of the inverse matrix is a "time-step".
 @param iBody Body in question
 */
 void fvMatrixAnnual(BODY *body, int iBody) {
-  int iLat, jLat;
+  int iLat;
   double dDelta_t;
 
   dDelta_t = 1.5 / body[iBody].iNumLats;
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    body[iBody].daTempTerms[iLat] = 0.0;
-
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      if (jLat == iLat) {
-
-        body[iBody].daMClim[iLat][jLat] = (-body[iBody].daPlanckBAnn[iLat] -
-                                           body[iBody].daLambdaAnn[iLat + 1] -
-                                           body[iBody].daLambdaAnn[iLat]) /
-                                          body[iBody].dHeatCapAnn;
-
-        body[iBody].daMDiffAnn[iLat][jLat] =
-              (-body[iBody].daLambdaAnn[iLat + 1] -
-               body[iBody].daLambdaAnn[iLat]);
-
-        body[iBody].daMEulerAnn[iLat][jLat] = -1.0 / dDelta_t;
-
-      } else if (jLat == (iLat + 1)) {
-        body[iBody].daMClim[iLat][jLat] =
-              body[iBody].daLambdaAnn[jLat] / body[iBody].dHeatCapAnn;
-
-        body[iBody].daMDiffAnn[iLat][jLat]  = body[iBody].daLambdaAnn[jLat];
-        body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
-
-      } else if (jLat == (iLat - 1)) {
-        body[iBody].daMClim[iLat][jLat] =
-              body[iBody].daLambdaAnn[iLat] / body[iBody].dHeatCapAnn;
-
-        body[iBody].daMDiffAnn[iLat][jLat]  = body[iBody].daLambdaAnn[iLat];
-        body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
+    if (iLat > 0) {
+      body[iBody].daMClim[iLat][0] =
+            body[iBody].daLambdaAnn[iLat] / body[iBody].dHeatCapAnn;
+      body[iBody].daMDiffAnn[iLat][0] = body[iBody].daLambdaAnn[iLat];
+    } else {
+      body[iBody].daMClim[iLat][0]    = 0.0;
+      body[iBody].daMDiffAnn[iLat][0] = 0.0;
+    }
 
-      } else {
-        body[iBody].daMClim[iLat][jLat]     = 0.0;
-        body[iBody].daMDiffAnn[iLat][jLat]  = 0.0;
-        body[iBody].daMEulerAnn[iLat][jLat] = 0.0;
-      }
-      body[iBody].daMEulerAnn[iLat][jLat] +=
-            0.5 * body[iBody].daMClim[iLat][jLat];
+    body[iBody].daMClim[iLat][1] = (-body[iBody].daPlanckBAnn[iLat] -
+                                    body[iBody].daLambdaAnn[iLat + 1] -
+                                    body[iBody].daLambdaAnn[iLat]) /
+                                   body[iBody].dHeatCapAnn;
+    body[iBody].daMDiffAnn[iLat][1] =
+          (-body[iBody].daLambdaAnn[iLat + 1] - body[iBody].daLambdaAnn[iLat]);
 
-      body[iBody].daTempTerms[iLat] +=
-            body[iBody].daMClim[iLat][jLat] * body[iBody].daTempAnn[jLat];
+    if (iLat < body[iBody].iNumLats - 1) {
+      body[iBody].daMClim[iLat][2] =
+            body[iBody].daLambdaAnn[iLat + 1] / body[iBody].dHeatCapAnn;
+      body[iBody].daMDiffAnn[iLat][2] = body[iBody].daLambdaAnn[iLat + 1];
+    } else {
+      body[iBody].daMClim[iLat][2]    = 0.0;
+      body[iBody].daMDiffAnn[iLat][2] = 0.0;
     }
 
+    body[iBody].daMEulerAnn[iLat][0] = 0.5 * body[iBody].daMClim[iLat][0];
+    body[iBody].daMEulerAnn[iLat][1] =
+          -1.0 / dDelta_t + 0.5 * body[iBody].daMClim[iLat][1];
+    body[iBody].daMEulerAnn[iLat][2] = 0.5 * body[iBody].daMClim[iLat][2];
+
     body[iBody].daSourceF[iLat] = ((1.0 - body[iBody].daAlbedoAnn[iLat]) *
                                          body[iBody].daAnnualInsol[iLat] -
                                    body[iBody].daPlanckAAnn[iLat]) /
                                   body[iBody].dHeatCapAnn;
+    body[iBody].daTempTerms[iLat] = 0.0;
+  }
 
+  fvTridiagMultAdd(body[iBody].daMClim, body[iBody].daTempAnn,
+                   body[iBody].daTempTerms, body[iBody].iNumLats);
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     body[iBody].daTempTerms[iLat] += body[iBody].daSourceF[iLat];
   }
+  fvTridiagDecomp(body[iBody].daMEulerAnn, body[iBody].iNumLats);
 }
 
 /**
-Runs the annual EBM, called from ForceBehavior. The annual EBM runs to
-steady-state (global temperature change becomes very small), rather than for a
-set number of orbits.
+Updates the OLR coefficients A and B (when bCalcAB = 1), the diffusion
+coefficients (when bMEPDiff = 1) and the diffusion terms of the annual EBM
+for the current temperatures.
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
 */
-void PoiseAnnual(BODY *body, int iBody) {
+void fvClimateParamsAnnual(BODY *body, int iBody) {
+  int iLat;
+  double dDelta_x, dXBoundary;
 
-  double dDelta_t, dDelta_x, dXBoundary, dTempChange, dTmpTGlobal;
-  int iIterMax, iLat, jLat, iIter;
+  dDelta_x = 2.0 / body[iBody].iNumLats;
 
-  /* Get current climate parameters */
-  fvAlbedoAnnual(body, iBody);
-  fvAnnualInsolation(body, iBody);
   if (body[iBody].bCalcAB) {
     for (iLat = 0; iLat <= body[iBody].iNumLats; iLat++) {
       if (iLat != body[iBody].iNumLats) {
@@ -5842,51 +6579,59 @@ void PoiseAnnual(BODY *body, int iBody) {
     }
   }
 
-  dDelta_t = 1.5 / body[iBody].iNumLats;
-  dDelta_x = 2.0 / body[iBody].iNumLats;
-  iIterMax = 2000;
-
-  /* Setup matrices, source function, temperature terms, global mean */
   for (iLat = 0; iLat < body[iBody].iNumLats + 1; iLat++) {
     dXBoundary                    = -1.0 + iLat * 2.0 / body[iBody].iNumLats;
     body[iBody].daLambdaAnn[iLat] = body[iBody].daDiffusionAnn[iLat] *
                                     (1.0 - (dXBoundary * dXBoundary)) /
                                     ((dDelta_x * dDelta_x));
   }
+}
+
+/**
+Relaxes the annual EBM to equilibrium by marching in pseudo-time until the
+global temperature change becomes very small.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvPoiseAnnualRelax(BODY *body, int iBody) {
+  double dDelta_t, dTempChange, dTmpTGlobal;
+  int iIterMax, iLat, iIter;
+
+  /* Get current climate parameters */
+  fvAlbedoAnnual(body, iBody);
+  fvClimateParamsAnnual(body, iBody);
+
+  dDelta_t = 1.5 / body[iBody].iNumLats;
+  iIterMax = 2000;
 
+  /* Setup matrices, source function, temperature terms, global mean */
   body[iBody].dTGlobal = 0.0;
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     body[iBody].dTGlobal += body[iBody].daTempAnn[iLat] / body[iBody].iNumLats;
   }
   fvMatrixAnnual(body, iBody);
-  fvMatrixInvertAnnual(body, iBody);
 
   /* Relaxation to equilibrium */
   iIter       = 1;
   dTempChange = 1.0;
   while (fabs(dTempChange) > 1e-12) {
-    dTmpTGlobal = 0.0;
     for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-      body[iBody].daTmpTempAnn[iLat] = 0.0;
-
-      for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-        body[iBody].daTmpTempAnn[iLat] +=
-              -body[iBody].daInvMAnn[iLat][jLat] *
-              (0.5 * (body[iBody].daTempTerms[jLat] +
-                      body[iBody].daSourceF[jLat]) +
-               body[iBody].daTempAnn[jLat] / dDelta_t);
-      }
-      dTmpTGlobal += body[iBody].daTmpTempAnn[iLat] / body[iBody].iNumLats;
+      body[iBody].daTmpTempAnn[iLat] =
+            -(0.5 * (body[iBody].daTempTerms[iLat] +
+                     body[iBody].daSourceF[iLat]) +
+              body[iBody].daTempAnn[iLat] / dDelta_t);
     }
+    fvTridiagSolve(body[iBody].daMEulerAnn, body[iBody].daTmpTempAnn,
+                   body[iBody].iNumLats);
 
+    dTmpTGlobal = 0.0;
     for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+      dTmpTGlobal += body[iBody].daTmpTempAnn[iLat] / body[iBody].iNumLats;
       body[iBody].daTmpTempTerms[iLat] = body[iBody].daSourceF[iLat];
-
-      for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-        body[iBody].daTmpTempTerms[iLat] +=
-              body[iBody].daMClim[iLat][jLat] * body[iBody].daTmpTempAnn[jLat];
-      }
     }
+    fvTridiagMultAdd(body[iBody].daMClim, body[iBody].daTmpTempAnn,
+                     body[iBody].daTmpTempTerms, body[iBody].iNumLats);
 
     dTempChange = dTmpTGlobal - body[iBody].dTGlobal;
 
@@ -5910,141 +6655,546 @@ void PoiseAnnual(BODY *body, int iBody) {
       // LCOV_EXCL_STOP
     }
     if (body[iBody].bCalcAB == 1) {
-      for (iLat = 0; iLat <= body[iBody].iNumLats; iLat++) {
-        if (iLat != body[iBody].iNumLats) {
-          if (body[iBody].iOLRModel == WK97) {
-            body[iBody].daPlanckBAnn[iLat] =
-                  fdOLRdTwk97(body, iBody, iLat, ANN);
-            body[iBody].daPlanckAAnn[iLat] =
-                  fdOLRwk97(body, iBody, iLat, ANN) -
-                  body[iBody].daPlanckBAnn[iLat] *
-                        (body[iBody].daTempAnn[iLat]);
-
-          } else if (body[iBody].iOLRModel == HM16) {
-            body[iBody].daPlanckBAnn[iLat] =
-                  fdOLRdThm16(body, iBody, iLat, ANN);
-            body[iBody].daPlanckAAnn[iLat] =
-                  fdOLRhm16(body, iBody, iLat, ANN) -
-                  body[iBody].daPlanckBAnn[iLat] *
-                        (body[iBody].daTempAnn[iLat]);
-
-          } else {
-            body[iBody].daPlanckBAnn[iLat] =
-                  fdOLRdTsms09(body, iBody, iLat, ANN);
-            body[iBody].daPlanckAAnn[iLat] =
-                  fdOLRsms09(body, iBody, iLat, ANN) -
-                  body[iBody].daPlanckBAnn[iLat] *
-                        (body[iBody].daTempAnn[iLat]);
-          }
-        }
-
-        if (body[iBody].bMEPDiff) {
-          if (iLat == 0) {
-            body[iBody].daDiffusionAnn[iLat] =
-                  body[iBody].daPlanckBAnn[iLat] / 4.0;
-
-          } else if (iLat == body[iBody].iNumLats) {
-            body[iBody].daDiffusionAnn[iLat] =
-                  body[iBody].daPlanckBAnn[iLat - 1] / 4.0;
-
-          } else {
-            body[iBody].daDiffusionAnn[iLat] =
-                  (body[iBody].daPlanckBAnn[iLat] +
-                   body[iBody].daPlanckBAnn[iLat - 1]) /
-                  8.0;
-          }
-          dXBoundary = -1.0 + iLat * 2.0 / body[iBody].iNumLats;
-          body[iBody].daLambdaAnn[iLat] = body[iBody].daDiffusionAnn[iLat] *
-                                          (1.0 - (dXBoundary * dXBoundary)) /
-                                          ((dDelta_x * dDelta_x));
-        }
-      }
+      fvClimateParamsAnnual(body, iBody);
       fvMatrixAnnual(body, iBody);
-      fvMatrixInvertAnnual(body, iBody);
     }
     iIter++;
   }
+}
 
-  /* Calculate some interesting quantities */
-  body[iBody].dFluxInGlobal  = 0.0;
-  body[iBody].dFluxOutGlobal = 0.0;
-  body[iBody].dAlbedoGlobal  = 0.0;
-  body[iBody].dIceMassTot    = 0.0;
-  fvTempGradientAnn(body, dDelta_x, iBody);
-  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    body[iBody].daDMidPt[iLat] = 0.5 * (body[iBody].daDiffusionAnn[iLat + 1] +
-                                        body[iBody].daDiffusionAnn[iLat]);
-
-    body[iBody].daFlux[iLat] =
-          -2. * PI * (body[iBody].dRadius * body[iBody].dRadius) *
-          sqrt(1.0 - (sin(body[iBody].daLats[iLat]) *
-                      sin(body[iBody].daLats[iLat]))) *
-          body[iBody].daDMidPt[iLat] * body[iBody].daTGrad[iLat];
-
-    body[iBody].daFluxIn[iLat] = (1.0 - body[iBody].daAlbedoAnn[iLat]) *
-                                 body[iBody].daAnnualInsol[iLat];
+/**
+One pseudo-time step of the annual EBM from the temperatures in daTempAnn,
+with the albedo, OLR and diffusion evaluated at those temperatures. The new
+temperatures are placed in daTmpTempAnn. Equilibria of the annual EBM are
+the fixed points of this map.
 
-    body[iBody].daFluxOut[iLat] =
-          body[iBody].daPlanckAAnn[iLat] +
-          body[iBody].daPlanckBAnn[iLat] * body[iBody].daTempAnn[iLat];
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvAnnualFixedPointMap(BODY *body, int iBody) {
+  int iLat;
+  double dDelta_t;
 
-    body[iBody].dFluxInGlobal +=
-          body[iBody].daFluxIn[iLat] / body[iBody].iNumLats;
+  dDelta_t = 1.5 / body[iBody].iNumLats;
 
-    body[iBody].dFluxOutGlobal +=
-          body[iBody].daFluxOut[iLat] / body[iBody].iNumLats;
+  fvAlbedoAnnual(body, iBody);
+  fvClimateParamsAnnual(body, iBody);
+  fvMatrixAnnual(body, iBody);
 
-    body[iBody].daDivFlux[iLat] = 0.0;
-    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-      body[iBody].daDivFlux[iLat] +=
-            -body[iBody].daMDiffAnn[iLat][jLat] * body[iBody].daTempAnn[jLat];
-    }
-    body[iBody].dAlbedoGlobal +=
-          body[iBody].daAlbedoAnn[iLat] / body[iBody].iNumLats;
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    body[iBody].daTmpTempAnn[iLat] =
+          -(0.5 * (body[iBody].daTempTerms[iLat] +
+                   body[iBody].daSourceF[iLat]) +
+            body[iBody].daTempAnn[iLat] / dDelta_t);
   }
+  fvTridiagSolve(body[iBody].daMEulerAnn, body[iBody].daTmpTempAnn,
+                 body[iBody].iNumLats);
 }
 
 /**
-Calculates the OLR from the Haqq-Misra+ 2016 formulae
+Drops the iNumDrop oldest of the iNumHist stored Anderson differences. The
+others move to the front of the history, and the storage of the dropped
+ones to its end.
 
-@param body Struct containing all body information
+@param body Struct containing all body information and variables
 @param iBody Body in question
-@param iLat Latitude at which you want to calculate the OLR
-@param bModel Type of EBM (annual or seasonal)
+@param iNumHist Number of stored differences
+@param iNumDrop Number of differences to drop
 */
+void fvAndersonDropOldest(BODY *body, int iBody, int iNumHist, int iNumDrop) {
+  double *daTmpDF[ANDERSONDEPTH], *daTmpDG[ANDERSONDEPTH];
+  int iCol;
 
-
-double fdOLRhm16(BODY *body, int iBody, int iLat, int bModel) {
-  double phi, Int, tmpk, f, dT;
-
-  phi = log10(body[iBody].dpCO2);
-  if (bModel == ANN) {
-    dT = body[iBody].daTempAnn[iLat] + 273.15;
-  } else {
-    dT = body[iBody].daTempLW[iLat] + 273.15;
+  for (iCol = 0; iCol < iNumHist; iCol++) {
+    daTmpDF[iCol] = body[iBody].daAndersonDF[(iCol + iNumDrop) % iNumHist];
+    daTmpDG[iCol] = body[iBody].daAndersonDG[(iCol + iNumDrop) % iNumHist];
   }
-  if (dT > 150) {
-    tmpk = log10(dT);
-    f    = 9.12805643869791438760 * (tmpk * tmpk * tmpk * tmpk) +
-        4.58408794768168803557 * (tmpk * tmpk * tmpk) * phi -
-        8.47261075643147449910e+01 * (tmpk * tmpk * tmpk) +
-        4.35517381112690282752e-01 * (tmpk * phi * tmpk * phi) -
-        2.86355036260417961103e+01 * (tmpk * tmpk) * phi +
-        2.96626642498045896446e+02 * (tmpk * tmpk) -
-        6.01082900358299240806e-02 * tmpk * (phi * phi * phi) -
-        2.60414691486954641420 * tmpk * (phi * phi) +
-        5.69812976563675661623e+01 * tmpk * phi -
-        4.62596100127381816947e+02 * tmpk +
-        2.18159373001564722491e-03 * (phi * phi * phi * phi) +
-        1.61456772400726950023e-01 * (phi * phi * phi) +
-        3.75623788187470086797 * (phi * phi) -
-        3.53347289223180354156e+01 * phi + 2.75011005409836684521e+02;
-
-    Int = pow(10.0, f) / 1000.;
-  } else {
-    Int = SIGMA * dT * dT * dT * dT; // very cold brrr....
+  for (iCol = 0; iCol < iNumHist; iCol++) {
+    body[iBody].daAndersonDF[iCol] = daTmpDF[iCol];
+    body[iBody].daAndersonDG[iCol] = daTmpDG[iCol];
   }
-  return Int;
+}
+
+/**
+Least-squares mixing coefficients for Anderson acceleration. Factors the
+iNumHist columns of daAndersonDF as QR by modified Gram-Schmidt and solves
+R gamma = Q^T f. The newest difference is factored first, so when a column
+is nearly dependent on the newer ones, it and all older columns are dropped
+from the history and the newest secant information is kept.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param iNumHist Number of stored differences
+@return Number of differences used in daAndersonGamma
+*/
+int fiAndersonMixing(BODY *body, int iBody, int iNumHist) {
+  int iLat, iCol, jCol, iNumLats = body[iBody].iNumLats;
+  double dNorm, dDot, dColNorm;
+  double **daQ = body[iBody].daAndersonQ, **daR = body[iBody].daAndersonR;
+  double *daGamma = body[iBody].daAndersonGamma;
+
+  /* Column iCol of Q and R belongs to difference iNumHist - 1 - iCol */
+  for (iCol = 0; iCol < iNumHist; iCol++) {
+    dColNorm = 0.0;
+    for (iLat = 0; iLat < iNumLats; iLat++) {
+      daQ[iCol][iLat] = body[iBody].daAndersonDF[iNumHist - 1 - iCol][iLat];
+      dColNorm += daQ[iCol][iLat] * daQ[iCol][iLat];
+    }
+    for (jCol = 0; jCol < iCol; jCol++) {
+      dDot = 0.0;
+      for (iLat = 0; iLat < iNumLats; iLat++) {
+        dDot += daQ[jCol][iLat] * daQ[iCol][iLat];
+      }
+      daR[jCol][iCol] = dDot;
+      for (iLat = 0; iLat < iNumLats; iLat++) {
+        daQ[iCol][iLat] -= dDot * daQ[jCol][iLat];
+      }
+    }
+    dNorm = 0.0;
+    for (iLat = 0; iLat < iNumLats; iLat++) {
+      dNorm += daQ[iCol][iLat] * daQ[iCol][iLat];
+    }
+    dNorm = sqrt(dNorm);
+    if (dNorm <= 1e-10 * sqrt(dColNorm) || dNorm == 0) {
+      /* Ill-conditioned: keep only the iCol newest differences */
+      fvAndersonDropOldest(body, iBody, iNumHist, iNumHist - iCol);
+      iNumHist = iCol;
+      break;
+    }
+    daR[iCol][iCol] = dNorm;
+    for (iLat = 0; iLat < iNumLats; iLat++) {
+      daQ[iCol][iLat] /= dNorm;
+    }
+  }
+
+  for (iCol = iNumHist - 1; iCol >= 0; iCol--) {
+    dDot = 0.0;
+    for (iLat = 0; iLat < iNumLats; iLat++) {
+      dDot += daQ[iCol][iLat] * body[iBody].daAndersonF[iLat];
+    }
+    for (jCol = iCol + 1; jCol < iNumHist; jCol++) {
+      dDot -= daR[iCol][jCol] * daGamma[jCol];
+    }
+    daGamma[iCol] = dDot / daR[iCol][iCol];
+  }
+
+  /* Put the coefficients in the order of the history */
+  for (iCol = 0; iCol < iNumHist / 2; iCol++) {
+    dDot                         = daGamma[iCol];
+    daGamma[iCol]                = daGamma[iNumHist - 1 - iCol];
+    daGamma[iNumHist - 1 - iCol] = dDot;
+  }
+  return iNumHist;
+}
+
+/**
+Solves for the equilibrium of the annual EBM directly, applying Anderson
+acceleration to the pseudo-time step of fvAnnualFixedPointMap. Starts from
+the current daTempAnn, i.e. the previous equilibrium.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@return 1 if converged, 0 otherwise (temperatures are then restored)
+*/
+int fbPoiseAnnualAnderson(BODY *body, int iBody) {
+  int iIter, iLat, iCol, iNumHist = 0, iNumLats = body[iBody].iNumLats;
+  double dResidMax;
+
+  for (iLat = 0; iLat < iNumLats; iLat++) {
+    body[iBody].daTempAnnStart[iLat] = body[iBody].daTempAnn[iLat];
+  }
+
+  for (iIter = 0; iIter < ANDERSONMAXITER; iIter++) {
+    fvAnnualFixedPointMap(body, iBody);
+
+    dResidMax = 0.0;
+    for (iLat = 0; iLat < iNumLats; iLat++) {
+      body[iBody].daAndersonF[iLat] =
+            body[iBody].daTmpTempAnn[iLat] - body[iBody].daTempAnn[iLat];
+      if (!(fabs(body[iBody].daAndersonF[iLat]) <= dResidMax)) {
+        dResidMax = fabs(body[iBody].daAndersonF[iLat]);
+      }
+    }
+    if (!isfinite(dResidMax)) {
+      break;
+    }
+    if (dResidMax < ANDERSONTOL) {
+      for (iLat = 0; iLat < iNumLats; iLat++) {
+        body[iBody].daTempAnn[iLat] = body[iBody].daTmpTempAnn[iLat];
+      }
+      /* Leave the albedo, OLR and matrices consistent with the result */
+      fvAlbedoAnnual(body, iBody);
+      fvClimateParamsAnnual(body, iBody);
+      fvMatrixAnnual(body, iBody);
+      body[iBody].dTGlobal = 0.0;
+      for (iLat = 0; iLat < iNumLats; iLat++) {
+        body[iBody].dTGlobal +=
+              body[iBody].daTempAnn[iLat] / body[iBody].iNumLats;
+      }
+      return 1;
+    }
+
+    if (iIter > 0) {
+      if (iNumHist == ANDERSONDEPTH) {
+        /* Drop the oldest difference, reusing its storage */
+        fvAndersonDropOldest(body, iBody, iNumHist, 1);
+        iNumHist--;
+      }
+      for (iLat = 0; iLat < iNumLats; iLat++) {
+        body[iBody].daAndersonDF[iNumHist][iLat] =
+              body[iBody].daAndersonF[iLat] - body[iBody].daAndersonFOld[iLat];
+        body[iBody].daAndersonDG[iNumHist][iLat] =
+              body[iBody].daTmpTempAnn[iLat] - body[iBody].daAndersonGOld[iLat];
+      }
+      iNumHist++;
+    }
+    for (iLat = 0; iLat < iNumLats; iLat++) {
+      body[iBody].daAndersonFOld[iLat] = body[iBody].daAndersonF[iLat];
+      body[iBody].daAndersonGOld[iLat] = body[iBody].daTmpTempAnn[iLat];
+    }
+
+    /* Next iterate: the mixed map values of the recent iterates */
+    iNumHist = fiAndersonMixing(body, iBody, iNumHist);
+    for (iLat = 0; iLat < iNumLats; iLat++) {
+      body[iBody].daTempAnn[iLat] = body[iBody].daTmpTempAnn[iLat];
+      for (iCol = 0; iCol < iNumHist; iCol++) {
+        body[iBody].daTempAnn[iLat] -= body[iBody].daAndersonGamma[iCol] *
+                                       body[iBody].daAndersonDG[iCol][iLat];
+      }
+    }
+  }
+
+  for (iLat = 0; iLat < iNumLats; iLat++) {
+    body[iBody].daTempAnn[iLat] = body[iBody].daTempAnnStart[iLat];
+  }
+  return 0;
+}
+
+/**
+Runs the annual EBM, called from ForceBehavior. The annual EBM runs to
+steady-state (global temperature change becomes very small), rather than for a
+set number of orbits.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void PoiseAnnual(BODY *body, int iBody) {
+  double dDelta_x;
+  int iLat;
+
+  dDelta_x = 2.0 / body[iBody].iNumLats;
+
+  fvAnnualInsolation(body, iBody);
+  if (body[iBody].iAnnualSolver != ANNANDERSON ||
+      !fbPoiseAnnualAnderson(body, iBody)) {
+    fvPoiseAnnualRelax(body, iBody);
+  }
+
+  /* Calculate some interesting quantities */
+  body[iBody].dFluxInGlobal  = 0.0;
+  body[iBody].dFluxOutGlobal = 0.0;
+  body[iBody].dAlbedoGlobal  = 0.0;
+  body[iBody].dIceMassTot    = 0.0;
+  fvTempGradientAnn(body, dDelta_x, iBody);
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    body[iBody].daDMidPt[iLat] = 0.5 * (body[iBody].daDiffusionAnn[iLat + 1] +
+                                        body[iBody].daDiffusionAnn[iLat]);
+
+    body[iBody].daFlux[iLat] =
+          -2. * PI * (body[iBody].dRadius * body[iBody].dRadius) *
+          sqrt(1.0 - (sin(body[iBody].daLats[iLat]) *
+                      sin(body[iBody].daLats[iLat]))) *
+          body[iBody].daDMidPt[iLat] * body[iBody].daTGrad[iLat];
+
+    body[iBody].daFluxIn[iLat] = (1.0 - body[iBody].daAlbedoAnn[iLat]) *
+                                 body[iBody].daAnnualInsol[iLat];
+
+    body[iBody].daFluxOut[iLat] =
+          body[iBody].daPlanckAAnn[iLat] +
+          body[iBody].daPlanckBAnn[iLat] * body[iBody].daTempAnn[iLat];
+
+    body[iBody].dFluxInGlobal +=
+          body[iBody].daFluxIn[iLat] / body[iBody].iNumLats;
+
+    body[iBody].dFluxOutGlobal +=
+          body[iBody].daFluxOut[iLat] / body[iBody].iNumLats;
+
+    body[iBody].daDivFlux[iLat] = 0.0;
+    if (iLat > 0) {
+      body[iBody].daDivFlux[iLat] += -body[iBody].daMDiffAnn[iLat][0] *
+                                     body[iBody].daTempAnn[iLat - 1];
+    }
+    body[iBody].daDivFlux[iLat] +=
+          -body[iBody].daMDiffAnn[iLat][1] * body[iBody].daTempAnn[iLat];
+    if (iLat < body[iBody].iNumLats - 1) {
+      body[iBody].daDivFlux[iLat] += -body[iBody].daMDiffAnn[iLat][2] *
+                                     body[iBody].daTempAnn[iLat + 1];
+    }
+    body[iBody].dAlbedoGlobal +=
+          body[iBody].daAlbedoAnn[iLat] / body[iBody].iNumLats;
+  }
+}
+
+/**
+Catmull-Rom weights of the four nodes around a point in a uniform table
+
+@param dFrac Position of the point between the second and third nodes (0-1)
+@param daWeight Weights of the four nodes
+*/
+void fvCubicWeights(double dFrac, double *daWeight) {
+  daWeight[0] = dFrac * (-0.5 + dFrac * (1.0 - 0.5 * dFrac));
+  daWeight[1] = 1.0 + dFrac * dFrac * (-2.5 + 1.5 * dFrac);
+  daWeight[2] = dFrac * (0.5 + dFrac * (2.0 - 1.5 * dFrac));
+  daWeight[3] = dFrac * dFrac * (-0.5 + 0.5 * dFrac);
+}
+
+/**
+Locates a value in a uniform table of iNum intervals starting at dMin. The
+table holds one extra node on each side, so row iIndex of the table is the
+first of the four nodes used for the interpolation.
+
+@param dX Value to locate
+@param dMin First node of the table's range
+@param dStep Spacing of the nodes
+@param iNum Number of intervals in the table's range
+@param iIndex Interval containing dX
+@param dFrac Position of dX within that interval (0-1)
+@return 1 if dX lies in the table's range, 0 otherwise
+*/
+int fbRadTableIndex(double dX, double dMin, double dStep, int iNum,
+                    int *iIndex, double *dFrac) {
+  double dPos = (dX - dMin) / dStep;
+
+  if (!(dPos >= 0 && dPos <= iNum)) {
+    return 0;
+  }
+  *iIndex = (int)dPos;
+  if (*iIndex == iNum) {
+    (*iIndex)--;
+  }
+  *dFrac = dPos - *iIndex;
+  return 1;
+}
+
+/**
+Interpolates an OLR fit from the lookup tables
+
+@param body Struct containing all body information
+@param iBody Body in question
+@param iModel OLR model of the fit
+@param iTable RADTABLEOLR for the fit itself, RADTABLEOLRDT for its slope
+@param dT Temperature in K
+@param dValue Interpolated value
+@return 1 if the tables hold this fit at dT, 0 if it must be evaluated
+*/
+int fbOLRTable(BODY *body, int iBody, int iModel, int iTable, double dT,
+               double *dValue) {
+  int iIndex;
+  double dFrac, daWeight[4], *daTable;
+
+  if (!body[iBody].bRadTables || body[iBody].iOLRModel != iModel ||
+      !fbRadTableIndex(dT, OLRTABLETMIN, body[iBody].dOLRTableStep,
+                       body[iBody].iRadTableTemps, &iIndex, &dFrac)) {
+    return 0;
+  }
+  fvCubicWeights(dFrac, daWeight);
+  daTable = body[iBody].daOLRTable[iTable] + iIndex;
+  *dValue = daWeight[0] * daTable[0] + daWeight[1] * daTable[1] +
+            daWeight[2] * daTable[2] + daWeight[3] * daTable[3];
+  return 1;
+}
+
+/**
+Interpolates a top-of-atmosphere albedo fit from the lookup tables, which are
+two dimensional: temperature and zenith angle
+
+@param body Struct containing all body information
+@param iBody Body in question
+@param iPiece Temperature range of the fit (ALBTOACOLD or ALBTOAWARM)
+@param iSurf Surface type
+@param dTemp Temperature in Celsius
+@param zenith Zenith angle in radians
+@param dAlbedo Interpolated albedo
+@return 1 if the tables hold this fit at dTemp and zenith, 0 otherwise
+*/
+int fbAlbedoTOATable(BODY *body, int iBody, int iPiece, int iSurf,
+                     double dTemp, double zenith, double *dAlbedo) {
+  int iTemp, iZenith, i, iNumZeniths;
+  double dFracTemp, dFracZenith, daWTemp[4], daWZenith[4], *daRow;
+
+  if (!body[iBody].bRadTables ||
+      !fbRadTableIndex(dTemp, body[iBody].daAlbTOATableTMin[iPiece],
+                       body[iBody].daAlbTOATableStep[iPiece],
+                       body[iBody].iRadTableTemps, &iTemp, &dFracTemp) ||
+      !fbRadTableIndex(zenith, 0, body[iBody].dAlbTOATableZenStep,
+                       body[iBody].iRadTableZeniths, &iZenith, &dFracZenith)) {
+    return 0;
+  }
+  fvCubicWeights(dFracTemp, daWTemp);
+  fvCubicWeights(dFracZenith, daWZenith);
+
+  iNumZeniths = body[iBody].iRadTableZeniths + 3;
+  *dAlbedo    = 0;
+  for (i = 0; i < 4; i++) {
+    daRow = body[iBody].daAlbTOATable[iPiece * ALBSURFTYPES + iSurf] +
+            (iTemp + i) * iNumZeniths + iZenith;
+    *dAlbedo += daWTemp[i] *
+                (daWZenith[0] * daRow[0] + daWZenith[1] * daRow[1] +
+                 daWZenith[2] * daRow[2] + daWZenith[3] * daRow[3]);
+  }
+  return 1;
+}
+
+/**
+Tabulates the OLR fit of the body's OLR model (hm16 or wk97) and its slope
+between OLRTABLETMIN and OLRTABLETMAX, and the top-of-atmosphere albedo fits
+over each fit's temperature range and zenith angles of 0 to PI, for every
+surface type. pCO2 is fixed for the run, so the
+tables are built once for its value. Each table carries an extra node beyond
+both ends of its range, evaluated from the fit, so that the cubic
+interpolation needs no special case at the edges.
+
+@param body Struct containing all body information
+@param iBody Body in question
+*/
+void fvInitRadTables(BODY *body, int iBody) {
+  int iTemp, iZenith, iPiece, iSurf, iNumTemps, iNumZeniths;
+  double dT, zenith, *daTable;
+  /* Temperature ranges (Celsius) of the cold and warm TOA albedo fits */
+  double daHM16Range[ALBTOAPIECES + 1] = {-123.15, -23.15, 76.85};
+  double daWK97Range[ALBTOAPIECES + 1] = {-83.15, 6.85, 96.85};
+  double *daRange;
+
+  iNumTemps   = body[iBody].iRadTableTemps + 3;
+  iNumZeniths = body[iBody].iRadTableZeniths + 3;
+
+  body[iBody].dOLRTableStep =
+        (OLRTABLETMAX - OLRTABLETMIN) / body[iBody].iRadTableTemps;
+  body[iBody].daOLRTable = malloc(RADTABLESOLR * sizeof(double *));
+  body[iBody].daOLRTable[RADTABLEOLR]   = malloc(iNumTemps * sizeof(double));
+  body[iBody].daOLRTable[RADTABLEOLRDT] = malloc(iNumTemps * sizeof(double));
+  for (iTemp = 0; iTemp < iNumTemps; iTemp++) {
+    dT = OLRTABLETMIN + (iTemp - 1) * body[iBody].dOLRTableStep;
+    if (body[iBody].iOLRModel == WK97) {
+      body[iBody].daOLRTable[RADTABLEOLR][iTemp] =
+            fdOLRwk97Fit(dT, body[iBody].dpCO2);
+      body[iBody].daOLRTable[RADTABLEOLRDT][iTemp] =
+            fdOLRdTwk97Fit(dT, body[iBody].dpCO2);
+    } else {
+      body[iBody].daOLRTable[RADTABLEOLR][iTemp] =
+            fdOLRhm16Fit(dT, body[iBody].dpCO2);
+      body[iBody].daOLRTable[RADTABLEOLRDT][iTemp] =
+            fdOLRdThm16Fit(dT, body[iBody].dpCO2);
+    }
+  }
+
+  daRange = (body[iBody].iOLRModel == HM16) ? daHM16Range : daWK97Range;
+
+  body[iBody].dAlbTOATableZenStep = PI / body[iBody].iRadTableZeniths;
+  body[iBody].daAlbTOATableTMin   = malloc(ALBTOAPIECES * sizeof(double));
+  body[iBody].daAlbTOATableStep   = malloc(ALBTOAPIECES * sizeof(double));
+  body[iBody].daAlbTOATable =
+        malloc(ALBTOAPIECES * ALBSURFTYPES * sizeof(double *));
+  for (iPiece = 0; iPiece < ALBTOAPIECES; iPiece++) {
+    body[iBody].daAlbTOATableTMin[iPiece] = daRange[iPiece];
+    body[iBody].daAlbTOATableStep[iPiece] =
+          (daRange[iPiece + 1] - daRange[iPiece]) / body[iBody].iRadTableTemps;
+    for (iSurf = 0; iSurf < ALBSURFTYPES; iSurf++) {
+      daTable = malloc(iNumTemps * iNumZeniths * sizeof(double));
+      body[iBody].daAlbTOATable[iPiece * ALBSURFTYPES + iSurf] = daTable;
+      for (iTemp = 0; iTemp < iNumTemps; iTemp++) {
+        dT = daRange[iPiece] +
+             (iTemp - 1) * body[iBody].daAlbTOATableStep[iPiece];
+        for (iZenith = 0; iZenith < iNumZeniths; iZenith++) {
+          zenith = (iZenith - 1) * body[iBody].dAlbTOATableZenStep;
+          daTable[iTemp * iNumZeniths + iZenith] =
+                fdAlbedoTOAFit(body, iBody, iPiece, iSurf, dT, zenith);
+        }
+      }
+    }
+  }
+}
+
+/**
+Evaluates the Haqq-Misra+ 2016 fit to the OLR, valid above 150 K
+
+@param dT Temperature in K
+@param dpCO2 Atmospheric partial pressure of CO2
+@return OLR in W/m^2
+*/
+double fdOLRhm16Fit(double dT, double dpCO2) {
+  double phi, tmpk, f;
+
+  phi  = log10(dpCO2);
+  tmpk = log10(dT);
+  f    = 9.12805643869791438760 * (tmpk * tmpk * tmpk * tmpk) +
+      4.58408794768168803557 * (tmpk * tmpk * tmpk) * phi -
+      8.47261075643147449910e+01 * (tmpk * tmpk * tmpk) +
+      4.35517381112690282752e-01 * (tmpk * phi * tmpk * phi) -
+      2.86355036260417961103e+01 * (tmpk * tmpk) * phi +
+      2.96626642498045896446e+02 * (tmpk * tmpk) -
+      6.01082900358299240806e-02 * tmpk * (phi * phi * phi) -
+      2.60414691486954641420 * tmpk * (phi * phi) +
+      5.69812976563675661623e+01 * tmpk * phi -
+      4.62596100127381816947e+02 * tmpk +
+      2.18159373001564722491e-03 * (phi * phi * phi * phi) +
+      1.61456772400726950023e-01 * (phi * phi * phi) +
+      3.75623788187470086797 * (phi * phi) -
+      3.53347289223180354156e+01 * phi + 2.75011005409836684521e+02;
+
+  return pow(10.0, f) / 1000.;
+}
+
+/**
+Calculates the OLR from the Haqq-Misra+ 2016 formulae
+
+@param body Struct containing all body information
+@param iBody Body in question
+@param iLat Latitude at which you want to calculate the OLR
+@param bModel Type of EBM (annual or seasonal)
+*/
+
+
+double fdOLRhm16(BODY *body, int iBody, int iLat, int bModel) {
+  double Int, dT;
+
+  if (bModel == ANN) {
+    dT = body[iBody].daTempAnn[iLat] + 273.15;
+  } else {
+    dT = body[iBody].daTempLW[iLat] + 273.15;
+  }
+  if (dT > 150) {
+    if (!fbOLRTable(body, iBody, HM16, RADTABLEOLR, dT, &Int)) {
+      Int = fdOLRhm16Fit(dT, body[iBody].dpCO2);
+    }
+  } else {
+    Int = SIGMA * dT * dT * dT * dT; // very cold brrr....
+  }
+  return Int;
+}
+
+/**
+Evaluates the logarithmic slope, dlog(OLR)/dlog(T), of the Haqq-Misra+ 2016
+fit to the OLR
+
+@param dT Temperature in K
+@param dpCO2 Atmospheric partial pressure of CO2
+@return Logarithmic slope of the OLR
+*/
+double fdOLRdThm16Fit(double dT, double dpCO2) {
+  double phi, tmpk;
+
+  phi  = log10(dpCO2);
+  tmpk = log10(dT);
+  return 4 * 9.12805643869791438760 * (tmpk * tmpk * tmpk) +
+         3 * 4.58408794768168803557 * (tmpk * tmpk) * phi -
+         3 * 8.47261075643147449910e+01 * (tmpk * tmpk) +
+         2 * 4.35517381112690282752e-01 * tmpk * (phi * phi) -
+         2 * 2.86355036260417961103e+01 * tmpk * phi +
+         2 * 2.96626642498045896446e+02 * tmpk -
+         6.01082900358299240806e-02 * (phi * phi * phi) -
+         2.60414691486954641420 * (phi * phi) +
+         5.69812976563675661623e+01 * phi - 4.62596100127381816947e+02;
 }
 
 /**
@@ -6056,24 +7206,16 @@ Calculates the slope of the OLR from the Haqq-Misra+ 2016 formulae
 @param bModel Type of EBM (annual or seasonal)
 */
 double fdOLRdThm16(BODY *body, int iBody, int iLat, int bModel) {
-  double phi, dI, tmpk, f, dT;
+  double dI, f, dT;
 
-  phi = log10(body[iBody].dpCO2);
   if (bModel == ANN) {
     dT = body[iBody].daTempAnn[iLat] + 273.15;
   } else {
     dT = body[iBody].daTempLW[iLat] + 273.15;
   }
-  tmpk = log10(dT);
-  f    = 4 * 9.12805643869791438760 * (tmpk * tmpk * tmpk) +
-      3 * 4.58408794768168803557 * (tmpk * tmpk) * phi -
-      3 * 8.47261075643147449910e+01 * (tmpk * tmpk) +
-      2 * 4.35517381112690282752e-01 * tmpk * (phi * phi) -
-      2 * 2.86355036260417961103e+01 * tmpk * phi +
-      2 * 2.96626642498045896446e+02 * tmpk -
-      6.01082900358299240806e-02 * (phi * phi * phi) -
-      2.60414691486954641420 * (phi * phi) + 5.69812976563675661623e+01 * phi -
-      4.62596100127381816947e+02;
+  if (!fbOLRTable(body, iBody, HM16, RADTABLEOLRDT, dT, &f)) {
+    f = fdOLRdThm16Fit(dT, body[iBody].dpCO2);
+  }
   dI = fdOLRhm16(body, iBody, iLat, bModel) * f /
        (body[iBody].daTempLW[iLat] + 273.15);
 
@@ -6130,6 +7272,33 @@ double fdOLRdTsms09(BODY *body, int iBody, int iLat, int bModel) {
   return dI;
 }
 
+/**
+Evaluates the Williams & Kasting 1997 polynomial fit to the OLR, before it is
+capped or replaced by a blackbody at low temperature
+
+@param T Temperature in K
+@param dpCO2 Atmospheric partial pressure of CO2
+@return OLR in W/m^2
+*/
+double fdOLRwk97Fit(double T, double dpCO2) {
+  double phi;
+  // phi = normalized log partial pressure of CO2
+  phi = log(dpCO2 / 3.3e-4);
+  return 9.468980 - 7.714727e-5 * phi - 2.794778 * T - 3.244753e-3 * phi * T -
+         3.547406e-4 * (phi * phi) + 2.212108e-2 * (T * T) +
+         2.229142e-3 * (phi * phi) * T + 3.088497e-5 * phi * (T * T) -
+         2.789815e-5 * (phi * T * phi * T) - 3.442973e-3 * (phi * phi * phi) -
+         3.361939e-5 * (T * T * T) + 9.173169e-3 * (phi * phi * phi) * T -
+         7.775195e-5 * (phi * phi * phi) * (T * T) -
+         1.679112e-7 * phi * (T * T * T) +
+         6.590999e-8 * (phi * phi) * (T * T * T) +
+         1.528125e-7 * (phi * phi * phi) * (T * T * T) -
+         3.367567e-2 * (phi * phi * phi * phi) -
+         1.631909e-4 * (phi * phi * phi * phi) * T +
+         3.663871e-6 * (phi * phi * phi * phi) * (T * T) -
+         9.255646e-9 * (phi * phi * phi * phi) * (T * T * T);
+}
+
 /**
 Calculates the OLR from the Williams & Kasting 1997 formulae
 
@@ -6139,29 +7308,17 @@ Calculates the OLR from the Williams & Kasting 1997 formulae
 @param bModel Type of EBM (annual or seasonal)
 */
 double fdOLRwk97(BODY *body, int iBody, int iLat, int bModel) {
-  double phi, Int, T;
+  double Int, T;
   // T = temp
   // Int = OLR
-  // phi = normalized log partial pressure of CO2
-  phi = log(body[iBody].dpCO2 / 3.3e-4);
   if (bModel == ANN) {
     T = body[iBody].daTempAnn[iLat] + 273.15;
   } else {
     T = body[iBody].daTempLW[iLat] + 273.15;
   }
-  Int = 9.468980 - 7.714727e-5 * phi - 2.794778 * T - 3.244753e-3 * phi * T -
-        3.547406e-4 * (phi * phi) + 2.212108e-2 * (T * T) +
-        2.229142e-3 * (phi * phi) * T + 3.088497e-5 * phi * (T * T) -
-        2.789815e-5 * (phi * T * phi * T) - 3.442973e-3 * (phi * phi * phi) -
-        3.361939e-5 * (T * T * T) + 9.173169e-3 * (phi * phi * phi) * T -
-        7.775195e-5 * (phi * phi * phi) * (T * T) -
-        1.679112e-7 * phi * (T * T * T) +
-        6.590999e-8 * (phi * phi) * (T * T * T) +
-        1.528125e-7 * (phi * phi * phi) * (T * T * T) -
-        3.367567e-2 * (phi * phi * phi * phi) -
-        1.631909e-4 * (phi * phi * phi * phi) * T +
-        3.663871e-6 * (phi * phi * phi * phi) * (T * T) -
-        9.255646e-9 * (phi * phi * phi * phi) * (T * T * T);
+  if (!fbOLRTable(body, iBody, WK97, RADTABLEOLR, T, &Int)) {
+    Int = fdOLRwk97Fit(T, body[iBody].dpCO2);
+  }
   if (Int >= 300) {
     Int = 300.0;
   }
@@ -6171,6 +7328,30 @@ double fdOLRwk97(BODY *body, int iBody, int iLat, int bModel) {
   return Int;
 }
 
+/**
+Evaluates the slope of the Williams & Kasting 1997 polynomial fit to the OLR
+
+@param T Temperature in K
+@param dpCO2 Atmospheric partial pressure of CO2
+@return Slope of the OLR in W/m^2/K
+*/
+double fdOLRdTwk97Fit(double T, double dpCO2) {
+  double phi;
+
+  phi = log(dpCO2 / 3.3e-4);
+  return -2.794778 + 2 * 2.212108e-2 * T - 3 * 3.361939e-5 * (T * T) -
+         3.244753e-3 * phi + 2 * 3.088497e-5 * phi * T -
+         3 * 1.679112e-7 * phi * (T * T) + 2.229142e-3 * (phi * phi) -
+         2 * 2.789815e-5 * (phi * phi) * T +
+         3 * 6.590999e-8 * (phi * phi) * (T * T) +
+         9.173169e-3 * (phi * phi * phi) -
+         2 * 7.775195e-5 * (phi * phi * phi) * T +
+         3 * 1.528125e-7 * (phi * phi * phi) * (T * T) -
+         1.631909e-4 * (phi * phi * phi * phi) +
+         2 * 3.663871e-6 * (phi * phi * phi * phi) * T -
+         3 * 9.255646e-9 * (phi * phi * phi * phi) * (T * T);
+}
+
 /**
 Calculates the slope of the  OLR from the Williams & Kasting 1997 formulae
 
@@ -6180,9 +7361,8 @@ Calculates the slope of the  OLR from the Williams & Kasting 1997 formulae
 @param bModel Type of EBM (annual or seasonal)
 */
 double fdOLRdTwk97(BODY *body, int iBody, int iLat, int bModel) {
-  double phi, dI, T;
+  double dI, T;
 
-  phi = log(body[iBody].dpCO2 / 3.3e-4);
   if (bModel == ANN) {
     // printf("%lf\n",body[iBody].daTempAnn[iLat]);
     T = body[iBody].daTempAnn[iLat] + 273.15;
@@ -6190,17 +7370,9 @@ double fdOLRdTwk97(BODY *body, int iBody, int iLat, int bModel) {
     // MEM: body[iBody].daTempLW[iLat] is not initialized!
     T = body[iBody].daTempLW[iLat] + 273.15;
   }
-  dI = -2.794778 + 2 * 2.212108e-2 * T - 3 * 3.361939e-5 * (T * T) -
-       3.244753e-3 * phi + 2 * 3.088497e-5 * phi * T -
-       3 * 1.679112e-7 * phi * (T * T) + 2.229142e-3 * (phi * phi) -
-       2 * 2.789815e-5 * (phi * phi) * T +
-       3 * 6.590999e-8 * (phi * phi) * (T * T) +
-       9.173169e-3 * (phi * phi * phi) -
-       2 * 7.775195e-5 * (phi * phi * phi) * T +
-       3 * 1.528125e-7 * (phi * phi * phi) * (T * T) -
-       1.631909e-4 * (phi * phi * phi * phi) +
-       2 * 3.663871e-6 * (phi * phi * phi * phi) * T -
-       3 * 9.255646e-9 * (phi * phi * phi * phi) * (T * T);
+  if (!fbOLRTable(body, iBody, WK97, RADTABLEOLRDT, T, &dI)) {
+    dI = fdOLRdTwk97Fit(T, body[iBody].dpCO2);
+  }
   if (fdOLRwk97(body, iBody, iLat, bModel) >= 300.0) {
     dI = 0.001;
   }
@@ -6379,6 +7551,78 @@ double AlbedoTaylor(double zenith) {
   }
 }
 
+/**
+Returns the surface albedo that the top-of-atmosphere fits are evaluated with
+
+@param body Struct containing all body information
+@param iBody Body in question
+@param iSurf Surface type (ALBSURFICE, ALBSURFLAND, ALBSURFMIX or ALBSURFOCEAN)
+@param zenith Zenith angle in radians
+@return Surface albedo
+*/
+double fdAlbedoTOASurf(BODY *body, int iBody, int iSurf, double zenith) {
+  if (iSurf == ALBSURFICE) {
+    return body[iBody].dIceAlbedo;
+  } else if (iSurf == ALBSURFLAND) {
+    return body[iBody].dAlbedoLand;
+  } else if (iSurf == ALBSURFMIX) {
+    return (body[iBody].dIceAlbedo + body[iBody].dAlbedoLand) / 2.0;
+  }
+  return AlbedoTaylor(zenith);
+}
+
+/**
+Evaluates the top-of-atmosphere albedo fit of the body's OLR model (hm16 or
+wk97)
+
+@param body Struct containing all body information
+@param iBody Body in question
+@param iPiece Temperature range of the fit (ALBTOACOLD or ALBTOAWARM)
+@param iSurf Surface type
+@param dTemp Temperature in Celsius
+@param zenith Zenith angle in radians
+@return TOA albedo
+*/
+double fdAlbedoTOAFit(BODY *body, int iBody, int iPiece, int iSurf,
+                      double dTemp, double zenith) {
+  double phi, albtmp;
+
+  albtmp = fdAlbedoTOASurf(body, iBody, iSurf, zenith);
+  if (body[iBody].iOLRModel == HM16) {
+    phi = log10(body[iBody].dpCO2);
+    if (iPiece == ALBTOACOLD) {
+      return AlbedoTOA250(dTemp, phi, zenith, albtmp);
+    }
+    return fdAlbedoTOA350(dTemp, phi, zenith, albtmp);
+  }
+  if (iPiece == ALBTOACOLD) {
+    return AlbedoTOA280(dTemp, body[iBody].dpCO2, zenith, albtmp);
+  }
+  return AlbedoTOA370(dTemp, body[iBody].dpCO2, zenith, albtmp);
+}
+
+/**
+Returns the top-of-atmosphere albedo, from the lookup tables if they are
+enabled and cover dTemp and zenith, and from the fit otherwise
+
+@param body Struct containing all body information
+@param iBody Body in question
+@param iPiece Temperature range of the fit (ALBTOACOLD or ALBTOAWARM)
+@param iSurf Surface type
+@param dTemp Temperature in Celsius
+@param zenith Zenith angle in radians
+@return TOA albedo
+*/
+double fdAlbedoTOA(BODY *body, int iBody, int iPiece, int iSurf, double dTemp,
+                   double zenith) {
+  double dAlbedo;
+
+  if (fbAlbedoTOATable(body, iBody, iPiece, iSurf, dTemp, zenith, &dAlbedo)) {
+    return dAlbedo;
+  }
+  return fdAlbedoTOAFit(body, iBody, iPiece, iSurf, dTemp, zenith);
+}
+
 /**
 Calculates the planetary albedo based on the formulae from Haqq-Misra+ 2016,
 accounting for temperature and surface type.
@@ -6389,29 +7633,29 @@ accounting for temperature and surface type.
 @param iLat Latitude cell in question
 */
 void AlbedoTOAhm16(BODY *body, double zenith, int iBody, int iLat) {
-
-  double phi, albtmp;
-  phi = log10(body[iBody].dpCO2);
+  int iSurf;
 
   if (body[iBody].daIceMassTmp[iLat] > 0 ||
       body[iBody].daTempLand[iLat] <= -10) {
 
-    albtmp = body[iBody].dIceAlbedo;
+    iSurf = ALBSURFICE;
 
   } else {
 
-    albtmp = body[iBody].dAlbedoLand;
+    iSurf = ALBSURFLAND;
   }
 
   if (body[iBody].daTempLand[iLat] <= (-23.15)) {
 
     body[iBody].daAlbedoLand[iLat] =
-          AlbedoTOA250(body[iBody].daTempLand[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOACOLD, iSurf,
+                      body[iBody].daTempLand[iLat], zenith);
 
   } else if (body[iBody].daTempLand[iLat] <= 76.85) {
 
     body[iBody].daAlbedoLand[iLat] =
-          fdAlbedoTOA350(body[iBody].daTempLand[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOAWARM, iSurf,
+                      body[iBody].daTempLand[iLat], zenith);
 
   } else {
 
@@ -6419,19 +7663,21 @@ void AlbedoTOAhm16(BODY *body, double zenith, int iBody, int iLat) {
   }
 
   if (body[iBody].daTempWater[iLat] <= body[iBody].dFrzTSeaIce) {
-    albtmp = body[iBody].dIceAlbedo;
+    iSurf = ALBSURFICE;
   } else {
-    albtmp = AlbedoTaylor(zenith);
+    iSurf = ALBSURFOCEAN;
   }
 
   if (body[iBody].daTempWater[iLat] <= (-23.15)) {
 
     body[iBody].daAlbedoWater[iLat] =
-          AlbedoTOA250(body[iBody].daTempWater[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOACOLD, iSurf,
+                      body[iBody].daTempWater[iLat], zenith);
   } else if (body[iBody].daTempWater[iLat] <= 76.85) {
 
     body[iBody].daAlbedoWater[iLat] =
-          fdAlbedoTOA350(body[iBody].daTempWater[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOAWARM, iSurf,
+                      body[iBody].daTempWater[iLat], zenith);
   } else {
     // albedo asymptotes to ~0.18 (all surface albedos?)
     body[iBody].daAlbedoWater[iLat] = 0.18;
@@ -6449,38 +7695,39 @@ Calculates the planetary albedo based on the formulae from Williams & Kasting
 @param iLat Latitude cell in question
 */
 void AlbedoTOAwk97(BODY *body, double zenith, int iBody, int iLat) {
-  double phi, albtmp;
-  phi = body[iBody].dpCO2;
+  int iSurf;
 
   if (body[iBody].daTempLand[iLat] <= -10) {
 
-    albtmp = body[iBody].dIceAlbedo;
+    iSurf = ALBSURFICE;
 
   } else if (body[iBody].daTempLand[iLat] > -10 &&
              body[iBody].daIceMassTmp[iLat] > 0) {
 
-    albtmp = (body[iBody].dIceAlbedo + body[iBody].dAlbedoLand) / 2.0;
+    iSurf = ALBSURFMIX;
 
   } else if (body[iBody].daTempLand[iLat] <= 0 &&
              body[iBody].daIceMassTmp[iLat] == 0) {
 
-    albtmp = (body[iBody].dIceAlbedo + body[iBody].dAlbedoLand) / 2.0;
+    iSurf = ALBSURFMIX;
 
   } else {
 
-    albtmp = body[iBody].dAlbedoLand;
+    iSurf = ALBSURFLAND;
   }
 
   if (body[iBody].daTempLand[iLat] >= -83.15 &&
       body[iBody].daTempLand[iLat] <= (6.85)) {
 
     body[iBody].daAlbedoLand[iLat] =
-          AlbedoTOA280(body[iBody].daTempLand[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOACOLD, iSurf,
+                      body[iBody].daTempLand[iLat], zenith);
 
   } else if (body[iBody].daTempLand[iLat] <= 96.85) {
 
     body[iBody].daAlbedoLand[iLat] =
-          AlbedoTOA370(body[iBody].daTempLand[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOAWARM, iSurf,
+                      body[iBody].daTempLand[iLat], zenith);
 
   } else if (body[iBody].daTempLand[iLat] < -83.15) {
 
@@ -6492,23 +7739,25 @@ void AlbedoTOAwk97(BODY *body, double zenith, int iBody, int iLat) {
 
   if (body[iBody].daTempWater[iLat] <= body[iBody].dFrzTSeaIce) {
 
-    albtmp = body[iBody].dIceAlbedo;
+    iSurf = ALBSURFICE;
 
   } else {
 
-    albtmp = AlbedoTaylor(zenith);
+    iSurf = ALBSURFOCEAN;
   }
 
   if (body[iBody].daTempWater[iLat] >= -83.15 &&
       body[iBody].daTempWater[iLat] <= (6.85)) {
 
     body[iBody].daAlbedoWater[iLat] =
-          AlbedoTOA280(body[iBody].daTempWater[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOACOLD, iSurf,
+                      body[iBody].daTempWater[iLat], zenith);
 
   } else if (body[iBody].daTempWater[iLat] <= 96.85) {
 
     body[iBody].daAlbedoWater[iLat] =
-          AlbedoTOA370(body[iBody].daTempWater[iLat], phi, zenith, albtmp);
+          fdAlbedoTOA(body, iBody, ALBTOAWARM, iSurf,
+                      body[iBody].daTempWater[iLat], zenith);
 
   } else if (body[iBody].daTempWater[iLat] < -83.15) {
 
@@ -6559,7 +7808,10 @@ void fvAlbedoSeasonal(BODY *body, int iBody, int iDay) {
   int iLat;
   double dZenith;
 
-  body[iBody].dAlbedoGlobalTmp = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(dZenith) \
+      if (body[iBody].iNumLats >= POISEPARALLELLATS)
+#endif
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     // zenith angle of sun at noon at each latitude
     dZenith = fabs(body[iBody].daLats[iLat] - body[iBody].daDeclination[iDay]);
@@ -6594,7 +7846,10 @@ void fvAlbedoSeasonal(BODY *body, int iBody, int iDay) {
     body[iBody].daAlbedoLW[iLat] =
           body[iBody].daLandFrac[iLat] * body[iBody].daAlbedoLand[iLat] +
           body[iBody].daWaterFrac[iLat] * body[iBody].daAlbedoWater[iLat];
+  }
 
+  body[iBody].dAlbedoGlobalTmp = 0;
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     body[iBody].dAlbedoGlobalTmp +=
           body[iBody].daAlbedoLW[iLat] / body[iBody].iNumLats;
   }
@@ -6610,7 +7865,7 @@ only). This slows the EBM considerably so use with caution.
 @param iBody Body in question
 */
 void fvSeaIce(BODY *body, int iBody) {
-  int iLat, jLat;
+  int iLat, jLat, jLatMin, jLatMax;
   double dNhicearea, dShicearea, dNhtotarea, dShtotarea;
   double dNhfw, dShfw, dNhdW, dShdW, dCw_dt;
   dNhicearea = 0;
@@ -6621,11 +7876,9 @@ void fvSeaIce(BODY *body, int iBody) {
   dCw_dt = (body[iBody].dHeatCapWater * body[iBody].dMeanMotion / (2 * PI)) /
            body[iBody].dSeasDeltat;
 
-  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daMEulerSea[iLat][jLat] = body[iBody].daMInit[iLat][jLat];
-    }
-  }
+  /* The sea ice terms replace the plain factors of fvMatrixSeasonal */
+  fvMatrixBandSeasonal(body, iBody);
+  body[iBody].bMatrixSeaFactored = 0;
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     if (body[iBody].daTempWater[iLat] <= body[iBody].dFrzTSeaIce) {
@@ -6637,7 +7890,7 @@ void fvSeaIce(BODY *body, int iBody) {
               body[iBody].daSeaIceK[iLat] * body[iBody].dFrzTSeaIce -
               body[iBody].daSourceW[iLat];
 
-        body[iBody].daMEulerSea[2 * iLat + 1][2 * iLat + 1] +=
+        body[iBody].daMEulerSea[2 * iLat + 1][SEABANDLO] +=
               -dCw_dt + body[iBody].daSeaIceK[iLat];
 
       } else {
@@ -6645,15 +7898,8 @@ void fvSeaIce(BODY *body, int iBody) {
       }
     }
   }
-  fvMatrixInvertSeasonal(body, iBody);
-
-  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    body[iBody].daTmpTempSea[iLat] = 0.0;
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daTmpTempSea[iLat] +=
-            body[iBody].daInvMSea[iLat][jLat] * body[iBody].daSourceLW[jLat];
-    }
-  }
+  fvMatrixFactorSeasonal(body, iBody);
+  fvMatrixSolveSeasonal(body, iBody);
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     // temp change this time step
@@ -6679,7 +7925,10 @@ void fvSeaIce(BODY *body, int iBody) {
                   (body[iBody].daTmpTempSea[2 * iLat + 1] -
                    body[iBody].daTempLand[iLat]);
 
-      for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
+      /* daMDiffSea is tridiagonal */
+      jLatMin = (iLat > 0) ? iLat - 1 : 0;
+      jLatMax = (iLat < body[iBody].iNumLats - 1) ? iLat + 1 : iLat;
+      for (jLat = jLatMin; jLat <= jLatMax; jLat++) {
         body[iBody].daFluxSeaIce[iLat] +=
               body[iBody].daMDiffSea[iLat][jLat] *
               body[iBody].daTmpTempSea[2 * jLat + 1];
@@ -6715,30 +7964,112 @@ void fvSeaIce(BODY *body, int iBody) {
   dShdW = dShfw * dShicearea / (dShtotarea - dShicearea) / dCw_dt;
 
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-    if (body[iBody].daSeaIceHeight[iLat] > 0) {
-      if (body[iBody].daLats[iLat] >= 0) {
-        body[iBody].daFluxSeaIce[iLat] += dNhfw;
-      } else {
-        body[iBody].daFluxSeaIce[iLat] += dShfw;
-      }
+    if (body[iBody].daSeaIceHeight[iLat] > 0) {
+      if (body[iBody].daLats[iLat] >= 0) {
+        body[iBody].daFluxSeaIce[iLat] += dNhfw;
+      } else {
+        body[iBody].daFluxSeaIce[iLat] += dShfw;
+      }
+    } else {
+      if (body[iBody].daLats[iLat] >= 0) {
+        body[iBody].daTempWater[iLat] -= dNhdW;
+      } else {
+        body[iBody].daTempWater[iLat] -= dShdW;
+      }
+    }
+  }
+}
+
+/**
+Stores one input of a cached matrix.
+
+@param daKey Inputs the matrix was last formed with
+@param iKey Index of the input
+@param dValue Current value of the input
+@return 1 if the input differs from the stored one, 0 otherwise
+*/
+int fbMatrixKeyUpdate(double *daKey, int iKey, double dValue) {
+  if (daKey[iKey] == dValue) {
+    return 0;
+  }
+  daKey[iKey] = dValue;
+  return 1;
+}
+
+/**
+Checks whether the inputs of the seasonal EBM matrix have changed since it
+was last formed: the heat capacities per time step, the land-water coupling,
+the diffusion coefficients, the land fractions and the Planck B values.
+Records the current inputs.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@return 1 if the matrix must be formed again, 0 otherwise
+*/
+int fbMatrixSeasonalChanged(BODY *body, int iBody) {
+  int iLat, iKey = 0, bChanged;
+  double *daKey = body[iBody].daMatrixKeySea;
+
+  bChanged = !body[iBody].bMatrixKeySeaSet;
+  bChanged |= fbMatrixKeyUpdate(daKey, iKey++,
+                                body[iBody].dHeatCapLand *
+                                      body[iBody].dMeanMotion / (2 * PI) /
+                                      body[iBody].dSeasDeltat);
+  bChanged |= fbMatrixKeyUpdate(daKey, iKey++,
+                                body[iBody].dHeatCapWater *
+                                      body[iBody].dMeanMotion / (2 * PI) /
+                                      body[iBody].dSeasDeltat);
+  bChanged |= fbMatrixKeyUpdate(daKey, iKey++, body[iBody].dNuLandWater);
+  bChanged |= fbMatrixKeyUpdate(daKey, iKey++, body[iBody].dSeasDeltax);
+  for (iLat = 0; iLat < body[iBody].iNumLats + 1; iLat++) {
+    bChanged |= fbMatrixKeyUpdate(daKey, iKey++,
+                                  body[iBody].daDiffusionSea[iLat]);
+  }
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    bChanged |=
+          fbMatrixKeyUpdate(daKey, iKey++, body[iBody].daLandFrac[iLat]);
+    bChanged |=
+          fbMatrixKeyUpdate(daKey, iKey++, body[iBody].daWaterFrac[iLat]);
+    if (body[iBody].bAccuracyMode) {
+      bChanged |=
+            fbMatrixKeyUpdate(daKey, iKey++, body[iBody].daPlanckBSea[iLat]);
     } else {
-      if (body[iBody].daLats[iLat] >= 0) {
-        body[iBody].daTempWater[iLat] -= dNhdW;
-      } else {
-        body[iBody].daTempWater[iLat] -= dShdW;
-      }
+      bChanged |=
+            fbMatrixKeyUpdate(daKey, iKey++, body[iBody].daPlanckBAvg[iLat]);
     }
   }
+  body[iBody].bMatrixKeySeaSet = 1;
+  return bChanged;
 }
 
 /**
-Calculates the backwards-Euler matrix that integrates the seasonal EBM. Each
-operation of the inverse matrix is a "time-step".
+Provides the factored backwards-Euler matrix that integrates the seasonal
+EBM. Forming and factoring are skipped when neither the matrix inputs nor
+the factors have changed since the last call.
 
 @param body Struct containing all body information and variables
 @param iBody Body in question
 */
 void fvMatrixSeasonal(BODY *body, int iBody) {
+  if (fbMatrixSeasonalChanged(body, iBody)) {
+    fvMatrixFormSeasonal(body, iBody);
+    body[iBody].bMatrixSeaFactored = 0;
+  }
+  if (!body[iBody].bMatrixSeaFactored) {
+    fvMatrixBandSeasonal(body, iBody);
+    fvMatrixFactorSeasonal(body, iBody);
+    body[iBody].bMatrixSeaFactored = 1;
+  }
+}
+
+/**
+Forms the backwards-Euler matrix that integrates the seasonal EBM. Each
+solve with the matrix is a "time-step".
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvMatrixFormSeasonal(BODY *body, int iBody) {
   int iLat, jLat;
   double dXBoundary, dNu_fl, dNu_fw, dCl_dt, dCw_dt;
 
@@ -6809,16 +8140,6 @@ void fvMatrixSeasonal(BODY *body, int iBody) {
             body[iBody].daMWater[iLat][jLat];
     }
   }
-
-  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daMEulerSea[iLat][jLat] = body[iBody].daMInit[iLat][jLat];
-      body[iBody].daMEulerCopySea[iLat][jLat] =
-            body[iBody].daMEulerCopySea[iLat][jLat];
-    }
-  }
-
-  fvMatrixInvertSeasonal(body, iBody);
 }
 
 /**
@@ -6872,6 +8193,10 @@ void EnergyResiduals(BODY *body, int iBody, int iNday) {
   dCw_dt = body[iBody].dHeatCapWater * body[iBody].dMeanMotion / (2 * PI) /
            body[iBody].dSeasDeltat;
 
+#ifdef _OPENMP
+#pragma omp parallel for private(dNu_fl, dNu_fw) \
+      if (body[iBody].iNumLats >= POISEPARALLELLATS)
+#endif
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     dNu_fl = body[iBody].dNuLandWater / body[iBody].daLandFrac[iLat];
     dNu_fw = body[iBody].dNuLandWater / body[iBody].daWaterFrac[iLat];
@@ -7005,7 +8330,6 @@ void fvCalcPlanckAB(BODY *body, int iBody, int iLat) {
   body[iBody].daTempLW[iLat] =
         body[iBody].daLandFrac[iLat] * body[iBody].daTempLand[iLat] +
         body[iBody].daWaterFrac[iLat] * body[iBody].daTempWater[iLat];
-  body[iBody].dTGlobalTmp += body[iBody].daTempLW[iLat] / body[iBody].iNumLats;
 
   if (body[iBody].bCalcAB) {
     if (body[iBody].iOLRModel == WK97) {
@@ -7027,35 +8351,39 @@ void fvCalcPlanckAB(BODY *body, int iBody, int iLat) {
             fdOLRsms09(body, iBody, iLat, SEA) -
             body[iBody].daPlanckBSea[iLat] * (body[iBody].daTempLW[iLat]);
     }
+  }
+}
 
-    // XXX This section doesn't seem releated to calculating A and B,
-    // but was part of this if-else originally
-
-    if (body[iBody].bMEPDiff) {
-      if (iLat == 0) {
-        body[iBody].daDiffusionSea[iLat] = body[iBody].daPlanckBSea[iLat] / 4.0;
-
-      } else if (iLat == (body[iBody].iNumLats - 1)) {
-        body[iBody].daDiffusionSea[iLat] =
-              (body[iBody].daPlanckBSea[iLat] +
-               body[iBody].daPlanckBSea[iLat - 1]) /
-              8.0;
+/**
+Sets the diffusion coefficients at the cell edges from the Planck B
+coefficients of the neighbouring cells (maximum entropy production). Needs B
+at every latitude, so it runs after fvCalcPlanckAB has covered them all.
 
-        body[iBody].daDiffusionSea[iLat + 1] =
-              body[iBody].daPlanckBSea[iLat] / 4.0;
+@param body Struct containing all body information and variables
+@param iBody Body in question
+*/
+void fvMEPDiffusion(BODY *body, int iBody) {
+  int iLat, iNumLats;
 
-      } else {
-        body[iBody].daDiffusionSea[iLat] =
-              (body[iBody].daPlanckBSea[iLat] +
-               body[iBody].daPlanckBSea[iLat - 1]) /
-              8.0;
-      }
-    }
+  iNumLats = body[iBody].iNumLats;
+  body[iBody].daDiffusionSea[0] = body[iBody].daPlanckBSea[0] / 4.0;
+  for (iLat = 1; iLat < iNumLats; iLat++) {
+    body[iBody].daDiffusionSea[iLat] = (body[iBody].daPlanckBSea[iLat] +
+                                        body[iBody].daPlanckBSea[iLat - 1]) /
+                                       8.0;
   }
+  body[iBody].daDiffusionSea[iNumLats] =
+        body[iBody].daPlanckBSea[iNumLats - 1] / 4.0;
 }
 
 void fvFluxesByLatitude(BODY *body, int iBody, int iNyear, int iNstep) {
-  for (int iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+  int iLat, jLat, jLatMin, jLatMax;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(jLat, jLatMin, jLatMax) \
+      if (body[iBody].iNumLats >= POISEPARALLELLATS)
+#endif
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
     body[iBody].daDMidPt[iLat] = 0.5 * (body[iBody].daDiffusionSea[iLat + 1] +
                                         body[iBody].daDiffusionSea[iLat]);
     body[iBody].daFlux[iLat] =
@@ -7069,7 +8397,10 @@ void fvFluxesByLatitude(BODY *body, int iBody, int iNyear, int iNstep) {
           body[iBody].daFlux[iLat];
 
     body[iBody].daDivFlux[iLat] = 0.0;
-    for (int jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
+    /* daMDiffSea is tridiagonal */
+    jLatMin = (iLat > 0) ? iLat - 1 : 0;
+    jLatMax = (iLat < body[iBody].iNumLats - 1) ? iLat + 1 : iLat;
+    for (jLat = jLatMin; jLat <= jLatMax; jLat++) {
       body[iBody].daDivFlux[iLat] +=
             -body[iBody].daMDiffSea[iLat][jLat] * body[iBody].daTempLW[jLat];
     }
@@ -7192,8 +8523,6 @@ void fvCalculateFluxesByLatitude(BODY *body, int iBody, int iLat, int iNday) {
   body[iBody].daFluxOut[iLat] =
         body[iBody].daLandFrac[iLat] * body[iBody].daFluxOutLand[iLat] +
         body[iBody].daWaterFrac[iLat] * body[iBody].daFluxOutWater[iLat];
-  body[iBody].dFluxOutGlobalTmp +=
-        body[iBody].daFluxOut[iLat] / body[iBody].iNumLats;
 
   body[iBody].daFluxInLand[iLat] = (1.0 - body[iBody].daAlbedoLand[iLat]) *
                                    body[iBody].daInsol[iLat][iNday];
@@ -7202,8 +8531,6 @@ void fvCalculateFluxesByLatitude(BODY *body, int iBody, int iLat, int iNday) {
   body[iBody].daFluxIn[iLat] =
         body[iBody].daLandFrac[iLat] * body[iBody].daFluxInLand[iLat] +
         body[iBody].daWaterFrac[iLat] * body[iBody].daFluxInWater[iLat];
-  body[iBody].dFluxInGlobalTmp +=
-        body[iBody].daFluxIn[iLat] / body[iBody].iNumLats;
 }
 
 void fvPoiseGlobalProps(BODY *body, int iBody) {
@@ -7214,25 +8541,66 @@ void fvPoiseGlobalProps(BODY *body, int iBody) {
         body[iBody].dFluxInGlobalTmp / (body[iBody].iNStepInYear);
 }
 
-void fvFinishSeaIce(BODY *body, double dStepsize, int iBody, int iLat,
-                    int iNyear, int iNday, int iNstep) {
-  fvSnowball(body, iBody);
-  // ice growth/ablation
-  if (body[iBody].bIceSheets) {
-    fvCalculateIceSheets(body, dStepsize, iBody, iLat, iNstep);
+/**
+Finishes a step of the seasonal EBM once the new temperatures are known:
+ice sheet growth, outgoing radiation coefficients, fluxes and the running
+averages at every latitude. The latitudes are independent of one another, so
+the loop is shared among threads in parallel builds; the global sums are
+taken afterwards in latitude order so they do not depend on the thread count.
+The snowball state each latitude sees is set beforehand in iaSnowballLat.
+
+@param body Struct containing all body information and variables
+@param dStepsize Time step of the seasonal model
+@param iBody Body in question
+@param iNyear Current orbit
+@param iNday Day of the year
+@param iNstep Step within the orbit
+*/
+void fvFinishSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
+                    int iNday, int iNstep) {
+  int iLat;
+
+#ifdef _OPENMP
+#pragma omp parallel for if (body[iBody].iNumLats >= POISEPARALLELLATS)
+#endif
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    // ice growth/ablation
+    if (body[iBody].bIceSheets) {
+      fvCalculateIceSheets(body, dStepsize, iBody, iLat, iNstep);
+    }
+
+    fvCalcPlanckAB(body, iBody, iLat);
+    fvCalculateFluxesByLatitude(body, iBody, iLat, iNday);
+    fvPoiseAnnualAveragesByLatitude(body, iBody, iLat);
+    fvPoiseDailyProps(body, iBody, iLat, iNyear, iNstep);
+    fvPoiseSeasonalMinMax(body, iBody, iLat);
+  }
+
+  if (body[iBody].bCalcAB && body[iBody].bMEPDiff) {
+    fvMEPDiffusion(body, iBody);
   }
+  body[iBody].bSnowball = body[iBody].iaSnowballLat[body[iBody].iNumLats - 1];
 
-  fvCalcPlanckAB(body, iBody, iLat);
-  fvCalculateFluxesByLatitude(body, iBody, iLat, iNday);
-  fvPoiseAnnualAveragesByLatitude(body, iBody, iLat);
-  fvPoiseDailyProps(body, iBody, iLat, iNyear, iNstep);
-  fvPoiseSeasonalMinMax(body, iBody, iLat);
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    body[iBody].dTGlobalTmp +=
+          body[iBody].daTempLW[iLat] / body[iBody].iNumLats;
+    body[iBody].dFluxOutGlobalTmp +=
+          body[iBody].daFluxOut[iLat] / body[iBody].iNumLats;
+    body[iBody].dFluxInGlobalTmp +=
+          body[iBody].daFluxIn[iLat] / body[iBody].iNumLats;
+  }
 }
 
 void fvCalculateSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
                        int iNday, int iNstep) {
+  int iLat, iNumFrozen = 0;
+
   fvSeaIce(body, iBody);
-  for (int iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    iNumFrozen += fbSnowballLat(body, iBody, iLat);
+  }
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    iNumFrozen -= fbSnowballLat(body, iBody, iLat);
     if (body[iBody].daSeaIceHeight[iLat] > 0) {
       // adjust height of present sea ice
       body[iBody].daSeaIceHeight[iLat] -= body[iBody].dSeasDeltat /
@@ -7251,23 +8619,25 @@ void fvCalculateSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
               (body[iBody].daTempWater[iLat] - body[iBody].dFrzTSeaIce);
       }
     }
-
-    fvFinishSeaIce(body, dStepsize, iBody, iLat, iNyear, iNday, iNstep);
+    /* Counts the ice of this and all earlier latitudes after their update */
+    iNumFrozen += fbSnowballLat(body, iBody, iLat);
+    body[iBody].iaSnowballLat[iLat] = (iNumFrozen == body[iBody].iNumLats);
   }
+  fvFinishSeaIce(body, dStepsize, iBody, iNyear, iNday, iNstep);
 }
 
 void fvStaticSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
                     int iNday, int iNstep) {
-  int iLat, jLat;
+  int iLat, iNumFrozen = 0;
 
-  for (iLat = 0; iLat < 2 * body[iBody].iNumLats; iLat++) {
-    body[iBody].daTmpTempSea[iLat] = 0.0;
-    for (jLat = 0; jLat < 2 * body[iBody].iNumLats; jLat++) {
-      body[iBody].daTmpTempSea[iLat] +=
-            body[iBody].daInvMSea[iLat][jLat] * body[iBody].daSourceLW[jLat];
-    }
+  fvMatrixSolveSeasonal(body, iBody);
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    iNumFrozen += fbSnowballLat(body, iBody, iLat);
   }
   for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    /* Earlier latitudes count with this step's maximum water temperature */
+    body[iBody].iaSnowballLat[iLat] = (iNumFrozen == body[iBody].iNumLats);
+    iNumFrozen -= fbSnowballLat(body, iBody, iLat);
     // temp change this time step
     body[iBody].daDeltaTempL[iLat] =
           body[iBody].daTmpTempSea[2 * iLat] - body[iBody].daTempLand[iLat];
@@ -7276,8 +8646,102 @@ void fvStaticSeaIce(BODY *body, double dStepsize, int iBody, int iNyear,
     // calculate temperature and fluxes by latitude and global average
     body[iBody].daTempLand[iLat]  = body[iBody].daTmpTempSea[2 * iLat];
     body[iBody].daTempWater[iLat] = body[iBody].daTmpTempSea[2 * iLat + 1];
+    iNumFrozen +=
+          (body[iBody].daTempMaxWater[iLat] <= body[iBody].dFrzTSeaIce &&
+           body[iBody].daTempWater[iLat] <= body[iBody].dFrzTSeaIce);
+  }
+  fvFinishSeaIce(body, dStepsize, iBody, iNyear, iNday, iNstep);
+}
+
+/**
+Checks whether the seasonal cycle has become periodic: every temperature of
+the orbit just finished is within dSeasPeriodTol of the previous orbit, and
+so is the land warming that one step of the difference in ice balance would
+cause through latent heat. Keeps this orbit's ice balance for the next check.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param iNyear Orbit just finished
+@param dStepsize Time step of the seasonal model
+@return 1 if the cycle is periodic, 0 otherwise
+*/
+int fbSeasonalPeriodic(BODY *body, int iBody, int iNyear, double dStepsize) {
+  int iLat, iNstep, iDay, bPeriodic;
+  double dIceToTemp;
+
+  bPeriodic = (iNyear > 0);
+  for (iLat = 0; iLat < body[iBody].iNumLats && bPeriodic; iLat++) {
+    for (iNstep = 0; iNstep < body[iBody].iNStepInYear; iNstep++) {
+      iDay = iNyear * body[iBody].iNStepInYear + iNstep;
+      if (!(fabs(body[iBody].daTempDaily[iLat][iDay] -
+                 body[iBody].daTempDaily[iLat][iDay -
+                                               body[iBody].iNStepInYear]) <=
+            body[iBody].dSeasPeriodTol)) {
+        bPeriodic = 0;
+        break;
+      }
+    }
+  }
+
+  if (body[iBody].bIceSheets) {
+    dIceToTemp = dStepsize * LFICE / body[iBody].dHeatCapLand;
+    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+      for (iNstep = 0; iNstep < body[iBody].iNStepInYear; iNstep++) {
+        if (bPeriodic &&
+            !(fabs(body[iBody].daIceBalance[iLat][iNstep] -
+                   body[iBody].daIceBalancePrev[iLat][iNstep]) *
+                    dIceToTemp <=
+              body[iBody].dSeasPeriodTol)) {
+          bPeriodic = 0;
+        }
+        body[iBody].daIceBalancePrev[iLat][iNstep] =
+              body[iBody].daIceBalance[iLat][iNstep];
+      }
+    }
+  }
+  return bPeriodic;
+}
+
+/**
+Fills in the orbits after a periodic one, which the seasonal model skips: the
+daily output repeats that orbit, and the ice accumulation and ablation, which
+are averaged over iNumYears orbits, are rescaled to the orbits actually run.
+
+@param body Struct containing all body information and variables
+@param iBody Body in question
+@param iNyear Last orbit run
+*/
+void fvSeasonalRepeatYear(BODY *body, int iBody, int iNyear) {
+  int iLat, iNstep, iYear, iFrom, iTo;
+  double dScale;
+
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    for (iYear = iNyear + 1; iYear < body[iBody].iNumYears; iYear++) {
+      for (iNstep = 0; iNstep < body[iBody].iNStepInYear; iNstep++) {
+        iFrom = iNyear * body[iBody].iNStepInYear + iNstep;
+        iTo   = iYear * body[iBody].iNStepInYear + iNstep;
+        body[iBody].daTempDaily[iLat][iTo] =
+              body[iBody].daTempDaily[iLat][iFrom];
+        body[iBody].daFluxDaily[iLat][iTo] =
+              body[iBody].daFluxDaily[iLat][iFrom];
+        body[iBody].daFluxInDaily[iLat][iTo] =
+              body[iBody].daFluxInDaily[iLat][iFrom];
+        body[iBody].daFluxOutDaily[iLat][iTo] =
+              body[iBody].daFluxOutDaily[iLat][iFrom];
+        body[iBody].daDivFluxDaily[iLat][iTo] =
+              body[iBody].daDivFluxDaily[iLat][iFrom];
+        body[iBody].daPlanckBDaily[iLat][iTo] =
+              body[iBody].daPlanckBDaily[iLat][iFrom];
+      }
+    }
+  }
 
-    fvFinishSeaIce(body, dStepsize, iBody, iLat, iNyear, iNday, iNstep);
+  if (body[iBody].bIceSheets) {
+    dScale = (double)body[iBody].iNumYears / (iNyear + 1);
+    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+      body[iBody].daIceAccumTot[iLat] *= dScale;
+      body[iBody].daIceAblateTot[iLat] *= dScale;
+    }
   }
 }
 
@@ -7290,7 +8754,7 @@ to be in "equilibrium" though not in "steady-state".
 @param iBody Body in question
 */
 void PoiseSeasonal(BODY *body, int iBody) {
-  int iLat, jLat, iNstep, iNyear, iNday;
+  int iLat, iNstep, iNyear, iNday, bPeriodic = 0;
   double dStepsize;
 
   dStepsize = 2 * PI / body[iBody].dMeanMotion / body[iBody].iNStepInYear;
@@ -7331,6 +8795,11 @@ void PoiseSeasonal(BODY *body, int iBody) {
       }
     }
 
+    if (body[iBody].dSeasPeriodTol > 0 &&
+        iNyear < (body[iBody].iNumYears - 1)) {
+      bPeriodic = fbSeasonalPeriodic(body, iBody, iNyear, dStepsize);
+    }
+
     if (body[iBody].bIceSheets) {
       for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
         if (iNyear != 0) {
@@ -7348,14 +8817,20 @@ void PoiseSeasonal(BODY *body, int iBody) {
                 (body[iBody].iNumYears * 2 * PI / body[iBody].dMeanMotion);
           // above gets yearly average over NumYears
         }
-        if (iNyear != (body[iBody].iNumYears - 1)) {
+        if (iNyear != (body[iBody].iNumYears - 1) && !bPeriodic) {
           body[iBody].daIceBalanceAnnual[iLat] +=
                 dStepsize / 2. * (body[iBody].daIceBalance[iLat][iNstep - 1]) /
                 (body[iBody].iNumYears * 2 * PI / body[iBody].dMeanMotion);
         }
       }
     }
+
+    if (bPeriodic) {
+      fvSeasonalRepeatYear(body, iBody, iNyear);
+      break;
+    }
   }
+  body[iBody].iNumYearsRun = bPeriodic ? iNyear + 1 : body[iBody].iNumYears;
 }
 
 /**
@@ -7393,7 +8868,7 @@ double fdIceMassBalance(BODY *body, int iBody, int iLat) {
            ((Tice * Tice * Tice * Tice) - ((dTs) * (dTs) * (dTs) * (dTs))) /
            LFICE;
   } else {
-    if (body[iBody].bSnowball) {
+    if (body[iBody].iaSnowballLat[iLat]) {
       /* no precip once planet is frozen */
       dTmp = 0.0;
     } else {
@@ -7446,6 +8921,374 @@ void IceSheetTriDiag(BODY *body, int iBody) {
   }
 }
 
+/**
+Advances the ice sheets by one Crank-Nicolson step
+
+@param body Struct containing body information
+@param evolve Struct containing evolution information
+@param iBody Body in question
+@param IceTime Time at the start of the step
+@param IceDt Length of the step
+@param Aice Deformability of ice
+@param dGrav Surface gravity
+*/
+void fvIceSheetStep(BODY *body, EVOLVE *evolve, int iBody, double IceTime,
+                    double IceDt, double Aice, double dGrav) {
+  int iLat, jLat;
+  double deltax, dHdt;
+
+  fvSnowball(body, iBody);
+  /* first, get ice balances */
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    if (body[iBody].daIceMass[iLat] <= 0 &&
+        body[iBody].daIceBalanceAnnual[iLat] < 0.0) {
+
+      body[iBody].daIceBalanceTmp[iLat] = 0;
+    } else if (body[iBody].dIceMassTot >= MOCEAN &&
+               body[iBody].daIceBalanceAnnual[iLat] > 0.0) {
+
+      body[iBody].daIceBalanceTmp[iLat] = 0;
+    } else {
+      body[iBody].daIceBalanceTmp[iLat] =
+            body[iBody].daIceBalanceAnnual[iLat] / RHOICE;
+    }
+    if (body[iBody].bSnowball == 1) {
+      body[iBody].daIceBalanceTmp[iLat] = 0;
+    }
+  }
+
+  deltax = 2.0 / body[iBody].iNumLats;
+
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    /* calculate derivative to 2nd order accuracy */
+    if (iLat == 0) {
+      body[iBody].daDIceHeightDy[iLat] =
+            sqrt(1.0 - (body[iBody].daXBoundary[iLat + 1] *
+                        body[iBody].daXBoundary[iLat + 1])) *
+            (body[iBody].daIceHeight[iLat + 1] +
+             body[iBody].daBedrockH[iLat + 1] -
+             body[iBody].daIceHeight[iLat] - body[iBody].daBedrockH[iLat]) /
+            (body[iBody].dRadius * deltax);
+    } else if (iLat == (body[iBody].iNumLats - 1)) {
+      body[iBody].daDIceHeightDy[iLat] =
+            sqrt(1.0 - (body[iBody].daXBoundary[iLat] *
+                        body[iBody].daXBoundary[iLat])) *
+            (body[iBody].daIceHeight[iLat] + body[iBody].daBedrockH[iLat] -
+             body[iBody].daIceHeight[iLat - 1] -
+             body[iBody].daBedrockH[iLat - 1]) /
+            (body[iBody].dRadius * deltax);
+    } else {
+      body[iBody].daDIceHeightDy[iLat] =
+            (sqrt(1.0 - (body[iBody].daXBoundary[iLat + 1] *
+                         body[iBody].daXBoundary[iLat + 1])) *
+                   (body[iBody].daIceHeight[iLat + 1] +
+                    body[iBody].daBedrockH[iLat + 1] -
+                    body[iBody].daIceHeight[iLat] -
+                    body[iBody].daBedrockH[iLat]) /
+                   (body[iBody].dRadius * deltax) +
+             sqrt(1.0 - (body[iBody].daXBoundary[iLat] *
+                         body[iBody].daXBoundary[iLat])) *
+                   (body[iBody].daIceHeight[iLat] +
+                    body[iBody].daBedrockH[iLat] -
+                    body[iBody].daIceHeight[iLat - 1] -
+                    body[iBody].daBedrockH[iLat - 1]) /
+                   (body[iBody].dRadius * deltax)) /
+            2.0;
+    }
+
+    body[iBody].daIceFlow[iLat] =
+          2 * Aice * pow(RHOICE * dGrav, nGLEN) / (nGLEN + 2.0) *
+          pow(fabs(body[iBody].daDIceHeightDy[iLat]), nGLEN - 1) *
+          pow(body[iBody].daIceHeight[iLat] + body[iBody].daBedrockH[iLat],
+              nGLEN + 2);
+    body[iBody].daSedShear[iLat] = RHOICE * dGrav *
+                                   body[iBody].daIceHeight[iLat] *
+                                   body[iBody].daDIceHeightDy[iLat];
+    body[iBody].daBasalFlow[iLat] = fdBasalFlow(body, iBody, iLat);
+  }
+
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    if (IceTime != evolve->dTime) {
+      body[iBody].daIceSheetDiff[iLat] =
+            -0.5 * (body[iBody].daIceFlowMid[iLat] +
+                    body[iBody].daBasalFlowMid[iLat]);
+      if (iLat == body[iBody].iNumLats - 1) {
+        body[iBody].daIceSheetDiff[iLat + 1] =
+              -0.5 * (body[iBody].daIceFlowMid[iLat + 1] +
+                      body[iBody].daBasalFlowMid[iLat + 1]);
+      }
+    }
+
+    if (iLat == 0) {
+      body[iBody].daIceFlowMid[iLat]   = 0;
+      body[iBody].daBasalFlowMid[iLat] = 0;
+    } else if (iLat == body[iBody].iNumLats - 1) {
+      body[iBody].daIceFlowMid[iLat] = (body[iBody].daIceFlow[iLat] +
+                                        body[iBody].daIceFlow[iLat - 1]) /
+                                       2.0;
+      body[iBody].daIceFlowMid[iLat + 1] = 0;
+      body[iBody].daBasalFlowMid[iLat] =
+            (body[iBody].daBasalFlow[iLat] +
+             body[iBody].daBasalFlow[iLat - 1]) /
+            2.0;
+      body[iBody].daBasalFlowMid[iLat + 1] = 0;
+    } else {
+      body[iBody].daIceFlowMid[iLat] = (body[iBody].daIceFlow[iLat] +
+                                        body[iBody].daIceFlow[iLat - 1]) /
+                                       2.0;
+      body[iBody].daBasalFlowMid[iLat] =
+            (body[iBody].daBasalFlow[iLat] +
+             body[iBody].daBasalFlow[iLat - 1]) /
+            2.0;
+    }
+
+    if (IceTime == evolve->dTime) {
+      body[iBody].daIceSheetDiff[iLat] = body[iBody].daIceFlowMid[iLat];
+      if (iLat == body[iBody].iNumLats - 1) {
+        body[iBody].daIceSheetDiff[iLat + 1] =
+              body[iBody].daIceFlowMid[iLat + 1];
+      }
+      body[iBody].daIcePropsTmp[iLat] =
+            body[iBody].daIceHeight[iLat] +
+            body[iBody].daIceBalanceTmp[iLat] * IceDt;
+    } else {
+      body[iBody].daIceSheetDiff[iLat] +=
+            1.5 * (body[iBody].daIceFlowMid[iLat] +
+                   body[iBody].daBasalFlowMid[iLat]);
+      if (iLat == body[iBody].iNumLats - 1) {
+        body[iBody].daIceSheetDiff[iLat + 1] +=
+              1.5 * (body[iBody].daIceFlowMid[iLat + 1] +
+                     body[iBody].daBasalFlowMid[iLat + 1]);
+      }
+    }
+  }
+
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
+      if (jLat == iLat) {
+        body[iBody].daIceSheetMat[iLat][jLat] =
+              1.0 + 0.5 * IceDt *
+                          (body[iBody].daIceSheetDiff[iLat] /
+                                 (body[iBody].daYBoundary[iLat] *
+                                  body[iBody].daYBoundary[iLat]) +
+                           body[iBody].daIceSheetDiff[iLat + 1] /
+                                 (body[iBody].daYBoundary[iLat + 1] *
+                                  body[iBody].daYBoundary[iLat + 1]));
+        // superdiagonal
+      } else if (jLat == iLat + 1) {
+        body[iBody].daIceSheetMat[iLat][jLat] =
+              -0.5 * IceDt * body[iBody].daIceSheetDiff[jLat] /
+              (body[iBody].daYBoundary[jLat] *
+               body[iBody].daYBoundary[jLat]);
+        // subdiagonal
+      } else if (jLat == iLat - 1) {
+        body[iBody].daIceSheetMat[iLat][jLat] =
+              -0.5 * IceDt * body[iBody].daIceSheetDiff[iLat] /
+              (body[iBody].daYBoundary[iLat] *
+               body[iBody].daYBoundary[iLat]);
+      } else {
+        body[iBody].daIceSheetMat[iLat][jLat] = 0.0;
+      }
+    }
+    if (IceTime != evolve->dTime) {
+      if (iLat == 0) {
+        body[iBody].daIcePropsTmp[iLat] =
+              body[iBody].daIceBalanceTmp[iLat] * IceDt +
+              (1 - 0.5 * IceDt *
+                         (body[iBody].daIceSheetDiff[iLat + 1] /
+                          (body[iBody].daYBoundary[iLat + 1] *
+                           body[iBody].daYBoundary[iLat + 1]))) *
+                    body[iBody].daIceHeight[iLat] +
+              0.5 * IceDt * body[iBody].daIceSheetDiff[iLat + 1] *
+                    body[iBody].daIceHeight[iLat + 1] /
+                    (body[iBody].daYBoundary[iLat + 1] *
+                     body[iBody].daYBoundary[iLat + 1]);
+
+      } else if (iLat == body[iBody].iNumLats - 1) {
+        body[iBody].daIcePropsTmp[iLat] =
+              body[iBody].daIceBalanceTmp[iLat] * IceDt +
+              (1 - 0.5 * IceDt *
+                         (body[iBody].daIceSheetDiff[iLat] /
+                          (body[iBody].daYBoundary[iLat] *
+                           body[iBody].daYBoundary[iLat]))) *
+                    body[iBody].daIceHeight[iLat] +
+              0.5 * IceDt * body[iBody].daIceSheetDiff[iLat] *
+                    body[iBody].daIceHeight[iLat - 1] /
+                    (body[iBody].daYBoundary[iLat] *
+                     body[iBody].daYBoundary[iLat]);
+      } else {
+        body[iBody].daIcePropsTmp[iLat] =
+              body[iBody].daIceBalanceTmp[iLat] * IceDt +
+              (1 - 0.5 * IceDt *
+                         (body[iBody].daIceSheetDiff[iLat] /
+                                (body[iBody].daYBoundary[iLat] *
+                                 body[iBody].daYBoundary[iLat]) +
+                          body[iBody].daIceSheetDiff[iLat + 1] /
+                                (body[iBody].daYBoundary[iLat + 1] *
+                                 body[iBody].daYBoundary[iLat + 1]))) *
+                    body[iBody].daIceHeight[iLat] +
+              0.5 * IceDt * body[iBody].daIceSheetDiff[iLat + 1] *
+                    body[iBody].daIceHeight[iLat + 1] /
+                    (body[iBody].daYBoundary[iLat + 1] *
+                     body[iBody].daYBoundary[iLat + 1]) +
+              0.5 * IceDt * body[iBody].daIceSheetDiff[iLat] *
+                    body[iBody].daIceHeight[iLat - 1] /
+                    (body[iBody].daYBoundary[iLat] *
+                     body[iBody].daYBoundary[iLat]);
+      }
+    }
+  }
+
+  IceSheetTriDiag(body, iBody);
+  for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+    body[iBody].daIceMass[iLat] = body[iBody].daIceHeight[iLat] * RHOICE;
+    if (body[iBody].daIceMass[iLat] < 1e-30) {
+      body[iBody].daIceMass[iLat]   = 0.0;
+      body[iBody].daIceHeight[iLat] = 0.0;
+    }
+    body[iBody].daIceBalanceAvg[iLat] +=
+          body[iBody].daIceBalanceTmp[iLat] * IceDt / evolve->dCurrentDt;
+    if (iLat == 0) {
+      body[iBody].daIceFlowAvg[iLat] +=
+            body[iBody].daIceSheetDiff[iLat + 1] *
+            (body[iBody].daIceHeight[iLat + 1] -
+             body[iBody].daIceHeight[iLat]) /
+            (body[iBody].daYBoundary[iLat + 1] *
+             body[iBody].daYBoundary[iLat + 1]) *
+            IceDt / evolve->dCurrentDt;
+    } else if (iLat == body[iBody].iNumLats - 1) {
+      body[iBody].daIceFlowAvg[iLat] +=
+            -body[iBody].daIceSheetDiff[iLat] *
+            (body[iBody].daIceHeight[iLat] -
+             body[iBody].daIceHeight[iLat - 1]) /
+            (body[iBody].daYBoundary[iLat] *
+             body[iBody].daYBoundary[iLat]) *
+            IceDt / evolve->dCurrentDt;
+    } else {
+      body[iBody].daIceFlowAvg[iLat] +=
+            (body[iBody].daIceSheetDiff[iLat + 1] *
+                   (body[iBody].daIceHeight[iLat + 1] -
+                    body[iBody].daIceHeight[iLat]) /
+                   (body[iBody].daYBoundary[iLat + 1] *
+                    body[iBody].daYBoundary[iLat + 1]) -
+             body[iBody].daIceSheetDiff[iLat] *
+                   (body[iBody].daIceHeight[iLat] -
+                    body[iBody].daIceHeight[iLat - 1]) /
+                   (body[iBody].daYBoundary[iLat] *
+                    body[iBody].daYBoundary[iLat])) *
+            IceDt / evolve->dCurrentDt;
+    }
+    dHdt = 1. / (BROCKTIME * YEARSEC) *
+           (body[iBody].daBedrockHEq[iLat] - body[iBody].daBedrockH[iLat] -
+            RHOICE * body[iBody].daIceHeight[iLat] / RHOBROCK);
+    body[iBody].daBedrockH[iLat] += dHdt * IceDt;
+  }
+}
+
+/**
+Copies (bSave = 1) or restores (bSave = 0) the ice sheet state that a step
+changes: heights, masses, bedrock, the flows at the cell edges that the next
+step extrapolates from, and the averages over the outer step.
+
+@param body Struct containing body information
+@param iBody Body in question
+@param bSave Whether to save the state or restore it
+*/
+void fvIceSheetState(BODY *body, int iBody, int bSave) {
+  double *daState[ICESTATEVARS];
+  int iVar, iLat, iNum;
+
+  daState[0] = body[iBody].daIceHeight;
+  daState[1] = body[iBody].daIceMass;
+  daState[2] = body[iBody].daBedrockH;
+  daState[3] = body[iBody].daIceBalanceAvg;
+  daState[4] = body[iBody].daIceFlowAvg;
+  daState[5] = body[iBody].daIceFlowMid;
+  daState[6] = body[iBody].daBasalFlowMid;
+
+  for (iVar = 0; iVar < ICESTATEVARS; iVar++) {
+    /* The edge flows have a value at each of the N+1 cell boundaries */
+    iNum = body[iBody].iNumLats + (iVar >= 5);
+    for (iLat = 0; iLat < iNum; iLat++) {
+      if (bSave) {
+        body[iBody].daIceSheetSave[iVar][iLat] = daState[iVar][iLat];
+      } else {
+        daState[iVar][iLat] = body[iBody].daIceSheetSave[iVar][iLat];
+      }
+    }
+  }
+}
+
+/**
+Takes one ice sheet step of adaptive length. The step is checked by step
+doubling: one Crank-Nicolson step is compared with two of half the length,
+and the two half steps are kept if no ice height differs by more than
+dIceHeightTol. Otherwise the step is retried shorter. The next step is
+scaled from the error, which is third order in the step for Crank-Nicolson.
+
+@param body Struct containing body information
+@param evolve Struct containing evolution information
+@param iBody Body in question
+@param IceTime Time at the start of the step
+@param Aice Deformability of ice
+@param dGrav Surface gravity
+@return Length of the step taken
+*/
+double fdIceSheetAdaptiveStep(BODY *body, EVOLVE *evolve, int iBody,
+                              double IceTime, double Aice, double dGrav) {
+  int iLat, bLast;
+  double IceDt, dErr, dScale, dMinDt, dEnd;
+
+  dEnd   = evolve->dTime + evolve->dCurrentDt;
+  dMinDt = ICEDTMIN * 2 * PI / body[iBody].dMeanMotion;
+  if (body[iBody].dIceDtAdapt <= 0) {
+    body[iBody].dIceDtAdapt =
+          body[iBody].iIceTimeStep * 2 * PI / body[iBody].dMeanMotion;
+  }
+  fvIceSheetState(body, iBody, 1);
+
+  while (1) {
+    IceDt = body[iBody].dIceDtAdapt;
+    bLast = (IceTime + IceDt >= dEnd);
+    if (bLast) {
+      IceDt = dEnd - IceTime;
+    }
+
+    fvIceSheetStep(body, evolve, iBody, IceTime, IceDt, Aice, dGrav);
+    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+      body[iBody].daIceHeightFull[iLat] = body[iBody].daIceHeight[iLat];
+    }
+    fvIceSheetState(body, iBody, 0);
+    fvIceSheetStep(body, evolve, iBody, IceTime, 0.5 * IceDt, Aice, dGrav);
+    fvIceSheetStep(body, evolve, iBody, IceTime + 0.5 * IceDt, 0.5 * IceDt,
+                   Aice, dGrav);
+
+    dErr = 0;
+    for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
+      dErr = fmax(dErr, fabs(body[iBody].daIceHeight[iLat] -
+                             body[iBody].daIceHeightFull[iLat]));
+    }
+
+    if (dErr > 0) {
+      dScale = 0.9 * pow(body[iBody].dIceHeightTol / dErr, 1. / 3);
+    } else {
+      dScale = ICEDTGROW;
+    }
+    dScale = fmin(fmax(dScale, ICEDTSHRINK), ICEDTGROW);
+
+    if (dErr <= body[iBody].dIceHeightTol || IceDt <= dMinDt) {
+      /* A step cut short by the end of the outer step says nothing
+         about the step the ice can take */
+      if (!bLast || dScale < 1) {
+        body[iBody].dIceDtAdapt = fmax(IceDt * dScale, dMinDt);
+      }
+      return IceDt;
+    }
+    fvIceSheetState(body, iBody, 0);
+    body[iBody].dIceDtAdapt = fmax(IceDt * dScale, dMinDt);
+  }
+}
+
 /**
 Main ice sheet routine. Integrates the ice sheets via Crank-Nicholson method in
 ForceBehavior in the same fashion as Huybers' model.
@@ -7457,9 +9300,9 @@ ForceBehavior in the same fashion as Huybers' model.
 void PoiseIceSheets(BODY *body, EVOLVE *evolve, int iBody) {
   /* integrate ice sheets via Crank-Nicholson method in ForceBehavior
      in the same way Huybers' model works */
-  int iLat, jLat, skip;
+  int iLat, skip;
   double IceTime, IceDt, RunSeasNext;
-  double deltax, Tice, Aice, dGrav, dHdt;
+  double Tice, Aice, dGrav;
   IceTime = evolve->dTime;
   Tice    = 270;
   skip    = 1;
@@ -7499,256 +9342,15 @@ void PoiseIceSheets(BODY *body, EVOLVE *evolve, int iBody) {
 
   if (skip == 0) {
     while (IceTime < evolve->dTime + evolve->dCurrentDt) {
-      if (IceTime + IceDt > evolve->dTime + evolve->dCurrentDt) {
-        // ice time step carries past start of next RK time step
-        IceDt = evolve->dTime + evolve->dCurrentDt - IceTime;
-      }
-
-      fvSnowball(body, iBody);
-      /* first, get ice balances */
-      for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-        if (body[iBody].daIceMass[iLat] <= 0 &&
-            body[iBody].daIceBalanceAnnual[iLat] < 0.0) {
-
-          body[iBody].daIceBalanceTmp[iLat] = 0;
-        } else if (body[iBody].dIceMassTot >= MOCEAN &&
-                   body[iBody].daIceBalanceAnnual[iLat] > 0.0) {
-
-          body[iBody].daIceBalanceTmp[iLat] = 0;
-        } else {
-          body[iBody].daIceBalanceTmp[iLat] =
-                body[iBody].daIceBalanceAnnual[iLat] / RHOICE;
-        }
-        if (body[iBody].bSnowball == 1) {
-          body[iBody].daIceBalanceTmp[iLat] = 0;
-        }
-      }
-
-      deltax = 2.0 / body[iBody].iNumLats;
-
-      for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-        /* calculate derivative to 2nd order accuracy */
-        if (iLat == 0) {
-          body[iBody].daDIceHeightDy[iLat] =
-                sqrt(1.0 - (body[iBody].daXBoundary[iLat + 1] *
-                            body[iBody].daXBoundary[iLat + 1])) *
-                (body[iBody].daIceHeight[iLat + 1] +
-                 body[iBody].daBedrockH[iLat + 1] -
-                 body[iBody].daIceHeight[iLat] - body[iBody].daBedrockH[iLat]) /
-                (body[iBody].dRadius * deltax);
-        } else if (iLat == (body[iBody].iNumLats - 1)) {
-          body[iBody].daDIceHeightDy[iLat] =
-                sqrt(1.0 - (body[iBody].daXBoundary[iLat] *
-                            body[iBody].daXBoundary[iLat])) *
-                (body[iBody].daIceHeight[iLat] + body[iBody].daBedrockH[iLat] -
-                 body[iBody].daIceHeight[iLat - 1] -
-                 body[iBody].daBedrockH[iLat - 1]) /
-                (body[iBody].dRadius * deltax);
-        } else {
-          body[iBody].daDIceHeightDy[iLat] =
-                (sqrt(1.0 - (body[iBody].daXBoundary[iLat + 1] *
-                             body[iBody].daXBoundary[iLat + 1])) *
-                       (body[iBody].daIceHeight[iLat + 1] +
-                        body[iBody].daBedrockH[iLat + 1] -
-                        body[iBody].daIceHeight[iLat] -
-                        body[iBody].daBedrockH[iLat]) /
-                       (body[iBody].dRadius * deltax) +
-                 sqrt(1.0 - (body[iBody].daXBoundary[iLat] *
-                             body[iBody].daXBoundary[iLat])) *
-                       (body[iBody].daIceHeight[iLat] +
-                        body[iBody].daBedrockH[iLat] -
-                        body[iBody].daIceHeight[iLat - 1] -
-                        body[iBody].daBedrockH[iLat - 1]) /
-                       (body[iBody].dRadius * deltax)) /
-                2.0;
-        }
-
-        body[iBody].daIceFlow[iLat] =
-              2 * Aice * pow(RHOICE * dGrav, nGLEN) / (nGLEN + 2.0) *
-              pow(fabs(body[iBody].daDIceHeightDy[iLat]), nGLEN - 1) *
-              pow(body[iBody].daIceHeight[iLat] + body[iBody].daBedrockH[iLat],
-                  nGLEN + 2);
-        body[iBody].daSedShear[iLat] = RHOICE * dGrav *
-                                       body[iBody].daIceHeight[iLat] *
-                                       body[iBody].daDIceHeightDy[iLat];
-        body[iBody].daBasalFlow[iLat] = fdBasalFlow(body, iBody, iLat);
-      }
-
-      for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-        if (IceTime != evolve->dTime) {
-          body[iBody].daIceSheetDiff[iLat] =
-                -0.5 * (body[iBody].daIceFlowMid[iLat] +
-                        body[iBody].daBasalFlowMid[iLat]);
-          if (iLat == body[iBody].iNumLats - 1) {
-            body[iBody].daIceSheetDiff[iLat + 1] =
-                  -0.5 * (body[iBody].daIceFlowMid[iLat + 1] +
-                          body[iBody].daBasalFlowMid[iLat + 1]);
-          }
-        }
-
-        if (iLat == 0) {
-          body[iBody].daIceFlowMid[iLat]   = 0;
-          body[iBody].daBasalFlowMid[iLat] = 0;
-        } else if (iLat == body[iBody].iNumLats - 1) {
-          body[iBody].daIceFlowMid[iLat] = (body[iBody].daIceFlow[iLat] +
-                                            body[iBody].daIceFlow[iLat - 1]) /
-                                           2.0;
-          body[iBody].daIceFlowMid[iLat + 1] = 0;
-          body[iBody].daBasalFlowMid[iLat] =
-                (body[iBody].daBasalFlow[iLat] +
-                 body[iBody].daBasalFlow[iLat - 1]) /
-                2.0;
-          body[iBody].daBasalFlowMid[iLat + 1] = 0;
-        } else {
-          body[iBody].daIceFlowMid[iLat] = (body[iBody].daIceFlow[iLat] +
-                                            body[iBody].daIceFlow[iLat - 1]) /
-                                           2.0;
-          body[iBody].daBasalFlowMid[iLat] =
-                (body[iBody].daBasalFlow[iLat] +
-                 body[iBody].daBasalFlow[iLat - 1]) /
-                2.0;
-        }
-
-        if (IceTime == evolve->dTime) {
-          body[iBody].daIceSheetDiff[iLat] = body[iBody].daIceFlowMid[iLat];
-          if (iLat == body[iBody].iNumLats - 1) {
-            body[iBody].daIceSheetDiff[iLat + 1] =
-                  body[iBody].daIceFlowMid[iLat + 1];
-          }
-          body[iBody].daIcePropsTmp[iLat] =
-                body[iBody].daIceHeight[iLat] +
-                body[iBody].daIceBalanceTmp[iLat] * IceDt;
-        } else {
-          body[iBody].daIceSheetDiff[iLat] +=
-                1.5 * (body[iBody].daIceFlowMid[iLat] +
-                       body[iBody].daBasalFlowMid[iLat]);
-          if (iLat == body[iBody].iNumLats - 1) {
-            body[iBody].daIceSheetDiff[iLat + 1] +=
-                  1.5 * (body[iBody].daIceFlowMid[iLat + 1] +
-                         body[iBody].daBasalFlowMid[iLat + 1]);
-          }
-        }
-      }
-
-      for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-        for (jLat = 0; jLat < body[iBody].iNumLats; jLat++) {
-          if (jLat == iLat) {
-            body[iBody].daIceSheetMat[iLat][jLat] =
-                  1.0 + 0.5 * IceDt *
-                              (body[iBody].daIceSheetDiff[iLat] /
-                                     (body[iBody].daYBoundary[iLat] *
-                                      body[iBody].daYBoundary[iLat]) +
-                               body[iBody].daIceSheetDiff[iLat + 1] /
-                                     (body[iBody].daYBoundary[iLat + 1] *
-                                      body[iBody].daYBoundary[iLat + 1]));
-            // superdiagonal
-          } else if (jLat == iLat + 1) {
-            body[iBody].daIceSheetMat[iLat][jLat] =
-                  -0.5 * IceDt * body[iBody].daIceSheetDiff[jLat] /
-                  (body[iBody].daYBoundary[jLat] *
-                   body[iBody].daYBoundary[jLat]);
-            // subdiagonal
-          } else if (jLat == iLat - 1) {
-            body[iBody].daIceSheetMat[iLat][jLat] =
-                  -0.5 * IceDt * body[iBody].daIceSheetDiff[iLat] /
-                  (body[iBody].daYBoundary[iLat] *
-                   body[iBody].daYBoundary[iLat]);
-          } else {
-            body[iBody].daIceSheetMat[iLat][jLat] = 0.0;
-          }
-        }
-        if (IceTime != evolve->dTime) {
-          if (iLat == 0) {
-            body[iBody].daIcePropsTmp[iLat] =
-                  body[iBody].daIceBalanceTmp[iLat] * IceDt +
-                  (1 - 0.5 * IceDt *
-                             (body[iBody].daIceSheetDiff[iLat + 1] /
-                              (body[iBody].daYBoundary[iLat + 1] *
-                               body[iBody].daYBoundary[iLat + 1]))) *
-                        body[iBody].daIceHeight[iLat] +
-                  0.5 * IceDt * body[iBody].daIceSheetDiff[iLat + 1] *
-                        body[iBody].daIceHeight[iLat + 1] /
-                        (body[iBody].daYBoundary[iLat + 1] *
-                         body[iBody].daYBoundary[iLat + 1]);
-
-          } else if (iLat == body[iBody].iNumLats - 1) {
-            body[iBody].daIcePropsTmp[iLat] =
-                  body[iBody].daIceBalanceTmp[iLat] * IceDt +
-                  (1 - 0.5 * IceDt *
-                             (body[iBody].daIceSheetDiff[iLat] /
-                              (body[iBody].daYBoundary[iLat] *
-                               body[iBody].daYBoundary[iLat]))) *
-                        body[iBody].daIceHeight[iLat] +
-                  0.5 * IceDt * body[iBody].daIceSheetDiff[iLat] *
-                        body[iBody].daIceHeight[iLat - 1] /
-                        (body[iBody].daYBoundary[iLat] *
-                         body[iBody].daYBoundary[iLat]);
-          } else {
-            body[iBody].daIcePropsTmp[iLat] =
-                  body[iBody].daIceBalanceTmp[iLat] * IceDt +
-                  (1 - 0.5 * IceDt *
-                             (body[iBody].daIceSheetDiff[iLat] /
-                                    (body[iBody].daYBoundary[iLat] *
-                                     body[iBody].daYBoundary[iLat]) +
-                              body[iBody].daIceSheetDiff[iLat + 1] /
-                                    (body[iBody].daYBoundary[iLat + 1] *
-                                     body[iBody].daYBoundary[iLat + 1]))) *
-                        body[iBody].daIceHeight[iLat] +
-                  0.5 * IceDt * body[iBody].daIceSheetDiff[iLat + 1] *
-                        body[iBody].daIceHeight[iLat + 1] /
-                        (body[iBody].daYBoundary[iLat + 1] *
-                         body[iBody].daYBoundary[iLat + 1]) +
-                  0.5 * IceDt * body[iBody].daIceSheetDiff[iLat] *
-                        body[iBody].daIceHeight[iLat - 1] /
-                        (body[iBody].daYBoundary[iLat] *
-                         body[iBody].daYBoundary[iLat]);
-          }
-        }
-      }
-
-      IceSheetTriDiag(body, iBody);
-      for (iLat = 0; iLat < body[iBody].iNumLats; iLat++) {
-        body[iBody].daIceMass[iLat] = body[iBody].daIceHeight[iLat] * RHOICE;
-        if (body[iBody].daIceMass[iLat] < 1e-30) {
-          body[iBody].daIceMass[iLat]   = 0.0;
-          body[iBody].daIceHeight[iLat] = 0.0;
-        }
-        body[iBody].daIceBalanceAvg[iLat] +=
-              body[iBody].daIceBalanceTmp[iLat] * IceDt / evolve->dCurrentDt;
-        if (iLat == 0) {
-          body[iBody].daIceFlowAvg[iLat] +=
-                body[iBody].daIceSheetDiff[iLat + 1] *
-                (body[iBody].daIceHeight[iLat + 1] -
-                 body[iBody].daIceHeight[iLat]) /
-                (body[iBody].daYBoundary[iLat + 1] *
-                 body[iBody].daYBoundary[iLat + 1]) *
-                IceDt / evolve->dCurrentDt;
-        } else if (iLat == body[iBody].iNumLats - 1) {
-          body[iBody].daIceFlowAvg[iLat] +=
-                -body[iBody].daIceSheetDiff[iLat] *
-                (body[iBody].daIceHeight[iLat] -
-                 body[iBody].daIceHeight[iLat - 1]) /
-                (body[iBody].daYBoundary[iLat] *
-                 body[iBody].daYBoundary[iLat]) *
-                IceDt / evolve->dCurrentDt;
-        } else {
-          body[iBody].daIceFlowAvg[iLat] +=
-                (body[iBody].daIceSheetDiff[iLat + 1] *
-                       (body[iBody].daIceHeight[iLat + 1] -
-                        body[iBody].daIceHeight[iLat]) /
-                       (body[iBody].daYBoundary[iLat + 1] *
-                        body[iBody].daYBoundary[iLat + 1]) -
-                 body[iBody].daIceSheetDiff[iLat] *
-                       (body[iBody].daIceHeight[iLat] -
-                        body[iBody].daIceHeight[iLat - 1]) /
-                       (body[iBody].daYBoundary[iLat] *
-                        body[iBody].daYBoundary[iLat])) *
-                IceDt / evolve->dCurrentDt;
+      if (body[iBody].dIceHeightTol > 0) {
+        IceDt = fdIceSheetAdaptiveStep(body, evolve, iBody, IceTime, Aice,
+                                       dGrav);
+      } else {
+        if (IceTime + IceDt > evolve->dTime + evolve->dCurrentDt) {
+          // ice time step carries past start of next RK time step
+          IceDt = evolve->dTime + evolve->dCurrentDt - IceTime;
         }
-        dHdt = 1. / (BROCKTIME * YEARSEC) *
-               (body[iBody].daBedrockHEq[iLat] - body[iBody].daBedrockH[iLat] -
-                RHOICE * body[iBody].daIceHeight[iLat] / RHOBROCK);
-        body[iBody].daBedrockH[iLat] += dHdt * IceDt;
+        fvIceSheetStep(body, evolve, iBody, IceTime, IceDt, Aice, dGrav);
       }
 
       IceTime += IceDt;
@@ -21,10 +21,66 @@
 #define HM16 1
 #define SMS09 2
 
+/* Equilibrium solver of the annual model */
+#define ANNRELAX 0
+#define ANNANDERSON 1
+#define ANDERSONDEPTH 5     /**< Past iterates used in Anderson mixing */
+#define ANDERSONMAXITER 500 /**< Iterations before falling back to relaxing */
+#define ANDERSONTOL 1e-11   /**< Largest temperature change at equilibrium */
+
+/* Adaptive ice sheet steps */
+#define ICESTATEVARS 7  /**< Arrays saved to retry a step */
+#define ICEDTMIN 0.1    /**< Shortest step, in orbits */
+#define ICEDTGROW 2.0   /**< Largest growth of the step from one to the next */
+#define ICEDTSHRINK 0.2 /**< Largest reduction of a rejected step */
+
+/* Lookup tables of the OLR and top-of-atmosphere albedo fits */
+#define RADTABLEOLR 0       /**< OLR fit */
+#define RADTABLEOLRDT 1     /**< Slope of the OLR fit (logarithmic for hm16) */
+#define RADTABLESOLR 2      /**< Number of OLR tables */
+#define OLRTABLETMIN 150.0  /**< Lowest temperature of the OLR tables (K) */
+#define OLRTABLETMAX 400.0  /**< Highest temperature of the OLR tables (K) */
+#define ALBTOACOLD 0        /**< Low-temperature TOA albedo fit */
+#define ALBTOAWARM 1        /**< High-temperature TOA albedo fit */
+#define ALBTOAPIECES 2      /**< Number of TOA albedo fits */
+#define ALBSURFICE 0        /**< Ice surface */
+#define ALBSURFLAND 1       /**< Bare land */
+#define ALBSURFMIX 2        /**< Land partly covered by ice */
+#define ALBSURFOCEAN 3      /**< Open ocean, with albedo from AlbedoTaylor */
+#define ALBSURFTYPES 4      /**< Number of surface types */
+
 /* Water albedo type */
 #define ALBFIXED 0
 #define ALBTAYLOR 1
 
+/* Binary orbit and obliquity forcing files */
+#define ORBOBLMAGIC "VPLORBOB" /**< First 8 bytes of a binary forcing file */
+#define ORBOBLHEADER 16        /**< Bytes before the first double */
+#define ORBOBLCOLS 7           /**< Columns: t, a, e, argp, longa, obl, precA */
+
+/* Diagonals stored for the tridiagonal annual EBM matrices */
+#define ANNDIAGS 3
+
+/* Band of the seasonal EBM matrix, whose rows alternate land and water */
+#define SEABANDLO 2 /**< Subdiagonals */
+#define SEABANDUP 2 /**< Superdiagonals */
+#define SEABANDWIDTH                                                           \
+  (2 * SEABANDLO + SEABANDUP + 1) /**< Stored entries per row, with fill */
+
+/* Fewest latitudes for which the seasonal EBM loops are split among threads
+   (parallel builds only) */
+#define POISEPARALLELLATS 64
+
+/* Inputs of the seasonal EBM matrix: 4 scalars, the N+1 diffusion
+   coefficients, and the land fraction, water fraction and Planck B by
+   latitude */
+#define SEAMATRIXKEYLEN(iNumLats) (4 * (iNumLats) + 5)
+
+/* Orbit and spin inputs of the insolation: luminosity, semi-major axis,
+   h, k, eccentricity, longitude of pericenter plus precession angle and
+   obliquity */
+#define INSOLKEYLEN 7
+
 /* Land Geography */
 #define UNIFORM3 0
 #define MODERN 1
@@ -111,6 +167,13 @@
 #define OPT_ECCAMP 1968
 #define OPT_ECCPER 1969
 #define OPT_MINICEHEIGHT 1970
+#define OPT_ANNUALSOLVER 1971
+#define OPT_INSOLTOL 1972
+#define OPT_SEASPERIODTOL 1973
+#define OPT_RADTABLES 1974
+#define OPT_RADTABLETEMPS 1975
+#define OPT_RADTABLEZENITHS 1976
+#define OPT_ICEHEIGHTTOL 1977
 
 #define OPT_OLRMODEL 1998
 #define OPT_CLIMATEMODEL 1999
@@ -178,6 +241,7 @@
 #define OUT_NORTHICEBELTLATSEA 1973
 #define OUT_SOUTHICEBELTLATLAND 1974
 #define OUT_SOUTHICEBELTLATSEA 1975
+#define OUT_SEASYEARS 1976
 
 /* @cond DOXYGEN_OVERRIDE */
 
@@ -258,25 +322,60 @@ void ForceBehaviorPoise(BODY *, MODULE *, EVOLVE *, IO *, SYSTEM *, UPDATE *,
 void fvAlbedoAnnual(BODY *, int);
 void fvAlbedoSeasonal(BODY *, int, int);
 void fvAnnualInsolation(BODY *, int);
+int fbInsolationChanged(BODY *, int);
 double fdOLRdTwk97(BODY *, int, int, int);
 double fdOLRwk97(BODY *, int, int, int);
 double fdOLRdThm16(BODY *, int, int, int);
 double fdOLRhm16(BODY *, int, int, int);
 double fdOLRdTsms09(BODY *, int, int, int);
 double fdOLRsms09(BODY *, int, int, int);
+double fdOLRwk97Fit(double, double);
+double fdOLRdTwk97Fit(double, double);
+double fdOLRhm16Fit(double, double);
+double fdOLRdThm16Fit(double, double);
+void fvCubicWeights(double, double *);
+int fbRadTableIndex(double, double, double, int, int *, double *);
+int fbOLRTable(BODY *, int, int, int, double, double *);
+int fbAlbedoTOATable(BODY *, int, int, int, double, double, double *);
+void fvInitRadTables(BODY *, int);
+double fdAlbedoTOASurf(BODY *, int, int, double);
+double fdAlbedoTOAFit(BODY *, int, int, int, double, double);
+double fdAlbedoTOA(BODY *, int, int, int, double, double);
 void fvAreaIceCovered(BODY *, int);
 
+void fvClimateParamsAnnual(BODY *, int);
+void fvPoiseAnnualRelax(BODY *, int);
+void fvAnnualFixedPointMap(BODY *, int);
+void fvAndersonDropOldest(BODY *, int, int, int);
+int fiAndersonMixing(BODY *, int, int);
+int fbPoiseAnnualAnderson(BODY *, int);
 void PoiseAnnual(BODY *, int);
+int fbSeasonalPeriodic(BODY *, int, int, double);
+void fvSeasonalRepeatYear(BODY *, int, int);
 void PoiseSeasonal(BODY *, int);
+void fvIceSheetStep(BODY *, EVOLVE *, int, double, double, double, double);
+void fvIceSheetState(BODY *, int, int);
+double fdIceSheetAdaptiveStep(BODY *, EVOLVE *, int, double, double, double);
 void PoiseIceSheets(BODY *, EVOLVE *, int);
 void fvSeaIce(BODY *, int);
 void fvMatrixSeasonal(BODY *, int);
-void fvMatrixInvertSeasonal(BODY *, int);
+void fvTridiagDecomp(double **, int);
+void fvTridiagSolve(double **, double *, int);
+void fvTridiagMultAdd(double **, double *, double *, int);
+void fvBandLUDecomp(double **, double *, int *, int, int, int);
+void fvBandLUSolve(double **, double *, int *, int, int, int);
+void fvMatrixBandSeasonal(BODY *, int);
+void fvMatrixFactorSeasonal(BODY *, int);
+void fvMatrixSolveSeasonal(BODY *, int);
 void fvTempGradientAnn(BODY *, double, int);
 void fvTempGradientSea(BODY *, double, int);
 void fvMatrixAnnual(BODY *, int);
+int fbMatrixKeyUpdate(double *, int, double);
+int fbMatrixSeasonalChanged(BODY *, int);
+void fvMatrixFormSeasonal(BODY *, int);
 
 void fvSourceFSeas(BODY *, int, int);
+int fbSnowballLat(BODY *, int, int);
 void fvSnowball(BODY *, int); // XXX Should change to int fbSnowball
 int fbSnowballLand(BODY *, int);
 int fbSnowballSea(BODY *, int);
@@ -288,6 +387,13 @@ void fvSouthIceCapSea(BODY *, int, double *, int *, int *);
 void fvIceBeltLand(BODY *, int, double *, double *, int *, int *, int *);
 void fvIceBeltSea(BODY *, int, double *, double *, int *, int *, int *);
 void fvPrecessionExplicit(BODY *, EVOLVE *, int);
+void fvReadOrbitOblText(BODY *, CONTROL *, FILE *, int);
+void fvMapOrbitOblData(BODY *, FILE *, int);
+double fdOrbitOblTime(EVOLVE *, double);
+void VerifyOrbitOblData(BODY *, CONTROL *, OPTIONS *, int);
+double fdInterpAngle(double, double, double);
+void fvOrbitOblAtTime(BODY *, int, double);
+void UpdateOrbitOblData(BODY *, EVOLVE *, int);
 void fvPropsAuxPoise(BODY *, EVOLVE *, IO *, UPDATE *, int);
 void fvForceObliq(BODY *, EVOLVE *, int);
 void fvForceEcc(BODY *, EVOLVE *, int);
@@ -6852,3 +6852,207 @@ double fdD235UNumCrustDt(BODY *body, SYSTEM *system, int *iaBody) {
   return fdDNumRadDt(body[iaBody[0]].d235UConstCrust, HALFLIFE235U,
                      body[iaBody[0]].dAge);
 }
+
+/* Batched DN/Dt for the members of an ensemble */
+/**
+   Time derivative of the number of a radiogenic species for several members
+   of an ensemble, evaluated as in fdDNumRadDt.
+
+   @param daConst Constant coefficient of each member
+   @param daAge Age of each member
+   @param dHalfLife Decay halflife
+   @param iNumLanes Number of members
+   @param daDeriv Time derivative of each member
+*/
+void fvDNumRadDtEnsemble(double *daConst, double *daAge, double dHalfLife,
+                         int iNumLanes, double *daDeriv) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daDeriv[iLane] =
+          -daConst[iLane] / dHalfLife * exp(-daAge[iLane] / dHalfLife);
+  }
+}
+
+/** fdD26AlNumManDt for several members of an ensemble. */
+void fvD26AlNumManDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                             int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d26AlConstMan;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE26AL,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD40KNumManDt for several members of an ensemble. */
+void fvD40KNumManDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                            int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d40KConstMan;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE40K,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD232ThNumManDt for several members of an ensemble. */
+void fvD232ThNumManDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                              int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d232ThConstMan;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE232TH,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD238UNumManDt for several members of an ensemble. */
+void fvD238UNumManDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                             int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d238UConstMan;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE238U,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD235UNumManDt for several members of an ensemble. */
+void fvD235UNumManDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                             int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d235UConstMan;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE235U,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD26AlNumCoreDt for several members of an ensemble. */
+void fvD26AlNumCoreDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                              int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d26AlConstCore;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE26AL,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD40KNumCoreDt for several members of an ensemble. */
+void fvD40KNumCoreDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                             int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d40KConstCore;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE40K,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD232ThNumCoreDt for several members of an ensemble. */
+void fvD232ThNumCoreDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                               int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d232ThConstCore;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE232TH,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD238UNumCoreDt for several members of an ensemble. */
+void fvD238UNumCoreDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                              int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d238UConstCore;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE238U,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD235UNumCoreDt for several members of an ensemble. */
+void fvD235UNumCoreDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                              int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d235UConstCore;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE235U,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD40KNumCrustDt for several members of an ensemble. */
+void fvD40KNumCrustDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                              int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d40KConstCrust;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE40K,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD232ThNumCrustDt for several members of an ensemble. */
+void fvD232ThNumCrustDtEnsemble(BODY **pBody, SYSTEM **pSystem,
+                                int *iaBody, int iNumLanes, double *daDeriv,
+                                double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d232ThConstCrust;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE232TH,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD238UNumCrustDt for several members of an ensemble. */
+void fvD238UNumCrustDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                               int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d238UConstCrust;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE238U,
+                      iNumLanes, daDeriv);
+}
+
+/** fdD235UNumCrustDt for several members of an ensemble. */
+void fvD235UNumCrustDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                               int iNumLanes, double *daDeriv, double *daWork) {
+  int iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane]             = pBody[iLane][iaBody[0]].d235UConstCrust;
+    daWork[iNumLanes + iLane] = pBody[iLane][iaBody[0]].dAge;
+  }
+  fvDNumRadDtEnsemble(daWork, daWork + iNumLanes, HALFLIFE235U,
+                      iNumLanes, daDeriv);
+}
@@ -639,4 +639,33 @@ double fdD232ThNumCrustDt(BODY *, SYSTEM *, int *);
 double fdD238UNumCrustDt(BODY *, SYSTEM *, int *);
 double fdD235UNumCrustDt(BODY *, SYSTEM *, int *);
 
+void fvDNumRadDtEnsemble(double *, double *, double, int, double *);
+void fvD26AlNumManDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                             double *);
+void fvD40KNumManDtEnsemble(BODY **, SYSTEM **, int *, int, double *, double *);
+void fvD232ThNumManDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                              double *);
+void fvD238UNumManDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                             double *);
+void fvD235UNumManDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                             double *);
+void fvD26AlNumCoreDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                              double *);
+void fvD40KNumCoreDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                             double *);
+void fvD232ThNumCoreDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                               double *);
+void fvD238UNumCoreDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                              double *);
+void fvD235UNumCoreDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                              double *);
+void fvD40KNumCrustDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                              double *);
+void fvD232ThNumCrustDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                                double *);
+void fvD238UNumCrustDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                               double *);
+void fvD235UNumCrustDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                               double *);
+
 /* @endcond */
@@ -0,0 +1,249 @@
+/**
+  @file server.c
+
+  @brief Fork-server mode. The options and outputs are initialized once and
+  then every job read from a FIFO is run in a copy-on-write child process,
+  so short simulations do not pay for the start-up of a new executable.
+
+  A job is one line containing the path of a primary input file, e.g.
+  "run17/vpl.in"; white space around the path is ignored. The child changes
+  into the file's directory, so output is written exactly as if
+  "vplanet vpl.in" had been run there. The line "quit" stops the server once
+  all running jobs have finished.
+
+  @date Oct 18 2026
+
+*/
+
+#include "vplanet.h"
+
+#ifndef VPLANET_ON_WINDOWS
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
+
+/*!
+Run one job in the current (child) process and exit.
+*/
+void ServerRunJob(OPTIONS *options, OUTPUT *output, FILES *files,
+                  fnReadOption fnRead[], fnWriteOutput fnWrite[], char cJob[],
+                  int iVerbose) {
+  char cDir[LINE];
+  char *cSlash;
+
+  cSlash = strrchr(cJob, '/');
+  if (cSlash != NULL) {
+    memset(cDir, '\0', LINE);
+    strncpy(cDir, cJob, cSlash - cJob);
+    if (cSlash == cJob) {
+      strcpy(cDir, "/");
+    }
+    if (chdir(cDir) != 0) {
+      fprintf(stderr, "ERROR: Unable to change to directory %s.\n", cDir);
+      exit(EXIT_INPUT);
+    }
+    cJob = cSlash + 1;
+  }
+  RunSimulation(options, output, files, fnRead, fnWrite, cJob, iVerbose, -1);
+  exit(0);
+}
+
+/*!
+Collect finished children and report their exit status. Clients read these
+lines, so they are printed even with -q. If bBlock is set, wait for at least
+one child. Returns the number of children collected.
+*/
+int fiServerReap(char **saJob, pid_t *iaPid, int iNumSlots, int bBlock) {
+  pid_t iPid;
+  int iSlot, iStatus, iNumReaped = 0;
+
+  while ((iPid = waitpid(-1, &iStatus, bBlock ? 0 : WNOHANG)) > 0) {
+    bBlock = 0;
+    for (iSlot = 0; iSlot < iNumSlots; iSlot++) {
+      if (iaPid[iSlot] == iPid) {
+        break;
+      }
+    }
+    if (iSlot == iNumSlots) {
+      continue;
+    }
+    iStatus = WIFEXITED(iStatus) ? WEXITSTATUS(iStatus) : -1;
+    printf("%s %d\n", saJob[iSlot], iStatus);
+    fflush(stdout);
+    iaPid[iSlot] = 0;
+    iNumReaped++;
+  }
+
+  return iNumReaped;
+}
+
+/*!
+Remove leading and trailing white space from cLine in place, so a job path
+may contain spaces.
+*/
+void fvServerTrim(char cLine[]) {
+  int iStart = 0, iEnd;
+
+  while (isspace((unsigned char)cLine[iStart])) {
+    iStart++;
+  }
+  iEnd = strlen(cLine);
+  while (iEnd > iStart && isspace((unsigned char)cLine[iEnd - 1])) {
+    iEnd--;
+  }
+  memmove(cLine, cLine + iStart, iEnd - iStart);
+  cLine[iEnd - iStart] = '\0';
+}
+
+/*!
+Start the job cJob in a free slot, first waiting for a running job to
+finish if all iNumSlots are busy. Returns 1 if the job was started.
+*/
+int fbServerStart(OPTIONS *options, OUTPUT *output, FILES *files,
+                  fnReadOption fnRead[], fnWriteOutput fnWrite[], char cJob[],
+                  int iFifo, char **saJob, pid_t *iaPid, int iNumSlots,
+                  int *iNumRunning, int iVerbose) {
+  pid_t iPid;
+  int iSlot;
+
+  if (*iNumRunning == iNumSlots) {
+    *iNumRunning -= fiServerReap(saJob, iaPid, iNumSlots, 1);
+  }
+  for (iSlot = 0; iaPid[iSlot] != 0; iSlot++)
+    ;
+
+  fflush(NULL);
+  iPid = fork();
+  if (iPid < 0) {
+    fprintf(stderr, "ERROR: Unable to start job %s.\n", cJob);
+    return 0;
+  }
+  if (iPid == 0) {
+    close(iFifo);
+    ServerRunJob(options, output, files, fnRead, fnWrite, cJob, iVerbose);
+  }
+  strcpy(saJob[iSlot], cJob);
+  iaPid[iSlot] = iPid;
+  (*iNumRunning)++;
+  return 1;
+}
+
+/*!
+Serve jobs from the FIFO cFifo, which is created if it does not exist. At
+most iNumCores jobs run at once. For each finished job the path and exit
+status are printed to stdout; -q only silences the jobs themselves. While
+jobs are running the FIFO is polled every SERVER_POLLMS milliseconds, so
+finished jobs are reported, and their processes collected, without waiting
+for the next line.
+*/
+void Server(OPTIONS *options, OUTPUT *output, FILES *files,
+            fnReadOption fnRead[], fnWriteOutput fnWrite[], char cFifo[],
+            int iNumCores, int iVerbose) {
+  char cBuf[LINE];
+  char *cEnd;
+  char **saJob;
+  pid_t *iaPid;
+  struct stat st;
+  struct pollfd fdPoll;
+  ssize_t iRead;
+  int iFifo, iSlot, iLen, iBufLen = 0, iNumRunning = 0, bQuit = 0;
+
+  if (stat(cFifo, &st) != 0) {
+    if (mkfifo(cFifo, 0600) != 0) {
+      fprintf(stderr, "ERROR: Unable to create FIFO %s.\n", cFifo);
+      exit(EXIT_EXE);
+    }
+  } else if (!S_ISFIFO(st.st_mode)) {
+    fprintf(stderr, "ERROR: %s exists and is not a FIFO.\n", cFifo);
+    exit(EXIT_EXE);
+  }
+
+  if (iNumCores < 1) {
+    iNumCores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (iNumCores < 1) {
+      iNumCores = 1;
+    }
+  }
+
+  /* Opening for reading and writing keeps the FIFO open when a client
+     disconnects, so reads block instead of returning EOF. */
+  iFifo = open(cFifo, O_RDWR);
+  if (iFifo < 0) {
+    fprintf(stderr, "ERROR: Unable to open FIFO %s.\n", cFifo);
+    exit(EXIT_EXE);
+  }
+  fdPoll.fd     = iFifo;
+  fdPoll.events = POLLIN;
+
+  saJob = malloc(iNumCores * sizeof(char *));
+  iaPid = malloc(iNumCores * sizeof(pid_t));
+  for (iSlot = 0; iSlot < iNumCores; iSlot++) {
+    saJob[iSlot] = malloc(LINE);
+    iaPid[iSlot] = 0;
+  }
+
+  if (iVerbose >= VERBPROG) {
+    printf("Waiting for jobs on %s.\n", cFifo);
+    fflush(stdout);
+  }
+
+  while (!bQuit) {
+    iNumRunning -= fiServerReap(saJob, iaPid, iNumCores, 0);
+    if (poll(&fdPoll, 1, iNumRunning > 0 ? SERVER_POLLMS : -1) <= 0) {
+      continue;
+    }
+    iRead = read(iFifo, cBuf + iBufLen, LINE - 1 - iBufLen);
+    if (iRead < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      fprintf(stderr, "ERROR: Unable to read FIFO %s.\n", cFifo);
+      break;
+    }
+    iBufLen += iRead;
+
+    /* Run every complete line in the buffer */
+    while (!bQuit && (cEnd = memchr(cBuf, '\n', iBufLen)) != NULL) {
+      *cEnd = '\0';
+      iLen  = cEnd - cBuf + 1;
+      fvServerTrim(cBuf);
+      if (!strcmp(cBuf, SERVER_QUIT)) {
+        bQuit = 1;
+      } else if (cBuf[0] != '\0') {
+        fbServerStart(options, output, files, fnRead, fnWrite, cBuf, iFifo,
+                      saJob, iaPid, iNumCores, &iNumRunning, iVerbose);
+      }
+      iBufLen -= iLen;
+      memmove(cBuf, cBuf + iLen, iBufLen);
+    }
+    if (iBufLen == LINE - 1) {
+      cBuf[iBufLen] = '\0';
+      fprintf(stderr, "ERROR: Job line longer than %d characters ignored.\n",
+              LINE - 2);
+      iBufLen = 0;
+    }
+  }
+
+  while (iNumRunning > 0) {
+    iNumRunning -= fiServerReap(saJob, iaPid, iNumCores, 1);
+  }
+  close(iFifo);
+
+  for (iSlot = 0; iSlot < iNumCores; iSlot++) {
+    free(saJob[iSlot]);
+  }
+  free(saJob);
+  free(iaPid);
+}
+
+#else
+
+void Server(OPTIONS *options, OUTPUT *output, FILES *files,
+            fnReadOption fnRead[], fnWriteOutput fnWrite[], char cFifo[],
+            int iNumCores, int iVerbose) {
+  fprintf(stderr, "ERROR: -server is not available on Windows.\n");
+  exit(EXIT_EXE);
+}
+
+#endif
@@ -0,0 +1,28 @@
+/**
+  @file server.h
+
+  @brief Fork-server mode: run the simulations named on a FIFO without
+  re-initializing VPLanet for each one.
+
+  @date Oct 18 2026
+
+*/
+
+#define SERVER_QUIT "quit" /**< Job line that shuts the server down */
+#define SERVER_POLLMS 100  /**< Interval between checks for finished jobs */
+
+/* @cond DOXYGEN_OVERRIDE */
+
+#ifndef VPLANET_ON_WINDOWS
+void ServerRunJob(OPTIONS *, OUTPUT *, FILES *, fnReadOption[],
+                  fnWriteOutput[], char[], int);
+int fiServerReap(char **, pid_t *, int, int);
+void fvServerTrim(char[]);
+int fbServerStart(OPTIONS *, OUTPUT *, FILES *, fnReadOption[],
+                  fnWriteOutput[], char[], int, char **, pid_t *, int, int *,
+                  int);
+#endif
+void Server(OPTIONS *, OUTPUT *, FILES *, fnReadOption[], fnWriteOutput[],
+            char[], int, int);
+
+/* @endcond */
@@ -39,13 +39,17 @@ void InitializeUpdateTmpBodySpiNBody(BODY *body, CONTROL *control,
   int jBody;
   // This replaces malloc'ing the destination body in BodyCopySpiNBody
   control->Evolve.tmpBody[iBody].dDistance3 =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
   control->Evolve.tmpBody[iBody].dDistanceX =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
   control->Evolve.tmpBody[iBody].dDistanceY =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
   control->Evolve.tmpBody[iBody].dDistanceZ =
-        malloc(control->Evolve.iNumBodies * sizeof(double));
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(double));
 
   for (jBody = 0; jBody < control->Evolve.iNumBodies; jBody++) {
     // body[iBody].dDistance3[jBody] = 0;
@@ -327,11 +331,14 @@ void InitializeBodySpiNBody(BODY *body, CONTROL *control, UPDATE *update,
     // body[iBody].dDistance3 =
     // malloc(control->Evolve.iNumBodies*sizeof(double));
     body[iBody].dDistanceX =
-          malloc(control->Evolve.iNumBodies * sizeof(double));
+          ArenaAlloc(&control->Arena,
+                     control->Evolve.iNumBodies * sizeof(double));
     body[iBody].dDistanceY =
-          malloc(control->Evolve.iNumBodies * sizeof(double));
+          ArenaAlloc(&control->Arena,
+                     control->Evolve.iNumBodies * sizeof(double));
     body[iBody].dDistanceZ =
-          malloc(control->Evolve.iNumBodies * sizeof(double));
+          ArenaAlloc(&control->Arena,
+                     control->Evolve.iNumBodies * sizeof(double));
 
     for (jBody = 0; jBody < control->Evolve.iNumBodies; jBody++) {
       // body[iBody].dDistance3[jBody] = 0;
@@ -350,10 +357,14 @@ void InitializeBodySpiNBody(BODY *body, CONTROL *control, UPDATE *update,
           } else {
             body[iTmpBody].dMu = 0;
           }
-          body[iTmpBody].dHCartPos = malloc(3 * sizeof(double));
-          body[iTmpBody].dHCartVel = malloc(3 * sizeof(double));
-          body[iTmpBody].dBCartPos = malloc(3 * sizeof(double));
-          body[iTmpBody].dBCartVel = malloc(3 * sizeof(double));
+          body[iTmpBody].dHCartPos =
+                ArenaAlloc(&control->Arena, 3 * sizeof(double));
+          body[iTmpBody].dHCartVel =
+                ArenaAlloc(&control->Arena, 3 * sizeof(double));
+          body[iTmpBody].dBCartPos =
+                ArenaAlloc(&control->Arena, 3 * sizeof(double));
+          body[iTmpBody].dBCartVel =
+                ArenaAlloc(&control->Arena, 3 * sizeof(double));
 
           // Convert all bodies w/ orbital elements to Heliocentric
           if (body[iTmpBody].bUseOrbParams) {
@@ -144,6 +144,40 @@ void ReadStellarModel(BODY *body, CONTROL *control, FILES *files,
   }
 }
 
+void ReadStellarGridFile(BODY *body, CONTROL *control, FILES *files,
+                         OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1;
+  char cTmp[OPTLEN];
+
+  AddOptionString(files->Infile[iFile].cIn, options->cName, cTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    fvLoadStellarGrid(cTmp, control->Io.iVerbose);
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  }
+}
+
+void ReadStellarMetallicity(BODY *body, CONTROL *control, FILES *files,
+                            OPTIONS *options, SYSTEM *system, int iFile) {
+  /* This parameter cannot exist in primary file */
+  int lTmp = -1;
+  double dTmp;
+
+  AddOptionDouble(files->Infile[iFile].cIn, options->cName, &dTmp, &lTmp,
+                  control->Io.iVerbose);
+  if (lTmp >= 0) {
+    NotPrimaryInput(iFile, options->cName, files->Infile[iFile].cIn, lTmp,
+                    control->Io.iVerbose);
+    body[iFile - 1].dMetallicity = dTmp;
+    UpdateFoundOption(&files->Infile[iFile], options, lTmp, iFile);
+  } else if (iFile > 0) {
+    body[iFile - 1].dMetallicity = options->dDefault;
+  }
+}
+
 void ReadMagBrakingModel(BODY *body, CONTROL *control, FILES *files,
                          OPTIONS *options, SYSTEM *system, int iFile) {
   /* This parameter cannot exist in primary file */
@@ -480,6 +514,42 @@ void InitializeOptionsStellar(OPTIONS *options, fnReadOption fnRead[]) {
         "(2016, arXiv:1608.06919). SINEWAVE produces oscillatory luminosity.\n"
         "NONE will leave them constant.\n");
 
+  sprintf(options[OPT_STELLARGRIDFILE].cName, "sStellarGridFile");
+  sprintf(options[OPT_STELLARGRIDFILE].cDescr,
+          "Binary file with the grid for the BARAFFE stellar model");
+  sprintf(options[OPT_STELLARGRIDFILE].cDefault, "none");
+  options[OPT_STELLARGRIDFILE].iType      = 3;
+  options[OPT_STELLARGRIDFILE].bMultiFile = 1;
+  fnRead[OPT_STELLARGRIDFILE]             = &ReadStellarGridFile;
+  sprintf(options[OPT_STELLARGRIDFILE].cLongDescr,
+          "Replace the built-in Baraffe et al. (2015) grid with a grid read "
+          "from\n"
+          "this file. The file starts with \"VPLSTGRD\" and the int32 values 1,\n"
+          "the number of masses, the number of ages and 0, followed by doubles:\n"
+          "masses [Msun], ages [Gyr], then log10(L/Lsun), R/Rsun, "
+          "log10(Teff/K)\n"
+          "and the radius of gyration, each with all ages of the first mass\n"
+          "first. All stars in a simulation use the same grid. Version 2 files\n"
+          "replace the final 0 with the number of metallicities, append the\n"
+          "metallicities [Fe/H] after the ages and store each quantity with\n"
+          "all masses of the first metallicity first; see "
+          "dStellarMetallicity.");
+
+  sprintf(options[OPT_STELLARMETALLICITY].cName, "dStellarMetallicity");
+  sprintf(options[OPT_STELLARMETALLICITY].cDescr,
+          "Stellar metallicity [Fe/H] for the BARAFFE stellar model");
+  sprintf(options[OPT_STELLARMETALLICITY].cDefault, "0");
+  sprintf(options[OPT_STELLARMETALLICITY].cDimension, "nd");
+  options[OPT_STELLARMETALLICITY].dDefault   = 0;
+  options[OPT_STELLARMETALLICITY].iType      = 2;
+  options[OPT_STELLARMETALLICITY].bMultiFile = 1;
+  fnRead[OPT_STELLARMETALLICITY]             = &ReadStellarMetallicity;
+  sprintf(options[OPT_STELLARMETALLICITY].cLongDescr,
+          "Only used when sStellarGridFile supplies a grid with a metallicity\n"
+          "axis. The grid is interpolated linearly in [Fe/H] between the two\n"
+          "nearest metallicities, and values outside the grid are an error.\n"
+          "The built-in grid is for solar metallicity only.");
+
   sprintf(options[OPT_MAGBRAKINGMODEL].cName, "sMagBrakingModel");
   sprintf(options[OPT_MAGBRAKINGMODEL].cDescr, "Magnetic braking model.");
   sprintf(options[OPT_MAGBRAKINGMODEL].cDefault, "REINERS");
@@ -736,8 +806,30 @@ void VerifyStellarBaraffe(BODY *body, CONTROL *control, OPTIONS *options,
   }
   NoSineWaveOptions(body, control, options, iBody);
 
-  body[iBody].dLuminosity =
-        fdLuminosityFunctionBaraffe(body[iBody].dAge, body[iBody].dMass);
+  if (BaraffeGrid.iZLen > 1 &&
+      (body[iBody].dMetallicity < BaraffeGrid.daMet[0] ||
+       body[iBody].dMetallicity > BaraffeGrid.daMet[BaraffeGrid.iZLen - 1])) {
+    if (control->Io.iVerbose >= VERBERR) {
+      fprintf(stderr,
+              "ERROR: %s = %g for body %s is outside the stellar grid "
+              "(%g to %g).\n",
+              options[OPT_STELLARMETALLICITY].cName, body[iBody].dMetallicity,
+              body[iBody].cName, BaraffeGrid.daMet[0],
+              BaraffeGrid.daMet[BaraffeGrid.iZLen - 1]);
+    }
+    if (options[OPT_STELLARMETALLICITY].iLine[iBody + 1] >= 0) {
+      LineExit(options[OPT_STELLARMETALLICITY].cFile[iBody + 1],
+               options[OPT_STELLARMETALLICITY].iLine[iBody + 1]);
+    }
+    exit(EXIT_INPUT);
+  }
+
+  if (!body[iBody].bAtmEsc) {
+    // Only AtmEsc changes a star's mass, so interpolate along its track
+    fvAddStellarTrack(body[iBody].dMass, body[iBody].dMetallicity);
+  }
+  body[iBody].dLuminosity = fdLuminosityFunctionBaraffe(
+        body[iBody].dAge, body[iBody].dMass, body[iBody].dMetallicity);
 }
 
 void VerifyStellarProximaCen(BODY *body, CONTROL *control, OPTIONS *options,
@@ -815,8 +907,8 @@ void VerifyRadius(BODY *body, CONTROL *control, OPTIONS *options,
 
   // Assign radius
   if (body[iBody].iStellarModel == STELLAR_MODEL_BARAFFE) {
-    body[iBody].dRadius =
-          fdRadiusFunctionBaraffe(body[iBody].dAge, body[iBody].dMass);
+    body[iBody].dRadius = fdRadiusFunctionBaraffe(
+          body[iBody].dAge, body[iBody].dMass, body[iBody].dMetallicity);
     if (options[OPT_RADIUS].iLine[iBody + 1] >= 0) {
       // User specified radius, but we're reading it from the grid!
       if (control->Io.iVerbose >= VERBINPUT) {
@@ -857,8 +949,8 @@ void VerifyRadGyra(BODY *body, CONTROL *control, OPTIONS *options,
   if (body[iBody].bEvolveRG) {
     // Assign radius
     if (body[iBody].iStellarModel == STELLAR_MODEL_BARAFFE) {
-      body[iBody].dRadGyra =
-            fdRadGyraFunctionBaraffe(body[iBody].dAge, body[iBody].dMass);
+      body[iBody].dRadGyra = fdRadGyraFunctionBaraffe(
+            body[iBody].dAge, body[iBody].dMass, body[iBody].dMetallicity);
       if (options[OPT_RG].iLine[iBody + 1] >= 0) {
         // User specified radius of gyration, but we're reading it from the
         // grid!
@@ -910,8 +1002,8 @@ void VerifyTemperature(BODY *body, CONTROL *control, OPTIONS *options,
 
   // Assign temperature
   if (body[iBody].iStellarModel == STELLAR_MODEL_BARAFFE) {
-    body[iBody].dTemperature =
-          fdTemperatureFunctionBaraffe(body[iBody].dAge, body[iBody].dMass);
+    body[iBody].dTemperature = fdTemperatureFunctionBaraffe(
+          body[iBody].dAge, body[iBody].dMass, body[iBody].dMetallicity);
     if (options[OPT_TEMPERATURE].iLine[iBody + 1] >= 0) {
       // User specified temperature, but we're reading it from the grid!
       if (control->Io.iVerbose >= VERBINPUT) {
@@ -1452,7 +1544,8 @@ double fdLuminosity(BODY *body, SYSTEM *system, int *iaBody) {
   double dLuminosity;
   if (body[iaBody[0]].iStellarModel == STELLAR_MODEL_BARAFFE) {
     dLuminosity = fdLuminosityFunctionBaraffe(body[iaBody[0]].dAge,
-                                              body[iaBody[0]].dMass);
+                                              body[iaBody[0]].dMass,
+                                              body[iaBody[0]].dMetallicity);
     if (!isnan(dLuminosity)) {
       return dLuminosity;
     } else {
@@ -1481,7 +1574,8 @@ double fdLuminosity(BODY *body, SYSTEM *system, int *iaBody) {
 double fdRadius(BODY *body, SYSTEM *system, int *iaBody) {
   double foo;
   if (body[iaBody[0]].iStellarModel == STELLAR_MODEL_BARAFFE) {
-    foo = fdRadiusFunctionBaraffe(body[iaBody[0]].dAge, body[iaBody[0]].dMass);
+    foo = fdRadiusFunctionBaraffe(body[iaBody[0]].dAge, body[iaBody[0]].dMass,
+                                  body[iaBody[0]].dMetallicity);
     if (!isnan(foo)) {
       return foo;
     } else {
@@ -1509,7 +1603,8 @@ double fdTemperature(BODY *body, SYSTEM *system, int *iaBody) {
   double foo;
   if (body[iaBody[0]].iStellarModel == STELLAR_MODEL_BARAFFE) {
     foo = fdTemperatureFunctionBaraffe(body[iaBody[0]].dAge,
-                                       body[iaBody[0]].dMass);
+                                       body[iaBody[0]].dMass,
+                                       body[iaBody[0]].dMetallicity);
     if (!isnan(foo)) {
       return foo;
     } else {
@@ -1545,7 +1640,8 @@ double fdRadGyra(BODY *body, SYSTEM *system, int *iaBody) {
 
   double foo;
   if (body[iaBody[0]].iStellarModel == STELLAR_MODEL_BARAFFE) {
-    foo = fdRadGyraFunctionBaraffe(body[iaBody[0]].dAge, body[iaBody[0]].dMass);
+    foo = fdRadGyraFunctionBaraffe(body[iaBody[0]].dAge, body[iaBody[0]].dMass,
+                                   body[iaBody[0]].dMetallicity);
     if (!isnan(foo)) {
       return foo;
     } else {
@@ -1572,35 +1668,26 @@ double fdRadGyra(BODY *body, SYSTEM *system, int *iaBody) {
  * models. Valid for the Baraffe stellar models
  */
 double fdDRadiusDtStellar(BODY *body, SYSTEM *system, int *iaBody) {
-  // Note: Compute a very simple derivative. NOTE: This won't work if variables
-  // like the stellar mass are changing, too! Perhaps it's better to keep track
-  // of the previous values of the radius and compute the derivative from those?
-  // TODO: Check this.
+  // The derivative of the interpolating polynomial along the track of
+  // constant mass. NOTE: This won't work if the stellar mass is changing, too!
+  double dDRadiusDt;
 
   if (body[iaBody[0]].iStellarModel != STELLAR_MODEL_BARAFFE) {
     return dTINY;
   }
 
-  // Delta t = 10 years since 10 yr << typical stellar evolution timescales
-  double eps = 10.0 * YEARDAY * DAYSEC;
-  double dRadMinus, dRadPlus;
-
-  dRadMinus = fdRadiusFunctionBaraffe(body[iaBody[0]].dAge - eps,
-                                      body[iaBody[0]].dMass);
-  dRadPlus  = fdRadiusFunctionBaraffe(body[iaBody[0]].dAge + eps,
-                                      body[iaBody[0]].dMass);
-
-  return (dRadPlus - dRadMinus) / (2. * eps);
+  fdRadiusDerivBaraffe(body[iaBody[0]].dAge, body[iaBody[0]].dMass,
+                       body[iaBody[0]].dMetallicity, &dDRadiusDt);
+  return dDRadiusDt;
 }
 
 /*! Compute the instataneous change in stellar radius according to the Baraffe
  * models. Valid for the Baraffe stellar models
  */
 double fdDRadGyraDtStellar(BODY *body, SYSTEM *system, int *iaBody) {
-  // Note: Compute a very simple derivative. NOTE: This won't work if variables
-  // like the stellar mass are changing, too! Perhaps it's better to keep track
-  // of the previous values of the radius of gyration and compute the derivative
-  // from those? TODO: Check this.
+  // The derivative of the interpolating polynomial along the track of
+  // constant mass. NOTE: This won't work if the stellar mass is changing, too!
+  double dDRGDt;
 
   // If not evolving RG or not using Baraffe+2015 models, ignore RG evolution
   if (body[iaBody[0]].iStellarModel != STELLAR_MODEL_BARAFFE ||
@@ -1608,16 +1695,9 @@ double fdDRadGyraDtStellar(BODY *body, SYSTEM *system, int *iaBody) {
     return dTINY;
   }
 
-  // Delta t = 10 years since  10 yr << typical stellar evolution timescales
-  double eps = 10.0 * YEARDAY * DAYSEC;
-  double dRGMinus, dRGPlus;
-
-  dRGMinus = fdRadGyraFunctionBaraffe(body[iaBody[0]].dAge - eps,
-                                      body[iaBody[0]].dMass);
-  dRGPlus  = fdRadGyraFunctionBaraffe(body[iaBody[0]].dAge + eps,
-                                      body[iaBody[0]].dMass);
-
-  return (dRGPlus - dRGMinus) / (2. * eps);
+  fdRadGyraDerivBaraffe(body[iaBody[0]].dAge, body[iaBody[0]].dMass,
+                        body[iaBody[0]].dMetallicity, &dDRGDt);
+  return dDRGDt;
 }
 
 /*! Compute instataneous change in potential energy due to stellar radius
@@ -1864,9 +1944,60 @@ double fdDRotRateDt(BODY *body, SYSTEM *system, int *iaBody) {
          fdDRotRateDtRadGyra(body, system, iaBody);
 }
 
-double fdLuminosityFunctionBaraffe(double dAge, double dMass) {
+/*! fdDRotRateDt for several members of an ensemble. The interpolations in
+ * the stellar grids and the magnetic braking laws are evaluated member by
+ * member; the rest of the chain rule runs over contiguous arrays in the same
+ * order as fdDRotRateDt.
+ */
+void fvDRotRateDtEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                          int iNumLanes, double *daDeriv, double *daWork) {
+  int iB0 = iaBody[0], iLane;
+  BODY *body;
+  double dCon, dMagBrake, dRadGyra;
+  double *daDRadiusDt  = daWork;
+  double *daDRadGyraDt = daWork + iNumLanes;
+  double *daDJDt       = daWork + 2 * iNumLanes;
+  double *daRotRate    = daWork + 3 * iNumLanes;
+  double *daRadius     = daWork + 4 * iNumLanes;
+  double *daRG         = daWork + 5 * iNumLanes;
+  double *daMass       = daWork + 6 * iNumLanes;
+  double *daBaraffe    = daWork + 7 * iNumLanes;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    body             = pBody[iLane];
+    daBaraffe[iLane] = body[iB0].iStellarModel == STELLAR_MODEL_BARAFFE;
+    if (daBaraffe[iLane]) {
+      daDRadiusDt[iLane]  = fdDRadiusDtStellar(body, pSystem[iLane], iaBody);
+      daDRadGyraDt[iLane] = fdDRadGyraDtStellar(body, pSystem[iLane], iaBody);
+    } else {
+      daDRadiusDt[iLane]  = 0;
+      daDRadGyraDt[iLane] = 0;
+    }
+    daDJDt[iLane]    = fdDJDtMagBrakingStellar(body, pSystem[iLane], iaBody);
+    daRotRate[iLane] = body[iB0].dRotRate;
+    daRadius[iLane]  = body[iB0].dRadius;
+    daRG[iLane]      = body[iB0].dRadGyra;
+    daMass[iLane]    = body[iB0].dMass;
+  }
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    dCon = daBaraffe[iLane] ? -2.0 * daDRadiusDt[iLane] * daRotRate[iLane] /
+                                    daRadius[iLane]
+                            : dTINY;
+    dMagBrake = -daDJDt[iLane] / (daMass[iLane] * daRG[iLane] * daRG[iLane] *
+                                  daRadius[iLane] * daRadius[iLane]);
+    dRadGyra = daBaraffe[iLane]
+                     ? -2.0 * daDRadGyraDt[iLane] * daRotRate[iLane] /
+                             daRG[iLane]
+                     : dTINY;
+    daDeriv[iLane] = dCon + dMagBrake + dRadGyra;
+  }
+}
+
+double fdLuminosityFunctionBaraffe(double dAge, double dMass,
+                                   double dMetallicity) {
   int iError;
-  double L = fdBaraffe(STELLAR_L, dAge, dMass, 3, &iError);
+  double L = fdBaraffe(STELLAR_L, dAge, dMass, dMetallicity, 3, &iError);
   if ((iError == STELLAR_ERR_NONE) || (iError == STELLAR_ERR_LINEAR)) {
     return L;
   } else if (iError == STELLAR_ERR_OUTOFBOUNDS_HI ||
@@ -1890,13 +2021,26 @@ double fdLuminosityFunctionBaraffe(double dAge, double dMass) {
   }
 }
 
-double fdRadiusFunctionBaraffe(double dAge, double dMass) {
+double fdRadiusFunctionBaraffe(double dAge, double dMass,
+                               double dMetallicity) {
+  return fdRadiusDerivBaraffe(dAge, dMass, dMetallicity, NULL);
+}
+
+/*! Radius of a Baraffe star and, if pdDRadiusDt is not NULL, its rate of
+ * change, both from the same interpolation
+ */
+double fdRadiusDerivBaraffe(double dAge, double dMass, double dMetallicity,
+                            double *pdDRadiusDt) {
   int iError;
-  double R = fdBaraffe(STELLAR_R, dAge, dMass, 3, &iError);
+  double R = fdBaraffeDeriv(STELLAR_R, dAge, dMass, dMetallicity, 3,
+                            pdDRadiusDt, &iError);
   if ((iError == STELLAR_ERR_NONE) || (iError == STELLAR_ERR_LINEAR)) {
     return R;
   } else if (iError == STELLAR_ERR_OUTOFBOUNDS_HI ||
              iError == STELLAR_ERR_ISNAN) {
+    if (pdDRadiusDt != NULL) {
+      *pdDRadiusDt = NAN;
+    }
     return NAN;
   } else {
     if (iError == STELLAR_ERR_OUTOFBOUNDS_LO) {
@@ -1915,13 +2059,26 @@ double fdRadiusFunctionBaraffe(double dAge, double dMass) {
   }
 }
 
-double fdRadGyraFunctionBaraffe(double dAge, double dMass) {
+double fdRadGyraFunctionBaraffe(double dAge, double dMass,
+                                double dMetallicity) {
+  return fdRadGyraDerivBaraffe(dAge, dMass, dMetallicity, NULL);
+}
+
+/*! Radius of gyration of a Baraffe star and, if pdDRGDt is not NULL, its
+ * rate of change, both from the same interpolation
+ */
+double fdRadGyraDerivBaraffe(double dAge, double dMass, double dMetallicity,
+                             double *pdDRGDt) {
   int iError;
-  double rg = fdBaraffe(STELLAR_RG, dAge, dMass, 3, &iError);
+  double rg = fdBaraffeDeriv(STELLAR_RG, dAge, dMass, dMetallicity, 3,
+                             pdDRGDt, &iError);
   if ((iError == STELLAR_ERR_NONE) || (iError == STELLAR_ERR_LINEAR)) {
     return rg;
   } else if (iError == STELLAR_ERR_OUTOFBOUNDS_HI ||
              iError == STELLAR_ERR_ISNAN) {
+    if (pdDRGDt != NULL) {
+      *pdDRGDt = NAN;
+    }
     return NAN;
   } else {
     if (iError == STELLAR_ERR_OUTOFBOUNDS_LO) {
@@ -1943,9 +2100,10 @@ double fdRadGyraFunctionBaraffe(double dAge, double dMass) {
   }
 }
 
-double fdTemperatureFunctionBaraffe(double dAge, double dMass) {
+double fdTemperatureFunctionBaraffe(double dAge, double dMass,
+                                    double dMetallicity) {
   int iError;
-  double T = fdBaraffe(STELLAR_T, dAge, dMass, 3, &iError);
+  double T = fdBaraffe(STELLAR_T, dAge, dMass, dMetallicity, 3, &iError);
   if ((iError == STELLAR_ERR_NONE) || (iError == STELLAR_ERR_LINEAR)) {
     return T;
   } else if (iError == STELLAR_ERR_OUTOFBOUNDS_HI ||
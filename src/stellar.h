@@ -64,6 +64,8 @@
 
 #define OPT_EVOVLERG                                                           \
   1522 /**< Whether or not to evolve stellar radius of gyration */
+#define OPT_STELLARGRIDFILE 1523 /**< Binary file with a stellar grid */
+#define OPT_STELLARMETALLICITY 1524 /**< [Fe/H] for the stellar grid */
 
 #define OPT_LUMAMPLITUDE 1550
 #define OPT_LUMPERIOD 1555
@@ -152,20 +154,24 @@ void LogBodyStellar(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UPDATE *,
 void fnForceBehaviorStellar(BODY *, MODULE *, EVOLVE *, IO *, SYSTEM *,
                             UPDATE *, fnUpdateVariable ***fnUpdate, int, int);
 double fdLuminosity(BODY *, SYSTEM *, int *);
-double fdLuminosityFunctionBaraffe(double, double);
+double fdLuminosityFunctionBaraffe(double, double, double);
 double fdLuminosityFunctionProximaCen(double, double);
 double fdLuminosityFunctionSineWave(BODY *, int);
 double fdRadius(BODY *, SYSTEM *, int *);
 double fdRadGyra(BODY *, SYSTEM *, int *);
-double fdRadiusFunctionBaraffe(double, double);
-double fdRadGyraFunctionBaraffe(double, double);
+double fdRadiusFunctionBaraffe(double, double, double);
+double fdRadGyraFunctionBaraffe(double, double, double);
+double fdRadiusDerivBaraffe(double, double, double, double *);
+double fdRadGyraDerivBaraffe(double, double, double, double *);
 double fdRadiusFunctionProximaCen(double, double);
 double fdDRotRateDt(BODY *, SYSTEM *, int *);
+void fvDRotRateDtEnsemble(BODY **, SYSTEM **, int *, int, double *,
+                          double *);
 double fdDRotRateDtCon(BODY *, SYSTEM *, int *);
 double fdDRotRateDtRadGyra(BODY *, SYSTEM *, int *);
 double fdDRotRateDtMagBrake(BODY *, SYSTEM *, int *);
 double fdTemperature(BODY *, SYSTEM *, int *);
-double fdTemperatureFunctionBaraffe(double, double);
+double fdTemperatureFunctionBaraffe(double, double, double);
 double fdTemperatureFunctionProximaCen(double, double);
 double fdDJDtMagBrakingStellar(BODY *, SYSTEM *, int *);
 double fdDRadiusDtStellar(BODY *, SYSTEM *, int *);
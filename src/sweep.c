@@ -0,0 +1,1155 @@
+/**
+  @file sweep.c
+
+  @brief Built-in parameter sweeps. A VSPACE input file is expanded in memory
+  and every member of the sweep is integrated by a worker process that is
+  forked from the driver, so options and outputs are initialized only once.
+  The results of all members are collected into one archive.
+
+  @date Oct 18 2026
+
+*/
+
+#include "vplanet.h"
+
+#ifndef VPLANET_ON_WINDOWS
+#include <dirent.h>
+#include <fnmatch.h>
+#include <sys/wait.h>
+#endif
+
+/*
+ *
+ * Reading the VSPACE file
+ *
+ */
+
+void SweepInputExit(char cFile[], int iLine, char cLine[]) {
+  fprintf(stderr, "ERROR: Unable to parse line in sweep file: %s",
+          cLine);
+  LineExit(cFile, iLine);
+}
+
+/* Copy the first word of cArg into cDest, which holds iSize characters.
+   Words that do not fit are an error rather than an overflow. */
+void SweepReadWord(char cDest[], int iSize, char cArg[], char cFile[],
+                   int iLine) {
+  int iLen;
+
+  while (isspace((unsigned char)*cArg)) {
+    cArg++;
+  }
+  iLen = strcspn(cArg, " \t\r\n");
+  if (iLen >= iSize) {
+    fprintf(stderr, "ERROR: %.*s is longer than %d characters.\n", iLen,
+            cArg, iSize - 1);
+    LineExit(cFile, iLine);
+  }
+  memcpy(cDest, cArg, iLen);
+  cDest[iLen] = '\0';
+}
+
+/* Expand a leading ~ to the user's home directory */
+void SweepExpandPath(char cPath[]) {
+  char cTmp[LINE];
+  char *cHome;
+
+  if (cPath[0] == '~' && (cHome = getenv("HOME")) != NULL) {
+    snprintf(cTmp, LINE, "%s%s", cHome, cPath + 1);
+    strcpy(cPath, cTmp);
+  }
+}
+
+char *sReadFile(char cFile[]) {
+  FILE *fp;
+  long iSize;
+  char *cContents;
+
+  fp = fopen(cFile, "r");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open %s.\n", cFile);
+    exit(EXIT_INPUT);
+  }
+  fseek(fp, 0, SEEK_END);
+  iSize = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  cContents = malloc(iSize + 1);
+  iSize     = fread(cContents, 1, iSize, fp);
+  fclose(fp);
+  cContents[iSize] = '\0';
+
+  return cContents;
+}
+
+/* Parse the bracketed distribution, e.g. [5500, 6500, n10] */
+void ReadSweepDistribution(SWEEP *sweep, SWEEPPARAM *param, char cFile[],
+                           int iLine, char cLine[]) {
+  char *cOpen, *cClose, *cField;
+  char cBody[LINE], caField[5][OPTLEN];
+  int iNumFields = 0, iField;
+
+  cOpen  = strchr(cLine, '[');
+  cClose = strchr(cLine, ']');
+  if (cClose == NULL || cClose < cOpen) {
+    SweepInputExit(cFile, iLine, cLine);
+  }
+  memset(cBody, '\0', LINE);
+  strncpy(cBody, cOpen + 1, cClose - cOpen - 1);
+  for (cField = strtok(cBody, ", \t"); cField != NULL;
+       cField = strtok(NULL, ", \t")) {
+    if (iNumFields == 5) {
+      SweepInputExit(cFile, iLine, cLine);
+    }
+    strncpy(caField[iNumFields], cField, OPTLEN - 1);
+    caField[iNumFields][OPTLEN - 1] = '\0';
+    iNumFields++;
+  }
+  if (iNumFields < 3) {
+    SweepInputExit(cFile, iLine, cLine);
+  }
+  SweepReadWord(param->cPrefix, OPTLEN, cClose + 1, cFile, iLine);
+
+  param->dMin     = atof(caField[0]);
+  param->dMax     = atof(caField[1]);
+  param->bCutLow  = 0;
+  param->bCutHigh = 0;
+
+  if (sweep->iSampleMode == SWEEP_GRID) {
+    if (caField[2][0] == 'n') {
+      param->iDistrib   = SWEEP_LINEAR;
+      param->iNumValues = atoi(caField[2] + 1);
+    } else if (caField[2][0] == 'l') {
+      param->iDistrib   = SWEEP_LOG;
+      param->iNumValues = atoi(caField[2] + 1);
+      if (param->dMin * param->dMax <= 0) {
+        fprintf(stderr,
+                "ERROR: Logarithmic grid for %s must not include zero.\n",
+                param->cName);
+        LineExit(cFile, iLine);
+      }
+    } else {
+      param->iDistrib = SWEEP_STEP;
+      param->dStep    = atof(caField[2]);
+      if (param->dStep <= 0 || param->dMax < param->dMin) {
+        fprintf(stderr, "ERROR: Invalid grid step for %s.\n", param->cName);
+        LineExit(cFile, iLine);
+      }
+      param->iNumValues =
+            (int)floor((param->dMax - param->dMin) / param->dStep + 1e-9) + 1;
+    }
+    if (param->iNumValues < 1) {
+      fprintf(stderr, "ERROR: Grid for %s must have at least one value.\n",
+              param->cName);
+      LineExit(cFile, iLine);
+    }
+  } else {
+    if (!strcmp(caField[2], "u")) {
+      param->iDistrib = SWEEP_UNIFORM;
+    } else if (!strcmp(caField[2], "t")) {
+      param->iDistrib = SWEEP_LOGUNIFORM;
+      if (param->dMin * param->dMax <= 0) {
+        fprintf(stderr,
+                "ERROR: Log-uniform bounds for %s must not include zero.\n",
+                param->cName);
+        LineExit(cFile, iLine);
+      }
+    } else if (!strcmp(caField[2], "g")) {
+      param->iDistrib = SWEEP_GAUSSIAN;
+      for (iField = 3; iField < iNumFields; iField++) {
+        if (!memcmp(caField[iField], "min=", 4)) {
+          param->bCutLow = 1;
+          param->dCutLow = atof(caField[iField] + 4);
+        } else if (!memcmp(caField[iField], "max=", 4)) {
+          param->bCutHigh = 1;
+          param->dCutHigh = atof(caField[iField] + 4);
+        } else {
+          SweepInputExit(cFile, iLine, cLine);
+        }
+      }
+    } else {
+      fprintf(stderr,
+              "ERROR: Unknown random distribution \"%s\" for %s. Options "
+              "are u, t and g.\n",
+              caField[2], param->cName);
+      LineExit(cFile, iLine);
+    }
+  }
+}
+
+/*!
+Read a VSPACE input file into the SWEEP struct and load all template files
+into memory.
+*/
+void ReadSweep(SWEEP *sweep, char cFile[], int iVerbose) {
+  FILE *fp;
+  char cLine[LINE], cWord[OPTLEN], cArg[LINE], cPath[2 * LINE];
+  char cFormat[32];
+  char *cPattern;
+  int iLine = 0, iFile, iParam, iMaxParams = 64;
+  SWEEPPARAM *param;
+
+  fp = fopen(cFile, "r");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open sweep file %s.\n", cFile);
+    exit(EXIT_INPUT);
+  }
+
+  strcpy(sweep->cFile, cFile);
+  strcpy(sweep->cSrcFolder, ".");
+  strcpy(sweep->cDestFolder, "sweep");
+  memset(sweep->cTrialName, '\0', NAMELEN);
+  sweep->iSampleMode  = SWEEP_GRID;
+  sweep->iNumTrials   = 0;
+  sweep->iSeed        = 0;
+  sweep->iEnsembleSize = 1;
+  sweep->iNumFiles    = 0;
+  sweep->iPrimaryFile = -1;
+  sweep->iNumArchivePatterns = 0;
+  sweep->iNumParams   = 0;
+  sweep->Param        = malloc(iMaxParams * sizeof(SWEEPPARAM));
+
+  // The first word and the rest of the line, e.g. "%47s %2047[^\n]"
+  snprintf(cFormat, 32, "%%%ds %%%d[^\n]", OPTLEN - 1, LINE - 1);
+  // iLine counts from 0, like the lines passed to LineExit
+  for (; fgets(cLine, LINE, fp) != NULL; iLine++) {
+    // Strip comments
+    if (strchr(cLine, '#') != NULL) {
+      *strchr(cLine, '#') = '\0';
+    }
+    memset(cWord, '\0', OPTLEN);
+    memset(cArg, '\0', LINE);
+    if (sscanf(cLine, cFormat, cWord, cArg) < 1) {
+      continue;
+    }
+    // Trim trailing white space from the argument
+    while (strlen(cArg) > 0 && isspace(cArg[strlen(cArg) - 1])) {
+      cArg[strlen(cArg) - 1] = '\0';
+    }
+
+    if (!strcmp(cWord, "sSrcFolder") || !strcmp(cWord, "srcfolder")) {
+      SweepReadWord(sweep->cSrcFolder, LINE, cArg, cFile, iLine);
+      SweepExpandPath(sweep->cSrcFolder);
+    } else if (!strcmp(cWord, "sDestFolder") ||
+               !strcmp(cWord, "destfolder")) {
+      SweepReadWord(sweep->cDestFolder, LINE, cArg, cFile, iLine);
+      SweepExpandPath(sweep->cDestFolder);
+    } else if (!strcmp(cWord, "sTrialName") || !strcmp(cWord, "trialname")) {
+      SweepReadWord(sweep->cTrialName, NAMELEN, cArg, cFile, iLine);
+    } else if (!strcmp(cWord, "sSampleMode") ||
+               !strcmp(cWord, "samplemode")) {
+      if (!strcmp(cArg, "random") || !strcmp(cArg, "Random")) {
+        sweep->iSampleMode = SWEEP_RANDOM;
+      } else if (!strcmp(cArg, "grid") || !strcmp(cArg, "Grid")) {
+        sweep->iSampleMode = SWEEP_GRID;
+      } else {
+        SweepInputExit(cFile, iLine, cLine);
+      }
+    } else if (!strcmp(cWord, "iNumTrials") || !strcmp(cWord, "randsize")) {
+      sweep->iNumTrials = atoi(cArg);
+    } else if (!strcmp(cWord, "iSeed") || !strcmp(cWord, "seed")) {
+      sweep->iSeed = atoi(cArg);
+    } else if (!strcmp(cWord, "iEnsembleSize")) {
+      sweep->iEnsembleSize = atoi(cArg);
+      if (sweep->iEnsembleSize < 1) {
+        fprintf(stderr, "ERROR: iEnsembleSize must be at least 1.\n");
+        LineExit(cFile, iLine);
+      }
+    } else if (!strcmp(cWord, "saArchiveFiles")) {
+      // Shell patterns of the output files to archive, besides the log
+      for (cPattern = strtok(cArg, " \t"); cPattern != NULL;
+           cPattern = strtok(NULL, " \t")) {
+        if (sweep->iNumArchivePatterns == MAXFILES) {
+          fprintf(stderr, "ERROR: Too many patterns in saArchiveFiles.\n");
+          LineExit(cFile, iLine);
+        }
+        SweepReadWord(sweep->caArchivePattern[sweep->iNumArchivePatterns],
+                      NAMELEN, cPattern, cFile, iLine);
+        sweep->iNumArchivePatterns++;
+      }
+    } else if (!strcmp(cWord, "sBodyFile") || !strcmp(cWord, "sPrimaryFile") ||
+               !strcmp(cWord, "file")) {
+      if (sweep->iNumFiles == MAXFILES) {
+        fprintf(stderr, "ERROR: Too many files in sweep.\n");
+        LineExit(cFile, iLine);
+      }
+      SweepReadWord(sweep->caFile[sweep->iNumFiles], NAMELEN, cArg, cFile,
+                    iLine);
+      if (!strcmp(cWord, "sPrimaryFile") ||
+          (!strcmp(cWord, "file") &&
+           !strcmp(sweep->caFile[sweep->iNumFiles], "vpl.in"))) {
+        sweep->iPrimaryFile = sweep->iNumFiles;
+      }
+      sweep->iNumFiles++;
+    } else {
+      // An option of the most recently listed file
+      if (sweep->iNumFiles == 0) {
+        fprintf(stderr, "ERROR: Option %s appears before any input file.\n",
+                cWord);
+        LineExit(cFile, iLine);
+      }
+      if (sweep->iNumParams == iMaxParams) {
+        iMaxParams *= 2;
+        sweep->Param = realloc(sweep->Param, iMaxParams * sizeof(SWEEPPARAM));
+      }
+      param = &sweep->Param[sweep->iNumParams];
+      memset(param, 0, sizeof(SWEEPPARAM));
+      param->iFile = sweep->iNumFiles - 1;
+
+      if (!strcmp(cWord, "rm")) {
+        param->iDistrib = SWEEP_REMOVE;
+        SweepReadWord(param->cName, OPTLEN, cArg, cFile, iLine);
+      } else if (strchr(cArg, '[') != NULL) {
+        strcpy(param->cName, cWord);
+        ReadSweepDistribution(sweep, param, cFile, iLine, cLine);
+      } else {
+        param->iDistrib = SWEEP_FIXED;
+        strcpy(param->cName, cWord);
+        strcpy(param->cValue, cArg);
+      }
+      sweep->iNumParams++;
+    }
+  }
+  fclose(fp);
+
+  if (sweep->iPrimaryFile == -1) {
+    fprintf(stderr, "ERROR: No primary input file (sPrimaryFile) in %s.\n",
+            cFile);
+    exit(EXIT_INPUT);
+  }
+  if (sweep->iSampleMode == SWEEP_RANDOM && sweep->iNumTrials < 1) {
+    fprintf(stderr, "ERROR: Random sweeps require iNumTrials > 0 in %s.\n",
+            cFile);
+    exit(EXIT_INPUT);
+  }
+
+  for (iFile = 0; iFile < sweep->iNumFiles; iFile++) {
+    snprintf(cPath, 2 * LINE, "%s/%s", sweep->cSrcFolder,
+             sweep->caFile[iFile]);
+    sweep->saTemplate[iFile] = sReadFile(cPath);
+  }
+
+  if (iVerbose >= VERBINPUT) {
+    for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+      printf("INFO: Sweep modifies %s in %s.\n", sweep->Param[iParam].cName,
+             sweep->caFile[sweep->Param[iParam].iFile]);
+    }
+  }
+}
+
+/*
+ *
+ * Expanding the samples
+ *
+ */
+
+double fdSweepUniform() {
+  return (rand() + 0.5) / ((double)RAND_MAX + 1);
+}
+
+double fdSweepGaussian(SWEEPPARAM *param) {
+  double dValue;
+
+  do {
+    dValue = param->dMin + param->dMax * sqrt(-2 * log(fdSweepUniform())) *
+                                 cos(2 * PI * fdSweepUniform());
+  } while ((param->bCutLow && dValue < param->dCutLow) ||
+           (param->bCutHigh && dValue > param->dCutHigh));
+
+  return dValue;
+}
+
+double fdSweepGridValue(SWEEPPARAM *param, int iIndex) {
+  if (param->iDistrib == SWEEP_STEP) {
+    return param->dMin + iIndex * param->dStep;
+  }
+  if (param->iNumValues == 1) {
+    return param->dMin;
+  }
+  if (param->iDistrib == SWEEP_LOG) {
+    return param->dMin * pow(param->dMax / param->dMin,
+                             iIndex / (double)(param->iNumValues - 1));
+  }
+  return param->dMin +
+         iIndex * (param->dMax - param->dMin) / (param->iNumValues - 1);
+}
+
+int fbSweepVaries(SWEEPPARAM *param) {
+  return param->iDistrib != SWEEP_FIXED && param->iDistrib != SWEEP_REMOVE;
+}
+
+/*!
+Fill in the value of every swept option for every member. Grids are the
+Cartesian product of all swept options with the last option varying fastest.
+*/
+void ExpandSweep(SWEEP *sweep, int iVerbose) {
+  int iMember, iParam, iRemainder;
+  SWEEPPARAM *param;
+
+  if (sweep->iSampleMode == SWEEP_GRID) {
+    sweep->iNumMembers = 1;
+    for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+      if (fbSweepVaries(&sweep->Param[iParam])) {
+        sweep->iNumMembers *= sweep->Param[iParam].iNumValues;
+      }
+    }
+  } else {
+    sweep->iNumMembers = sweep->iNumTrials;
+    srand(sweep->iSeed);
+  }
+
+  sweep->iaIndex = malloc(sweep->iNumMembers * sizeof(int *));
+  sweep->daValue = malloc(sweep->iNumMembers * sizeof(double *));
+  for (iMember = 0; iMember < sweep->iNumMembers; iMember++) {
+    sweep->iaIndex[iMember] = malloc(sweep->iNumParams * sizeof(int));
+    sweep->daValue[iMember] = malloc(sweep->iNumParams * sizeof(double));
+
+    iRemainder = iMember;
+    for (iParam = sweep->iNumParams - 1; iParam >= 0; iParam--) {
+      param                           = &sweep->Param[iParam];
+      sweep->iaIndex[iMember][iParam] = 0;
+      sweep->daValue[iMember][iParam] = 0;
+      if (!fbSweepVaries(param)) {
+        continue;
+      }
+      if (sweep->iSampleMode == SWEEP_GRID) {
+        sweep->iaIndex[iMember][iParam] = iRemainder % param->iNumValues;
+        iRemainder /= param->iNumValues;
+        sweep->daValue[iMember][iParam] =
+              fdSweepGridValue(param, sweep->iaIndex[iMember][iParam]);
+      }
+    }
+    // Random draws in input order so a seed always gives the same sample
+    if (sweep->iSampleMode == SWEEP_RANDOM) {
+      for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+        param = &sweep->Param[iParam];
+        if (param->iDistrib == SWEEP_UNIFORM) {
+          sweep->daValue[iMember][iParam] =
+                param->dMin + (param->dMax - param->dMin) * fdSweepUniform();
+        } else if (param->iDistrib == SWEEP_LOGUNIFORM) {
+          sweep->daValue[iMember][iParam] =
+                param->dMin *
+                pow(param->dMax / param->dMin, fdSweepUniform());
+        } else if (param->iDistrib == SWEEP_GAUSSIAN) {
+          sweep->daValue[iMember][iParam] = fdSweepGaussian(param);
+        }
+      }
+    }
+  }
+
+  if (iVerbose >= VERBPROG) {
+    printf("Sweep %s contains %d members.\n", sweep->cDestFolder,
+           sweep->iNumMembers);
+  }
+}
+
+/*!
+Name of a member, built the same way as VSPACE names its directories.
+*/
+void SweepMemberName(SWEEP *sweep, int iMember, char cName[]) {
+  int iParam, iDigits;
+  char cTmp[2 * OPTLEN];
+
+  strcpy(cName, sweep->cTrialName);
+  if (sweep->iSampleMode == SWEEP_RANDOM) {
+    iDigits = (int)log10((double)sweep->iNumMembers) + 1;
+    sprintf(cTmp, "%0*d", iDigits, iMember);
+    strcat(cName, cTmp);
+    return;
+  }
+  for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+    if (fbSweepVaries(&sweep->Param[iParam])) {
+      sprintf(cTmp, "%s%d", sweep->Param[iParam].cPrefix,
+              sweep->iaIndex[iMember][iParam]);
+      strcat(cName, cTmp);
+    }
+  }
+}
+
+/* Does the line end with the continuation character $? */
+int fbSweepLineContinues(char cLine[]) {
+  char cTmp[LINE];
+  int iLen;
+
+  strcpy(cTmp, cLine);
+  if (strchr(cTmp, '#') != NULL) {
+    *strchr(cTmp, '#') = '\0';
+  }
+  iLen = strlen(cTmp);
+  while (iLen > 0 && isspace(cTmp[iLen - 1])) {
+    iLen--;
+  }
+  return (iLen > 0 && cTmp[iLen - 1] == '$');
+}
+
+/* Does the line of an input file set the option cName? */
+int fbSweepLineSetsOption(char cLine[], char cName[]) {
+  size_t iLen;
+
+  while (isspace((unsigned char)*cLine)) {
+    cLine++;
+  }
+  iLen = strcspn(cLine, " \t\r\n");
+  return (iLen > 0 && iLen == strlen(cName) && !strncmp(cLine, cName, iLen));
+}
+
+/*!
+Write the input files of one member into the current directory, replacing
+the swept options in the templates held in memory.
+*/
+void WriteSweepMember(SWEEP *sweep, int iMember, char cDir[]) {
+  int iFile, iParam, bSkip, bFound;
+  int *bWritten;
+  char cLine[LINE], cPath[2 * LINE];
+  char *cStart, *cEnd;
+  FILE *fp;
+  SWEEPPARAM *param;
+
+  bWritten = calloc(sweep->iNumParams, sizeof(int));
+
+  for (iFile = 0; iFile < sweep->iNumFiles; iFile++) {
+    snprintf(cPath, 2 * LINE, "%s/%s", cDir, sweep->caFile[iFile]);
+    fp = fopen(cPath, "w");
+    if (fp == NULL) {
+      fprintf(stderr, "ERROR: Unable to write %s.\n", cPath);
+      exit(EXIT_WRITE);
+    }
+
+    bSkip  = 0;
+    cStart = sweep->saTemplate[iFile];
+    while (*cStart) {
+      cEnd = strchr(cStart, '\n');
+      if (cEnd == NULL) {
+        cEnd = cStart + strlen(cStart);
+      }
+      memset(cLine, '\0', LINE);
+      strncpy(cLine, cStart, (cEnd - cStart) < LINE - 1 ? (cEnd - cStart)
+                                                         : LINE - 1);
+      cStart = (*cEnd) ? cEnd + 1 : cEnd;
+
+      if (bSkip) {
+        // Continuation of an option that has been replaced
+        bSkip = fbSweepLineContinues(cLine);
+        continue;
+      }
+
+      bFound = 0;
+      for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+        param = &sweep->Param[iParam];
+        if (param->iFile == iFile &&
+            fbSweepLineSetsOption(cLine, param->cName)) {
+          bFound = 1;
+          bSkip  = fbSweepLineContinues(cLine);
+          if (param->iDistrib == SWEEP_FIXED) {
+            fprintf(fp, "%s %s\n", param->cName, param->cValue);
+          } else if (param->iDistrib != SWEEP_REMOVE) {
+            fprintf(fp, "%s %.17g\n", param->cName,
+                    sweep->daValue[iMember][iParam]);
+          }
+          bWritten[iParam] = 1;
+          break;
+        }
+      }
+      if (!bFound) {
+        fprintf(fp, "%s\n", cLine);
+      }
+    }
+
+    // Options not present in the template are appended
+    for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+      param = &sweep->Param[iParam];
+      if (param->iFile != iFile || bWritten[iParam] ||
+          param->iDistrib == SWEEP_REMOVE) {
+        continue;
+      }
+      if (param->iDistrib == SWEEP_FIXED) {
+        fprintf(fp, "%s %s\n", param->cName, param->cValue);
+      } else {
+        fprintf(fp, "%s %.17g\n", param->cName,
+                sweep->daValue[iMember][iParam]);
+      }
+    }
+    fclose(fp);
+  }
+  free(bWritten);
+}
+
+/*
+ *
+ * Running the sweep
+ *
+ */
+
+#ifndef VPLANET_ON_WINDOWS
+
+void SweepRemoveTree(char cPath[]) {
+  DIR *dir;
+  struct dirent *entry;
+  struct stat st;
+  char cEntry[2 * LINE];
+
+  dir = opendir(cPath);
+  if (dir != NULL) {
+    while ((entry = readdir(dir)) != NULL) {
+      if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) {
+        continue;
+      }
+      snprintf(cEntry, 2 * LINE, "%s/%s", cPath, entry->d_name);
+      if (stat(cEntry, &st) == 0 && S_ISDIR(st.st_mode)) {
+        SweepRemoveTree(cEntry);
+      } else {
+        unlink(cEntry);
+      }
+    }
+    closedir(dir);
+    rmdir(cPath);
+  }
+}
+
+int fbSweepIsInput(SWEEP *sweep, char cName[]) {
+  int iFile;
+
+  for (iFile = 0; iFile < sweep->iNumFiles; iFile++) {
+    if (!strcmp(cName, sweep->caFile[iFile])) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int compare_file_names(const void *p, const void *q) {
+  return strcmp(*(char **)p, *(char **)q);
+}
+
+/*
+ *
+ * Sweep archive
+ *
+ * The archive <sDestFolder>.vpa is written append-only while the sweep runs.
+ * Numbers are written in the byte order of the host.
+ *
+ *   "VPLSWEEP" int32 version int32 number of members
+ *   Member records, in order of completion:
+ *     "MEMB" int32 member int32 exit status string name
+ *     int32 number of swept options, each: string file:option double value
+ *     int32 number of blocks, each:
+ *       int32 SWEEP_BLOCK_TEXT string file int64 bytes, contents
+ *       int32 SWEEP_BLOCK_COLUMNS string file string column names
+ *             int32 columns int64 rows, doubles stored column by column
+ *   "INDX" int32 number of members, each: int32 member int64 offset
+ *   int64 offset of "INDX" "VPLSWEEP"
+ *
+ * A string is an int32 length followed by that many characters. A reader
+ * seeks to the trailer to find the index and can then read any member
+ * directly. If the sweep was interrupted the records can still be found by
+ * scanning for "MEMB".
+ *
+ */
+
+void fvSweepWriteInt(FILE *fp, int iValue) {
+  int32_t iTmp = iValue;
+  fwrite(&iTmp, sizeof(int32_t), 1, fp);
+}
+
+void fvSweepWriteLong(FILE *fp, long lValue) {
+  int64_t lTmp = lValue;
+  fwrite(&lTmp, sizeof(int64_t), 1, fp);
+}
+
+void fvSweepWriteString(FILE *fp, char cString[]) {
+  fvSweepWriteInt(fp, strlen(cString));
+  fwrite(cString, 1, strlen(cString), fp);
+}
+
+/*!
+Open the archive and write its header.
+*/
+void OpenSweepArchive(SWEEP *sweep) {
+  sprintf(sweep->cArchive, "%s.vpa", sweep->cDestFolder);
+  sweep->fpArchive = fopen(sweep->cArchive, "wb");
+  if (sweep->fpArchive == NULL) {
+    fprintf(stderr, "ERROR: Unable to open archive %s.\n", sweep->cArchive);
+    exit(EXIT_WRITE);
+  }
+  fwrite("VPLSWEEP", 1, 8, sweep->fpArchive);
+  fvSweepWriteInt(sweep->fpArchive, SWEEP_ARCHIVE_VERSION);
+  fvSweepWriteInt(sweep->fpArchive, sweep->iNumMembers);
+
+  sweep->iNumArchived = 0;
+  sweep->iaArchived   = malloc(sweep->iNumMembers * sizeof(int));
+  sweep->laOffset     = malloc(sweep->iNumMembers * sizeof(long));
+}
+
+/*!
+Write the offset index and trailer, and close the archive.
+*/
+void CloseSweepArchive(SWEEP *sweep) {
+  long lIndex;
+  int iMember;
+
+  lIndex = ftell(sweep->fpArchive);
+  fwrite("INDX", 1, 4, sweep->fpArchive);
+  fvSweepWriteInt(sweep->fpArchive, sweep->iNumArchived);
+  for (iMember = 0; iMember < sweep->iNumArchived; iMember++) {
+    fvSweepWriteInt(sweep->fpArchive, sweep->iaArchived[iMember]);
+    fvSweepWriteLong(sweep->fpArchive, sweep->laOffset[iMember]);
+  }
+  fvSweepWriteLong(sweep->fpArchive, lIndex);
+  fwrite("VPLSWEEP", 1, 8, sweep->fpArchive);
+  fclose(sweep->fpArchive);
+
+  free(sweep->iaArchived);
+  free(sweep->laOffset);
+}
+
+/* Find the "Output Order" of body cBody in the contents of a log file. Only
+   the first (initial) entry is used, as the columns do not change. */
+void SweepLogOutputOrder(char *cLog, char cBody[], char cOrder[]) {
+  char cHeader[NAMELEN + 16];
+  char *cStart, *cEnd;
+
+  cOrder[0] = '\0';
+  if (cLog == NULL) {
+    return;
+  }
+  sprintf(cHeader, "----- BODY: %s ----", cBody);
+  cStart = strstr(cLog, cHeader);
+  if (cStart == NULL || (cStart = strstr(cStart, "Output Order:")) == NULL) {
+    return;
+  }
+  cStart += strlen("Output Order:");
+  while (*cStart == ' ') {
+    cStart++;
+  }
+  cEnd = strchr(cStart, '\n');
+  if (cEnd == NULL) {
+    cEnd = cStart + strlen(cStart);
+  }
+  if (cEnd - cStart >= OPTLEN * MAXARRAY) {
+    cEnd = cStart + OPTLEN * MAXARRAY - 1;
+  }
+  strncpy(cOrder, cStart, cEnd - cStart);
+  cOrder[cEnd - cStart] = '\0';
+}
+
+/* Is the file a forward or backward time series? If so, return the body
+   name, which is the second to last field of <system>.<body>.forward. */
+int fbSweepTimeSeries(char cFile[], char cBody[]) {
+  char *cSuffix, *cDot;
+
+  cSuffix = strrchr(cFile, '.');
+  if (cSuffix == NULL ||
+      (strcmp(cSuffix, ".forward") && strcmp(cSuffix, ".backward"))) {
+    return 0;
+  }
+  for (cDot = cSuffix - 1; cDot > cFile && *cDot != '.'; cDot--)
+    ;
+  if (*cDot != '.') {
+    return 0;
+  }
+  strncpy(cBody, cDot + 1, cSuffix - cDot - 1);
+  cBody[cSuffix - cDot - 1] = '\0';
+
+  return 1;
+}
+
+/* Write a time series as columns of doubles. Returns 0 if the file is not a
+   rectangular table of numbers, in which case nothing is written. */
+int fbSweepWriteColumns(FILE *fp, char cFile[], char *cContents,
+                        char cOrder[]) {
+  char *cPos, *cEnd;
+  double *daRow, *daData = NULL;
+  long lNumRows = 0, lMaxRows = 0, lRow;
+  int iNumCols = 0, iCol, iMaxCols = 64;
+
+  daRow = malloc(iMaxCols * sizeof(double));
+  cPos  = cContents;
+  while (*cPos) {
+    // Parse one line
+    iCol = 0;
+    while (*cPos && *cPos != '\n') {
+      while (*cPos == ' ' || *cPos == '\t' || *cPos == '\r') {
+        cPos++;
+      }
+      if (*cPos == '\n' || *cPos == '\0') {
+        break;
+      }
+      if (iCol == iMaxCols) {
+        iMaxCols *= 2;
+        daRow = realloc(daRow, iMaxCols * sizeof(double));
+      }
+      daRow[iCol] = strtod(cPos, &cEnd);
+      if (cEnd == cPos) {
+        free(daRow);
+        free(daData);
+        return 0;
+      }
+      cPos = cEnd;
+      iCol++;
+    }
+    if (*cPos == '\n') {
+      cPos++;
+    }
+    if (iCol == 0) {
+      continue;
+    }
+    if (lNumRows == 0) {
+      iNumCols = iCol;
+    } else if (iCol != iNumCols) {
+      free(daRow);
+      free(daData);
+      return 0;
+    }
+    if (lNumRows == lMaxRows) {
+      lMaxRows = (lMaxRows == 0) ? 1024 : 2 * lMaxRows;
+      daData   = realloc(daData, lMaxRows * iNumCols * sizeof(double));
+    }
+    memcpy(&daData[lNumRows * iNumCols], daRow, iNumCols * sizeof(double));
+    lNumRows++;
+  }
+
+  fvSweepWriteInt(fp, SWEEP_BLOCK_COLUMNS);
+  fvSweepWriteString(fp, cFile);
+  fvSweepWriteString(fp, cOrder);
+  fvSweepWriteInt(fp, iNumCols);
+  fvSweepWriteLong(fp, lNumRows);
+  for (iCol = 0; iCol < iNumCols; iCol++) {
+    for (lRow = 0; lRow < lNumRows; lRow++) {
+      fwrite(&daData[lRow * iNumCols + iCol], sizeof(double), 1, fp);
+    }
+  }
+  free(daRow);
+  free(daData);
+
+  return 1;
+}
+
+/* Collect the output files below cDir/cRel into the growing list saFile,
+   with names relative to cDir, so that subdirectories such as POISE's
+   SeasonalClimateFiles are archived too. Input files are skipped. */
+void SweepCollectFiles(SWEEP *sweep, char cDir[], char cRel[],
+                       char ***saFile, int *iNumFiles, int *iMaxFiles) {
+  DIR *dir;
+  struct dirent *entry;
+  struct stat st;
+  char cName[LINE], cEntry[2 * LINE];
+
+  snprintf(cEntry, 2 * LINE, "%s/%s", cDir, cRel);
+  dir = opendir(cEntry);
+  while (dir != NULL && (entry = readdir(dir)) != NULL) {
+    if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) {
+      continue;
+    }
+    if (cRel[0] == '\0') {
+      snprintf(cName, LINE, "%s", entry->d_name);
+    } else {
+      snprintf(cName, LINE, "%s/%s", cRel, entry->d_name);
+    }
+    snprintf(cEntry, 2 * LINE, "%s/%s", cDir, cName);
+    if (stat(cEntry, &st) == 0 && S_ISDIR(st.st_mode)) {
+      SweepCollectFiles(sweep, cDir, cName, saFile, iNumFiles, iMaxFiles);
+    } else if (cRel[0] == '\0' && fbSweepIsInput(sweep, cName)) {
+      unlink(cEntry);
+    } else {
+      if (*iNumFiles == *iMaxFiles) {
+        *iMaxFiles *= 2;
+        *saFile = realloc(*saFile, *iMaxFiles * sizeof(char *));
+      }
+      (*saFile)[(*iNumFiles)++] = strdup(cName);
+    }
+  }
+  if (dir != NULL) {
+    closedir(dir);
+  }
+}
+
+/* Is the output file cName archived? Logs always are; with saArchiveFiles
+   the other files must match one of its patterns. */
+int fbSweepArchiveFile(SWEEP *sweep, char cName[]) {
+  int iPattern;
+
+  if (sweep->iNumArchivePatterns == 0 ||
+      (strlen(cName) > 4 && !strcmp(cName + strlen(cName) - 4, ".log"))) {
+    return 1;
+  }
+  for (iPattern = 0; iPattern < sweep->iNumArchivePatterns; iPattern++) {
+    if (fnmatch(sweep->caArchivePattern[iPattern], cName, 0) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*!
+Move the output of a finished member from its worker directory into the
+archive and empty the directory for the next member. Time series are stored
+as columns, all other files (including the log) as text. Files not selected
+by saArchiveFiles are deleted unread.
+*/
+void ArchiveSweepMember(SWEEP *sweep, char cDir[], int iMember,
+                        int iStatus) {
+  DIR *dir;
+  struct dirent *entry;
+  struct stat st;
+  char cName[LINE], cEntry[2 * LINE], cBody[NAMELEN];
+  char cOrder[OPTLEN * MAXARRAY];
+  char **saFile, **saContents;
+  char *cLog = NULL;
+  int iNumFiles = 0, iMaxFiles = MAXFILES, iFile, iParam, iNumValues = 0;
+  int iNumKept = 0;
+  FILE *fp = sweep->fpArchive;
+
+  saFile = malloc(iMaxFiles * sizeof(char *));
+  SweepCollectFiles(sweep, cDir, "", &saFile, &iNumFiles, &iMaxFiles);
+  qsort(saFile, iNumFiles, sizeof(char *), compare_file_names);
+
+  for (iFile = 0; iFile < iNumFiles; iFile++) {
+    if (fbSweepArchiveFile(sweep, saFile[iFile])) {
+      saFile[iNumKept++] = saFile[iFile];
+    } else {
+      snprintf(cEntry, 2 * LINE, "%s/%s", cDir, saFile[iFile]);
+      unlink(cEntry);
+      free(saFile[iFile]);
+    }
+  }
+  iNumFiles = iNumKept;
+
+  saContents = malloc(iNumFiles * sizeof(char *));
+  for (iFile = 0; iFile < iNumFiles; iFile++) {
+    snprintf(cEntry, 2 * LINE, "%s/%s", cDir, saFile[iFile]);
+    saContents[iFile] = sReadFile(cEntry);
+    unlink(cEntry);
+    if (cLog == NULL && strlen(saFile[iFile]) > 4 &&
+        !strcmp(saFile[iFile] + strlen(saFile[iFile]) - 4, ".log")) {
+      cLog = saContents[iFile];
+    }
+  }
+
+  /* The files are archived, so only empty directories are left. */
+  dir = opendir(cDir);
+  while (dir != NULL && (entry = readdir(dir)) != NULL) {
+    if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) {
+      continue;
+    }
+    snprintf(cEntry, 2 * LINE, "%s/%s", cDir, entry->d_name);
+    if (stat(cEntry, &st) == 0 && S_ISDIR(st.st_mode)) {
+      SweepRemoveTree(cEntry);
+    }
+  }
+  if (dir != NULL) {
+    closedir(dir);
+  }
+
+  sweep->iaArchived[sweep->iNumArchived] = iMember;
+  sweep->laOffset[sweep->iNumArchived]   = ftell(fp);
+  sweep->iNumArchived++;
+
+  SweepMemberName(sweep, iMember, cName);
+  fwrite("MEMB", 1, 4, fp);
+  fvSweepWriteInt(fp, iMember);
+  fvSweepWriteInt(fp, iStatus);
+  fvSweepWriteString(fp, cName);
+  for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+    iNumValues += fbSweepVaries(&sweep->Param[iParam]);
+  }
+  fvSweepWriteInt(fp, iNumValues);
+  for (iParam = 0; iParam < sweep->iNumParams; iParam++) {
+    if (fbSweepVaries(&sweep->Param[iParam])) {
+      snprintf(cEntry, 2 * LINE, "%s:%s",
+               sweep->caFile[sweep->Param[iParam].iFile],
+               sweep->Param[iParam].cName);
+      fvSweepWriteString(fp, cEntry);
+      fwrite(&sweep->daValue[iMember][iParam], sizeof(double), 1, fp);
+    }
+  }
+
+  fvSweepWriteInt(fp, iNumFiles);
+  for (iFile = 0; iFile < iNumFiles; iFile++) {
+    if (fbSweepTimeSeries(saFile[iFile], cBody)) {
+      SweepLogOutputOrder(cLog, cBody, cOrder);
+      if (fbSweepWriteColumns(fp, saFile[iFile], saContents[iFile],
+                              cOrder)) {
+        continue;
+      }
+    }
+    fvSweepWriteInt(fp, SWEEP_BLOCK_TEXT);
+    fvSweepWriteString(fp, saFile[iFile]);
+    fvSweepWriteLong(fp, strlen(saContents[iFile]));
+    fwrite(saContents[iFile], 1, strlen(saContents[iFile]), fp);
+  }
+
+  for (iFile = 0; iFile < iNumFiles; iFile++) {
+    free(saFile[iFile]);
+    free(saContents[iFile]);
+  }
+  free(saFile);
+  free(saContents);
+  fflush(fp);
+}
+
+/*!
+Run every member of the sweep described by the VSPACE file cSweepFile on
+iNumCores worker processes. Each worker is forked from this process, writes
+the member's input files into a private scratch directory and runs the
+simulation without re-initializing options or outputs. With iEnsembleSize
+K > 1, each worker takes K consecutive members, each in its own
+subdirectory, and integrates them as one ENSEMBLE (see ensemble.c). The
+output files are appended to the archive cDestFolder.vpa as soon as the
+worker finishes; every member of a worker gets the worker's exit status.
+Returns the number of members that failed.
+*/
+int Sweep(OPTIONS *options, OUTPUT *output, FILES *files,
+          fnReadOption fnRead[], fnWriteOutput fnWrite[], char cSweepFile[],
+          int iNumCores, int iVerbose) {
+  SWEEP sweep;
+  char cRoot[LINE], cName[LINE];
+  char **saWorkDir, **saMemberDir;
+  pid_t *iaPid, iPid;
+  int *iaMember, *iaNumMembers;
+  int iCore, iNext = 0, iDone = 0, iRunning = 0, iStatus, iNumFailed = 0;
+  int iMember, iNumGroups;
+  char *cTmpDir;
+
+  ReadSweep(&sweep, cSweepFile, iVerbose);
+  ExpandSweep(&sweep, iVerbose);
+
+  if (iNumCores < 1) {
+    iNumCores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (iNumCores < 1) {
+      iNumCores = 1;
+    }
+  }
+  iNumGroups = (sweep.iNumMembers + sweep.iEnsembleSize - 1) /
+               sweep.iEnsembleSize;
+  if (iNumCores > iNumGroups) {
+    iNumCores = iNumGroups;
+  }
+
+  OpenSweepArchive(&sweep);
+
+  // Scratch space for the workers
+  cTmpDir = getenv("TMPDIR");
+  snprintf(cRoot, LINE, "%s/vplanet_sweep_XXXXXX",
+           cTmpDir != NULL ? cTmpDir : "/tmp");
+  if (mkdtemp(cRoot) == NULL) {
+    fprintf(stderr, "ERROR: Unable to create scratch directory.\n");
+    exit(EXIT_WRITE);
+  }
+  saWorkDir    = malloc(iNumCores * sizeof(char *));
+  iaPid        = malloc(iNumCores * sizeof(pid_t));
+  iaMember     = malloc(iNumCores * sizeof(int));
+  iaNumMembers = malloc(iNumCores * sizeof(int));
+  for (iCore = 0; iCore < iNumCores; iCore++) {
+    saWorkDir[iCore] = malloc(2 * LINE);
+    snprintf(saWorkDir[iCore], 2 * LINE, "%s/worker%d", cRoot, iCore);
+    mkdir(saWorkDir[iCore], 0700);
+    iaPid[iCore] = 0;
+  }
+  // Ensemble members are kept apart in subdirectories of the worker's
+  saMemberDir = malloc(iNumCores * sweep.iEnsembleSize * sizeof(char *));
+  for (iCore = 0; iCore < iNumCores; iCore++) {
+    for (iMember = 0; iMember < sweep.iEnsembleSize; iMember++) {
+      saMemberDir[iCore * sweep.iEnsembleSize + iMember] = malloc(3 * LINE);
+      if (sweep.iEnsembleSize == 1) {
+        strcpy(saMemberDir[iCore], saWorkDir[iCore]);
+      } else {
+        snprintf(saMemberDir[iCore * sweep.iEnsembleSize + iMember], 3 * LINE,
+                 "%s/member%d", saWorkDir[iCore], iMember);
+        mkdir(saMemberDir[iCore * sweep.iEnsembleSize + iMember], 0700);
+      }
+    }
+  }
+  while (iDone < sweep.iNumMembers) {
+    // Keep every worker busy
+    for (iCore = 0; iCore < iNumCores && iNext < sweep.iNumMembers; iCore++) {
+      if (iaPid[iCore] != 0) {
+        continue;
+      }
+      fflush(NULL);
+      iPid = fork();
+      if (iPid < 0) {
+        fprintf(stderr, "ERROR: Unable to start sweep worker.\n");
+        exit(EXIT_EXE);
+      }
+      iaMember[iCore]     = iNext;
+      iaNumMembers[iCore] = sweep.iNumMembers - iNext < sweep.iEnsembleSize
+                                  ? sweep.iNumMembers - iNext
+                                  : sweep.iEnsembleSize;
+      if (iPid == 0) {
+        for (iMember = 0; iMember < iaNumMembers[iCore]; iMember++) {
+          WriteSweepMember(
+                &sweep, iNext + iMember,
+                saMemberDir[iCore * sweep.iEnsembleSize + iMember]);
+        }
+        if (chdir(saWorkDir[iCore]) != 0) {
+          exit(EXIT_WRITE);
+        }
+        // Workers are silent unless -v was given
+        if (sweep.iEnsembleSize == 1) {
+          RunSimulation(options, output, files, fnRead, fnWrite,
+                        sweep.caFile[sweep.iPrimaryFile],
+                        iVerbose == -1 ? 0 : iVerbose, -1);
+        } else {
+          RunEnsemble(options, output, files, fnRead, fnWrite,
+                      sweep.caFile[sweep.iPrimaryFile],
+                      &saMemberDir[iCore * sweep.iEnsembleSize],
+                      iaNumMembers[iCore], iVerbose == -1 ? 0 : iVerbose, -1);
+        }
+        exit(0);
+      }
+      iaPid[iCore] = iPid;
+      iNext += iaNumMembers[iCore];
+      iRunning++;
+    }
+
+    iPid = wait(&iStatus);
+    if (iPid < 0) {
+      break;
+    }
+    for (iCore = 0; iCore < iNumCores; iCore++) {
+      if (iaPid[iCore] == iPid) {
+        break;
+      }
+    }
+    if (iCore == iNumCores) {
+      continue;
+    }
+    iStatus = WIFEXITED(iStatus) ? WEXITSTATUS(iStatus) : -1;
+    for (iMember = 0; iMember < iaNumMembers[iCore]; iMember++) {
+      if (iStatus != 0) {
+        iNumFailed++;
+      }
+      ArchiveSweepMember(&sweep,
+                         saMemberDir[iCore * sweep.iEnsembleSize + iMember],
+                         iaMember[iCore] + iMember, iStatus);
+      if (iVerbose != 0) {
+        SweepMemberName(&sweep, iaMember[iCore] + iMember, cName);
+        printf("Member %d/%d (%s) %s.\n", iDone + 1, sweep.iNumMembers,
+               cName, iStatus == 0 ? "completed" : "FAILED");
+        fflush(stdout);
+      }
+      iDone++;
+    }
+    iaPid[iCore] = 0;
+    iRunning--;
+  }
+
+  CloseSweepArchive(&sweep);
+  SweepRemoveTree(cRoot);
+
+  if (iVerbose != 0) {
+    printf("Sweep completed: %d members, %d failed. Results in %s.\n",
+           sweep.iNumMembers, iNumFailed, sweep.cArchive);
+  }
+  return iNumFailed;
+}
+
+#else
+
+int Sweep(OPTIONS *options, OUTPUT *output, FILES *files,
+          fnReadOption fnRead[], fnWriteOutput fnWrite[], char cSweepFile[],
+          int iNumCores, int iVerbose) {
+  fprintf(stderr, "ERROR: -sweep is not available on Windows.\n");
+  exit(EXIT_EXE);
+}
+
+#endif
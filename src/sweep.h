@@ -0,0 +1,65 @@
+/**
+  @file sweep.h
+
+  @brief Built-in parameter sweeps driven by a VSPACE input file.
+
+  @date Oct 18 2026
+
+*/
+
+/* Sample modes */
+#define SWEEP_GRID 0
+#define SWEEP_RANDOM 1
+
+/* How the values of a swept option are generated */
+#define SWEEP_FIXED 0      /**< Same literal value in every member */
+#define SWEEP_REMOVE 1     /**< Option removed from every member */
+#define SWEEP_LINEAR 2     /**< Grid: n evenly spaced values, [a,b,nN] */
+#define SWEEP_LOG 3        /**< Grid: n logarithmically spaced values */
+#define SWEEP_STEP 4       /**< Grid: fixed step size, [a,b,step] */
+#define SWEEP_UNIFORM 5    /**< Random: uniform in [a,b], [a,b,u] */
+#define SWEEP_GAUSSIAN 6   /**< Random: normal, [mean,sigma,g(,min=,max=)] */
+#define SWEEP_LOGUNIFORM 7 /**< Random: uniform in log, [a,b,t] */
+
+/* Archive */
+#define SWEEP_ARCHIVE_VERSION 1
+#define SWEEP_BLOCK_TEXT 0    /**< File stored verbatim */
+#define SWEEP_BLOCK_COLUMNS 1 /**< Time series stored as columns of doubles */
+
+/* @cond DOXYGEN_OVERRIDE */
+
+void SweepInputExit(char[], int, char[]);
+void SweepReadWord(char[], int, char[], char[], int);
+void SweepExpandPath(char[]);
+char *sReadFile(char[]);
+void ReadSweepDistribution(SWEEP *, SWEEPPARAM *, char[], int, char[]);
+void ReadSweep(SWEEP *, char[], int);
+double fdSweepUniform();
+double fdSweepGaussian(SWEEPPARAM *);
+double fdSweepGridValue(SWEEPPARAM *, int);
+int fbSweepVaries(SWEEPPARAM *);
+void ExpandSweep(SWEEP *, int);
+int fbSweepLineContinues(char[]);
+int fbSweepLineSetsOption(char[], char[]);
+void WriteSweepMember(SWEEP *, int, char[]);
+void SweepMemberName(SWEEP *, int, char[]);
+#ifndef VPLANET_ON_WINDOWS
+void SweepRemoveTree(char[]);
+int fbSweepIsInput(SWEEP *, char[]);
+int compare_file_names(const void *, const void *);
+void fvSweepWriteInt(FILE *, int);
+void fvSweepWriteLong(FILE *, long);
+void fvSweepWriteString(FILE *, char[]);
+void OpenSweepArchive(SWEEP *);
+void CloseSweepArchive(SWEEP *);
+void SweepLogOutputOrder(char *, char[], char[]);
+int fbSweepTimeSeries(char[], char[]);
+int fbSweepWriteColumns(FILE *, char[], char *, char[]);
+void SweepCollectFiles(SWEEP *, char[], char[], char ***, int *, int *);
+int fbSweepArchiveFile(SWEEP *, char[]);
+void ArchiveSweepMember(SWEEP *, char[], int, int);
+#endif
+int Sweep(OPTIONS *, OUTPUT *, FILES *, fnReadOption[], fnWriteOutput[],
+          char[], int, int);
+
+/* @endcond */
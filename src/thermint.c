@@ -5395,6 +5395,66 @@ double fdTDotCore(BODY *body, SYSTEM *system, int *iaBody) {
          (SPECLATENTICB + SPECPOWGRAVIC));
   return foo;
 }
+/**
+  Function compute time derivative of average mantle temperature for several
+  members of an ensemble, as in fdTDotMan
+
+  @param pBody Body struct of each member
+  @param pSystem System struct of each member
+  @param iaBody Index of body
+  @param iNumLanes Number of members
+  @param daDeriv Time derivative of each member
+  @param daWork Scratch space
+*/
+void fvTDotManEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                       int iNumLanes, double *daDeriv, double *daWork) {
+  int iBody = iaBody[0], iLane;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daWork[iLane] = pBody[iLane][iBody].dHflowSecMan;
+  }
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    daDeriv[iLane] = -daWork[iLane] / ((EMASSMAN) * (SPECHEATMAN));
+  }
+}
+/**
+  Function compute time derivative of average core temperature for several
+  members of an ensemble, as in fdTDotCore
+
+  @param pBody Body struct of each member
+  @param pSystem System struct of each member
+  @param iaBody Index of body
+  @param iNumLanes Number of members
+  @param daDeriv Time derivative of each member
+  @param daWork Scratch space
+*/
+void fvTDotCoreEnsemble(BODY **pBody, SYSTEM **pSystem, int *iaBody,
+                        int iNumLanes, double *daDeriv, double *daWork) {
+  int iBody = iaBody[0], iLane;
+  double areaic;
+  double *daRIC2       = daWork;
+  double *daHflowCMB   = daWork + iNumLanes;
+  double *daRadPower   = daWork + 2 * iNumLanes;
+  double *daAdJump     = daWork + 3 * iNumLanes;
+  double *daDRICDTCMB  = daWork + 4 * iNumLanes;
+  BODY *body;
+
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    body               = pBody[iLane];
+    daRIC2[iLane]      = pow(body[iBody].dRIC, 2.0);
+    daHflowCMB[iLane]  = body[iBody].dHflowCMB;
+    daRadPower[iLane]  = body[iBody].dRadPowerCore;
+    daAdJump[iLane]    = body[iBody].dAdJumpC2CMB;
+    daDRICDTCMB[iLane] = body[iBody].dDRICDTCMB;
+  }
+  for (iLane = 0; iLane < iNumLanes; iLane++) {
+    areaic         = 4.0 * PI * daRIC2[iLane];
+    daDeriv[iLane] = (-daHflowCMB[iLane] + daRadPower[iLane]) /
+                     ((EMASSCORE) * (SPECHEATCORE)-areaic * (EDENSIC) *
+                      (daAdJump[iLane]) * daDRICDTCMB[iLane] *
+                      (SPECLATENTICB + SPECPOWGRAVIC));
+  }
+}
 
 
 /****************************************************************************/
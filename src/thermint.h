@@ -729,6 +729,8 @@ void fvLogBodyThermint(BODY *, CONTROL *, OUTPUT *, SYSTEM *, UPDATE *,
 /* Thermal Functions */
 double fdTDotMan(BODY *, SYSTEM *, int *);
 double fdTDotCore(BODY *, SYSTEM *, int *);
+void fvTDotManEnsemble(BODY **, SYSTEM **, int *, int, double *, double *);
+void fvTDotCoreEnsemble(BODY **, SYSTEM **, int *, int, double *, double *);
 double fdTUMan(BODY *, int);
 double fdTLMan(BODY *, int);
 double fdTCMB(BODY *, int);
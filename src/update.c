@@ -13,7 +13,8 @@ void InitializeUpdateBodyPerts(CONTROL *control, UPDATE *update, int iBody) {
   for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
     for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
       control->Evolve.tmpUpdate[iBody].iaBody[iVar][iEqn] =
-            malloc(update[iBody].iNumBodies[iVar][iEqn] * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumBodies[iVar][iEqn] * sizeof(int));
     }
   }
 }
@@ -125,7 +126,9 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
   int iFoo = 0; // Dummy variable needed for some typedef'd functions
 
   // Allocate the firt dimension of the Update matrix to be the number of bodies
-  *fnUpdate = malloc(control->Evolve.iNumBodies * sizeof(fnUpdateVariable **));
+  *fnUpdate =
+        ArenaAlloc(&control->Arena,
+                   control->Evolve.iNumBodies * sizeof(fnUpdateVariable **));
 
   // For each body, determine how many independent variables need updating.
   for (iBody = 0; iBody < control->Evolve.iNumBodies; iBody++) {
@@ -220,44 +223,64 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
 
     // The second dimension of the Update matrix is the variables
     (*fnUpdate)[iBody] =
-          malloc(update[iBody].iNumVars * sizeof(fnUpdateVariable *));
-    update[iBody].iaVar    = malloc(update[iBody].iNumVars * sizeof(int));
-    update[iBody].iNumEqns = malloc(update[iBody].iNumVars * sizeof(int));
-    update[iBody].iaType   = malloc(update[iBody].iNumVars * sizeof(int *));
-    update[iBody].iaModule = malloc(update[iBody].iNumVars * sizeof(int *));
-    update[iBody].pdVar    = malloc(update[iBody].iNumVars * sizeof(double *));
-    update[iBody].daDeriv  = malloc(update[iBody].iNumVars * sizeof(double));
+          ArenaAlloc(&control->Arena,
+                     update[iBody].iNumVars * sizeof(fnUpdateVariable *));
+    update[iBody].iaVar =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int));
+    update[iBody].iNumEqns =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int));
+    update[iBody].iaType =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int *));
+    update[iBody].iaModule =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int *));
+    update[iBody].pdVar =
+          ArenaAlloc(&control->Arena,
+                     update[iBody].iNumVars * sizeof(double *));
+    update[iBody].saVarName =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(char *));
+    update[iBody].daDeriv =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(double));
     update[iBody].daDerivProc =
-          malloc(update[iBody].iNumVars * sizeof(double *));
-    update[iBody].iNumBodies = malloc(update[iBody].iNumVars * sizeof(int *));
-    update[iBody].iaBody     = malloc(update[iBody].iNumVars * sizeof(int **));
+          ArenaAlloc(&control->Arena,
+                     update[iBody].iNumVars * sizeof(double *));
+    update[iBody].iNumBodies =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int *));
+    update[iBody].iaBody =
+          ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int **));
 
     // May also have to allocate space for the temp UPDATE
     if (control->Evolve.iOneStep == RUNGEKUTTA) {
       control->Evolve.tmpUpdate[iBody].iaVar =
-            malloc(update[iBody].iNumVars * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int));
       control->Evolve.tmpUpdate[iBody].iNumEqns =
-            malloc(update[iBody].iNumVars * sizeof(double));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumVars * sizeof(double));
       control->Evolve.tmpUpdate[iBody].iaType =
-            malloc(update[iBody].iNumVars * sizeof(int *));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int *));
       control->Evolve.tmpUpdate[iBody].iaModule =
-            malloc(update[iBody].iNumVars * sizeof(int *));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int *));
       control->Evolve.tmpUpdate[iBody].pdVar =
-            malloc(update[iBody].iNumVars * sizeof(double *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumVars * sizeof(double *));
       control->Evolve.tmpUpdate[iBody].daDeriv =
-            malloc(update[iBody].iNumVars * sizeof(double *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumVars * sizeof(double *));
       control->Evolve.tmpUpdate[iBody].daDerivProc =
-            malloc(update[iBody].iNumVars * sizeof(double *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumVars * sizeof(double *));
       control->Evolve.tmpUpdate[iBody].iNumBodies =
-            malloc(update[iBody].iNumVars * sizeof(int *));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVars * sizeof(int *));
       control->Evolve.tmpUpdate[iBody].iaBody =
-            malloc(update[iBody].iNumVars * sizeof(int **));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumVars * sizeof(int **));
     }
     for (iSubStep = 0; iSubStep < 4; iSubStep++) {
       control->Evolve.daDeriv[iSubStep][iBody] =
-            malloc(update[iBody].iNumVars * sizeof(double));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumVars * sizeof(double));
       control->Evolve.daDerivProc[iSubStep][iBody] =
-            malloc(update[iBody].iNumVars * sizeof(double*));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumVars * sizeof(double*));
     }
 
     /* Now we malloc some pointers, and perform some initializations for the
@@ -268,34 +291,39 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
 
     update[iBody].iVelX = -1;
     if (update[iBody].iNumVelX) {
-      update[iBody].iVelX          = iVar;
-      update[iBody].iaVar[iVar]    = VVELX;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumVelX;
-      update[iBody].pdVar[iVar]    = &body[iBody].dVelX;
+      update[iBody].iVelX           = iVar;
+      update[iBody].iaVar[iVar]     = VVELX;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumVelX;
+      update[iBody].pdVar[iVar]     = &body[iBody].dVelX;
+      update[iBody].saVarName[iVar] = "VelX";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumVelX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelX * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumVelX * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumVelX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelX * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelX * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumVelX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelX * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dVelX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumVelX * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumVelX * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumVelX * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumVelX * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumVelX * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumVelX * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumVelX * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -305,41 +333,48 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iVelY = -1;
     if (update[iBody].iNumVelY) {
-      update[iBody].iVelY          = iVar;
-      update[iBody].iaVar[iVar]    = VVELY;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumVelY;
-      update[iBody].pdVar[iVar]    = &body[iBody].dVelY;
+      update[iBody].iVelY           = iVar;
+      update[iBody].iaVar[iVar]     = VVELY;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumVelY;
+      update[iBody].pdVar[iVar]     = &body[iBody].dVelY;
+      update[iBody].saVarName[iVar] = "VelY";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumVelY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelY * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumVelY * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumVelY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelY * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelY * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumVelY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelY * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dVelY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumVelY * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumVelY * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumVelY * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumVelY * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumVelY * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumVelY * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumVelY * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -349,41 +384,48 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iVelZ = -1;
     if (update[iBody].iNumVelZ) {
-      update[iBody].iVelZ          = iVar;
-      update[iBody].iaVar[iVar]    = VVELZ;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumVelZ;
-      update[iBody].pdVar[iVar]    = &body[iBody].dVelZ;
+      update[iBody].iVelZ           = iVar;
+      update[iBody].iaVar[iVar]     = VVELZ;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumVelZ;
+      update[iBody].pdVar[iVar]     = &body[iBody].dVelZ;
+      update[iBody].saVarName[iVar] = "VelZ";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumVelZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelZ * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumVelZ * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumVelZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelZ * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelZ * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumVelZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumVelZ * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dVelZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumVelZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumVelZ * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumVelZ * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumVelZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumVelZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumVelZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumVelZ * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumVelZ * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -393,42 +435,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
        iVar++;
     }
 
     update[iBody].iPositionX = -1;
     if (update[iBody].iNumPositionX) {
-      update[iBody].iPositionX     = iVar;
-      update[iBody].iaVar[iVar]    = VPOSITIONX;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumPositionX;
-      update[iBody].pdVar[iVar]    = &body[iBody].dPositionX;
+      update[iBody].iPositionX      = iVar;
+      update[iBody].iaVar[iVar]     = VPOSITIONX;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumPositionX;
+      update[iBody].pdVar[iVar]     = &body[iBody].dPositionX;
+      update[iBody].saVarName[iVar] = "PositionX";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumPositionX * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionX * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumPositionX * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionX * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumPositionX * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionX * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumPositionX * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionX * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPositionX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumPositionX * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumPositionX * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionX * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumPositionX * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumPositionX * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumPositionX * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionX * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -438,42 +493,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                           iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iPositionY = -1;
     if (update[iBody].iNumPositionY) {
-      update[iBody].iPositionY     = iVar;
-      update[iBody].iaVar[iVar]    = VPOSITIONY;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumPositionY;
-      update[iBody].pdVar[iVar]    = &body[iBody].dPositionY;
+      update[iBody].iPositionY      = iVar;
+      update[iBody].iaVar[iVar]     = VPOSITIONY;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumPositionY;
+      update[iBody].pdVar[iVar]     = &body[iBody].dPositionY;
+      update[iBody].saVarName[iVar] = "PositionY";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumPositionY * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionY * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumPositionY * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionY * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumPositionY * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionY * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumPositionY * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionY * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPositionY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumPositionY * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumPositionY * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionY * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumPositionY * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumPositionY * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumPositionY * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionY * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -483,42 +551,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                           iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iPositionZ = -1;
     if (update[iBody].iNumPositionZ) {
-      update[iBody].iPositionZ     = iVar;
-      update[iBody].iaVar[iVar]    = VPOSITIONZ;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumPositionZ;
-      update[iBody].pdVar[iVar]    = &body[iBody].dPositionZ;
+      update[iBody].iPositionZ      = iVar;
+      update[iBody].iaVar[iVar]     = VPOSITIONZ;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumPositionZ;
+      update[iBody].pdVar[iVar]     = &body[iBody].dPositionZ;
+      update[iBody].saVarName[iVar] = "PositionZ";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumPositionZ * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionZ * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumPositionZ * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionZ * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumPositionZ * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionZ * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumPositionZ * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPositionZ * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPositionZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumPositionZ * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumPositionZ * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionZ * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumPositionZ * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumPositionZ * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumPositionZ * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPositionZ * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -528,8 +609,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                           iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
     /* HERE MAGMOC
@@ -541,31 +624,42 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaVar[iVar]     = VWATERMASSMOATM;
       update[iBody].iNumEqns[iVar]  = update[iBody].iNumWaterMassMOAtm;
       update[iBody].pdVar[iVar]     = &body[iBody].dWaterMassMOAtm;
+      update[iBody].saVarName[iVar] = "WaterMassMOAtm";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassMOAtm * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassMOAtm * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassMOAtm * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassMOAtm * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dWaterMassMOAtm;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumWaterMassMOAtm * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassMOAtm * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumWaterMassMOAtm * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassMOAtm * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -575,42 +669,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
     /* until HERE */
     update[iBody].iWaterMassSol = -1;
     if (update[iBody].iNumWaterMassSol) {
-      update[iBody].iWaterMassSol  = iVar;
-      update[iBody].iaVar[iVar]    = VWATERMASSSOL;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumWaterMassSol;
-      update[iBody].pdVar[iVar]    = &body[iBody].dWaterMassSol;
+      update[iBody].iWaterMassSol   = iVar;
+      update[iBody].iaVar[iVar]     = VWATERMASSSOL;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumWaterMassSol;
+      update[iBody].pdVar[iVar]     = &body[iBody].dWaterMassSol;
+      update[iBody].saVarName[iVar] = "WaterMassSol";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumWaterMassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassSol * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumWaterMassSol * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassSol * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumWaterMassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassSol * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumWaterMassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumWaterMassSol * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dWaterMassSol;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumWaterMassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumWaterMassSol * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassSol * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumWaterMassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumWaterMassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumWaterMassSol * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumWaterMassSol * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -620,42 +727,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iSurfTemp = -1;
     if (update[iBody].iNumSurfTemp) {
-      update[iBody].iSurfTemp      = iVar;
-      update[iBody].iaVar[iVar]    = VSURFTEMP;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumSurfTemp;
-      update[iBody].pdVar[iVar]    = &body[iBody].dSurfTemp;
+      update[iBody].iSurfTemp       = iVar;
+      update[iBody].iaVar[iVar]     = VSURFTEMP;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumSurfTemp;
+      update[iBody].pdVar[iVar]     = &body[iBody].dSurfTemp;
+      update[iBody].saVarName[iVar] = "SurfTemp";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumSurfTemp * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfTemp * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumSurfTemp * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfTemp * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumSurfTemp * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfTemp * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumSurfTemp * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfTemp * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSurfTemp;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumSurfTemp * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumSurfTemp * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfTemp * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumSurfTemp * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumSurfTemp * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumSurfTemp * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfTemp * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -665,42 +785,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                          iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iSolidRadius = -1;
     if (update[iBody].iNumSolidRadius) {
-      update[iBody].iSolidRadius   = iVar;
-      update[iBody].iaVar[iVar]    = VSOLIDRADIUS;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumSolidRadius;
-      update[iBody].pdVar[iVar]    = &body[iBody].dSolidRadius;
+      update[iBody].iSolidRadius    = iVar;
+      update[iBody].iaVar[iVar]     = VSOLIDRADIUS;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumSolidRadius;
+      update[iBody].pdVar[iVar]     = &body[iBody].dSolidRadius;
+      update[iBody].saVarName[iVar] = "SolidRadius";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumSolidRadius * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSolidRadius * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumSolidRadius * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSolidRadius * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumSolidRadius * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSolidRadius * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumSolidRadius * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSolidRadius * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSolidRadius;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumSolidRadius * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSolidRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumSolidRadius * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSolidRadius * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumSolidRadius * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSolidRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumSolidRadius * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSolidRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumSolidRadius * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSolidRadius * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -710,42 +843,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                             iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iPotTemp = -1;
     if (update[iBody].iNumPotTemp) {
-      update[iBody].iPotTemp       = iVar;
-      update[iBody].iaVar[iVar]    = VPOTTEMP;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumPotTemp;
-      update[iBody].pdVar[iVar]    = &body[iBody].dPotTemp;
+      update[iBody].iPotTemp        = iVar;
+      update[iBody].iaVar[iVar]     = VPOTTEMP;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumPotTemp;
+      update[iBody].pdVar[iVar]     = &body[iBody].dPotTemp;
+      update[iBody].saVarName[iVar] = "PotTemp";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumPotTemp * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPotTemp * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumPotTemp * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPotTemp * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumPotTemp * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPotTemp * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumPotTemp * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumPotTemp * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPotTemp;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumPotTemp * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPotTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumPotTemp * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPotTemp * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumPotTemp * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPotTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumPotTemp * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPotTemp * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumPotTemp * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPotTemp * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -755,8 +901,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                         iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -766,31 +914,42 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaVar[iVar]      = VOXYGENMASSMOATM;
       update[iBody].iNumEqns[iVar]   = update[iBody].iNumOxygenMassMOAtm;
       update[iBody].pdVar[iVar]      = &body[iBody].dOxygenMassMOAtm;
+      update[iBody].saVarName[iVar]  = "OxygenMassMOAtm";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassMOAtm * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassMOAtm * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassMOAtm * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassMOAtm * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMassMOAtm;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassMOAtm * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumOxygenMassMOAtm * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassMOAtm * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -800,42 +959,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
        iVar++;
     }
     /* until HERE */
     update[iBody].iOxygenMassSol = -1;
     if (update[iBody].iNumOxygenMassSol) {
-      update[iBody].iOxygenMassSol = iVar;
-      update[iBody].iaVar[iVar]    = VOXYGENMASSSOL;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumOxygenMassSol;
-      update[iBody].pdVar[iVar]    = &body[iBody].dOxygenMassSol;
+      update[iBody].iOxygenMassSol  = iVar;
+      update[iBody].iaVar[iVar]     = VOXYGENMASSSOL;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumOxygenMassSol;
+      update[iBody].pdVar[iVar]     = &body[iBody].dOxygenMassSol;
+      update[iBody].saVarName[iVar] = "OxygenMassSol";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSol * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumOxygenMassSol * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSol * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSol * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSol * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMassSol;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumOxygenMassSol * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSol * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumOxygenMassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumOxygenMassSol * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSol * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -845,8 +1017,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -856,31 +1030,42 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaVar[iVar]        = VHYDROGENMASSSPACE;
       update[iBody].iNumEqns[iVar]     = update[iBody].iNumHydrogenMassSpace;
       update[iBody].pdVar[iVar]        = &body[iBody].dHydrogenMassSpace;
+      update[iBody].saVarName[iVar]    = "HydrogenMassSpace";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumHydrogenMassSpace * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumHydrogenMassSpace * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumHydrogenMassSpace * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumHydrogenMassSpace * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dHydrogenMassSpace;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumHydrogenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumHydrogenMassSpace * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumHydrogenMassSpace * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumHydrogenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumHydrogenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumHydrogenMassSpace * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumHydrogenMassSpace * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -890,8 +1075,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -901,31 +1088,42 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaVar[iVar]      = VOXYGENMASSSPACE;
       update[iBody].iNumEqns[iVar]   = update[iBody].iNumOxygenMassSpace;
       update[iBody].pdVar[iVar]      = &body[iBody].dOxygenMassSpace;
+      update[iBody].saVarName[iVar]  = "OxygenMassSpace";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSpace * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumOxygenMassSpace * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSpace * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSpace * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMassSpace * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMassSpace;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumOxygenMassSpace * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSpace * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumOxygenMassSpace * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSpace * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumOxygenMassSpace * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMassSpace * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -935,42 +1133,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iCO2MassMOAtm = -1;
     if (update[iBody].iNumCO2MassMOAtm) {
-      update[iBody].iCO2MassMOAtm  = iVar;
-      update[iBody].iaVar[iVar]    = VCO2MASSMOATM;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCO2MassMOAtm;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCO2MassMOAtm;
+      update[iBody].iCO2MassMOAtm   = iVar;
+      update[iBody].iaVar[iVar]     = VCO2MASSMOATM;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCO2MassMOAtm;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCO2MassMOAtm;
+      update[iBody].saVarName[iVar] = "CO2MassMOAtm";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassMOAtm * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassMOAtm * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassMOAtm * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassMOAtm * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCO2MassMOAtm;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCO2MassMOAtm * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassMOAtm * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassMOAtm * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCO2MassMOAtm * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassMOAtm * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -980,42 +1191,55 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     update[iBody].iCO2MassSol = -1;
     if (update[iBody].iNumCO2MassSol) {
-      update[iBody].iCO2MassSol    = iVar;
-      update[iBody].iaVar[iVar]    = VCO2MASSSOL;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCO2MassSol;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCO2MassSol;
+      update[iBody].iCO2MassSol     = iVar;
+      update[iBody].iaVar[iVar]     = VCO2MASSSOL;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCO2MassSol;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCO2MassSol;
+      update[iBody].saVarName[iVar] = "CO2MassSol";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCO2MassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassSol * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCO2MassSol * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassSol * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumCO2MassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassSol * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCO2MassSol * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCO2MassSol * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCO2MassSol;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCO2MassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCO2MassSol * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassSol * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCO2MassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCO2MassSol * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassSol * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCO2MassSol * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCO2MassSol * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1025,8 +1249,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
        iVar++;
     }
     /* HERE
@@ -1036,35 +1262,46 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     /* 26Al Core */
     update[iBody].i26AlCore = -1;
     if (update[iBody].iNum26AlCore) {
-      update[iBody].i26AlCore      = iVar;
-      update[iBody].iaVar[iVar]    = VNUM26ALCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum26AlCore;
-      update[iBody].pdVar[iVar]    = &body[iBody].d26AlNumCore;
+      update[iBody].i26AlCore       = iVar;
+      update[iBody].iaVar[iVar]     = VNUM26ALCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum26AlCore;
+      update[iBody].pdVar[iVar]     = &body[iBody].d26AlNumCore;
+      update[iBody].saVarName[iVar] = "26AlNumCore";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum26AlCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlCore * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum26AlCore * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlCore * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum26AlCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlCore * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum26AlCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlCore * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d26AlNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum26AlCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum26AlCore * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlCore * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum26AlCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum26AlCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum26AlCore * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlCore * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1074,43 +1311,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                             iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 26Al Mantle */
     update[iBody].i26AlMan = -1;
     if (update[iBody].iNum26AlMan) {
-      update[iBody].i26AlMan       = iVar;
-      update[iBody].iaVar[iVar]    = VNUM26ALMAN;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum26AlMan;
-      update[iBody].pdVar[iVar]    = &body[iBody].d26AlNumMan;
+      update[iBody].i26AlMan        = iVar;
+      update[iBody].iaVar[iVar]     = VNUM26ALMAN;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum26AlMan;
+      update[iBody].pdVar[iVar]     = &body[iBody].d26AlNumMan;
+      update[iBody].saVarName[iVar] = "26AlNumMan";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum26AlMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlMan * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum26AlMan * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlMan * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum26AlMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlMan * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum26AlMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum26AlMan * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d26AlNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum26AlMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum26AlMan * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlMan * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum26AlMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum26AlMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum26AlMan * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum26AlMan * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1120,43 +1370,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 40K Core */
     update[iBody].i40KCore = -1;
     if (update[iBody].iNum40KCore) {
-      update[iBody].i40KCore       = iVar;
-      update[iBody].iaVar[iVar]    = VNUM40KCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum40KCore;
-      update[iBody].pdVar[iVar]    = &body[iBody].d40KNumCore;
+      update[iBody].i40KCore        = iVar;
+      update[iBody].iaVar[iVar]     = VNUM40KCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum40KCore;
+      update[iBody].pdVar[iVar]     = &body[iBody].d40KNumCore;
+      update[iBody].saVarName[iVar] = "40KNumCore";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum40KCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCore * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum40KCore * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCore * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum40KCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCore * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum40KCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCore * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d40KNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum40KCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum40KCore * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCore * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum40KCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum40KCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum40KCore * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCore * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1166,43 +1429,53 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 40K Mantle */
     update[iBody].i40KMan = -1;
     if (update[iBody].iNum40KMan) {
-      update[iBody].i40KMan        = iVar;
-      update[iBody].iaVar[iVar]    = VNUM40KMAN;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum40KMan;
-      update[iBody].pdVar[iVar]    = &body[iBody].d40KNumMan;
+      update[iBody].i40KMan         = iVar;
+      update[iBody].iaVar[iVar]     = VNUM40KMAN;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum40KMan;
+      update[iBody].pdVar[iVar]     = &body[iBody].d40KNumMan;
+      update[iBody].saVarName[iVar] = "40KNumMan";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum40KMan * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNum40KMan * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum40KMan * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KMan * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum40KMan * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNum40KMan * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum40KMan * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNum40KMan * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d40KNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum40KMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum40KMan * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KMan * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum40KMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum40KMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum40KMan * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KMan * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1212,43 +1485,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                           iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 40K Crust */
     update[iBody].i40KCrust = -1;
     if (update[iBody].iNum40KCrust) {
-      update[iBody].i40KCrust      = iVar;
-      update[iBody].iaVar[iVar]    = VNUM40KCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum40KCrust;
-      update[iBody].pdVar[iVar]    = &body[iBody].d40KNumCrust;
+      update[iBody].i40KCrust       = iVar;
+      update[iBody].iaVar[iVar]     = VNUM40KCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum40KCrust;
+      update[iBody].pdVar[iVar]     = &body[iBody].d40KNumCrust;
+      update[iBody].saVarName[iVar] = "40KNumCrust";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum40KCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCrust * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum40KCrust * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCrust * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum40KCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCrust * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum40KCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum40KCrust * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d40KNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum40KCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum40KCrust * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCrust * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum40KCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum40KCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum40KCrust * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum40KCrust * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1258,43 +1544,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                             iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 232Th Core */
     update[iBody].i232ThCore = -1;
     if (update[iBody].iNum232ThCore) {
-      update[iBody].i232ThCore     = iVar;
-      update[iBody].iaVar[iVar]    = VNUM232THCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum232ThCore;
-      update[iBody].pdVar[iVar]    = &body[iBody].d232ThNumCore;
+      update[iBody].i232ThCore      = iVar;
+      update[iBody].iaVar[iVar]     = VNUM232THCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum232ThCore;
+      update[iBody].pdVar[iVar]     = &body[iBody].d232ThNumCore;
+      update[iBody].saVarName[iVar] = "232ThNumCore";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum232ThCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCore * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum232ThCore * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCore * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum232ThCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCore * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum232ThCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCore * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d232ThNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum232ThCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum232ThCore * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCore * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum232ThCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum232ThCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum232ThCore * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCore * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1304,43 +1603,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 232Th Mantle */
     update[iBody].i232ThMan = -1;
     if (update[iBody].iNum232ThMan) {
-      update[iBody].i232ThMan      = iVar;
-      update[iBody].iaVar[iVar]    = VNUM232THMAN;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum232ThMan;
-      update[iBody].pdVar[iVar]    = &body[iBody].d232ThNumMan;
+      update[iBody].i232ThMan       = iVar;
+      update[iBody].iaVar[iVar]     = VNUM232THMAN;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum232ThMan;
+      update[iBody].pdVar[iVar]     = &body[iBody].d232ThNumMan;
+      update[iBody].saVarName[iVar] = "232ThNumMan";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum232ThMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThMan * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum232ThMan * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThMan * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum232ThMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThMan * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum232ThMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThMan * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d232ThNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum232ThMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum232ThMan * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThMan * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum232ThMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum232ThMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum232ThMan * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThMan * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1350,43 +1662,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                             iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 232Th Crust */
     update[iBody].i232ThCrust = -1;
     if (update[iBody].iNum232ThCrust) {
-      update[iBody].i232ThCrust    = iVar;
-      update[iBody].iaVar[iVar]    = VNUM232THCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum232ThCrust;
-      update[iBody].pdVar[iVar]    = &body[iBody].d232ThNumCrust;
+      update[iBody].i232ThCrust     = iVar;
+      update[iBody].iaVar[iVar]     = VNUM232THCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum232ThCrust;
+      update[iBody].pdVar[iVar]     = &body[iBody].d232ThNumCrust;
+      update[iBody].saVarName[iVar] = "232ThNumCrust";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum232ThCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCrust * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum232ThCrust * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCrust * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum232ThCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCrust * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum232ThCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum232ThCrust * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d232ThNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum232ThCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum232ThCrust * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCrust * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum232ThCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum232ThCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum232ThCrust * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum232ThCrust * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1396,43 +1721,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 235U Core */
     update[iBody].i235UCore = -1;
     if (update[iBody].iNum235UCore) {
-      update[iBody].i235UCore      = iVar;
-      update[iBody].iaVar[iVar]    = VNUM235UCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum235UCore;
-      update[iBody].pdVar[iVar]    = &body[iBody].d235UNumCore;
+      update[iBody].i235UCore       = iVar;
+      update[iBody].iaVar[iVar]     = VNUM235UCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum235UCore;
+      update[iBody].pdVar[iVar]     = &body[iBody].d235UNumCore;
+      update[iBody].saVarName[iVar] = "235UNumCore";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum235UCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCore * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum235UCore * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCore * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum235UCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCore * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum235UCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCore * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d235UNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum235UCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum235UCore * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCore * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum235UCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum235UCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum235UCore * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCore * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1442,43 +1780,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                             iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 235U Mantle */
     update[iBody].i235UMan = -1;
     if (update[iBody].iNum235UMan) {
-      update[iBody].i235UMan       = iVar;
-      update[iBody].iaVar[iVar]    = VNUM235UMAN;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum235UMan;
-      update[iBody].pdVar[iVar]    = &body[iBody].d235UNumMan;
+      update[iBody].i235UMan        = iVar;
+      update[iBody].iaVar[iVar]     = VNUM235UMAN;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum235UMan;
+      update[iBody].pdVar[iVar]     = &body[iBody].d235UNumMan;
+      update[iBody].saVarName[iVar] = "235UNumMan";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum235UMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UMan * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum235UMan * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UMan * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum235UMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UMan * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum235UMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UMan * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d235UNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum235UMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum235UMan * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UMan * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum235UMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum235UMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum235UMan * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UMan * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1488,43 +1839,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 235U Crust */
     update[iBody].i235UCrust = -1;
     if (update[iBody].iNum235UCrust) {
-      update[iBody].i235UCrust     = iVar;
-      update[iBody].iaVar[iVar]    = VNUM235UCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum235UCrust;
-      update[iBody].pdVar[iVar]    = &body[iBody].d235UNumCrust;
+      update[iBody].i235UCrust      = iVar;
+      update[iBody].iaVar[iVar]     = VNUM235UCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum235UCrust;
+      update[iBody].pdVar[iVar]     = &body[iBody].d235UNumCrust;
+      update[iBody].saVarName[iVar] = "235UNumCrust";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum235UCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCrust * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum235UCrust * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCrust * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum235UCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCrust * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum235UCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum235UCrust * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d235UNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum235UCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum235UCrust * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCrust * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum235UCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum235UCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum235UCrust * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum235UCrust * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1534,43 +1898,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 238U Core */
     update[iBody].i238UCore = -1;
     if (update[iBody].iNum238UCore) {
-      update[iBody].i238UCore      = iVar;
-      update[iBody].iaVar[iVar]    = VNUM238UCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum238UCore;
-      update[iBody].pdVar[iVar]    = &body[iBody].d238UNumCore;
+      update[iBody].i238UCore       = iVar;
+      update[iBody].iaVar[iVar]     = VNUM238UCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum238UCore;
+      update[iBody].pdVar[iVar]     = &body[iBody].d238UNumCore;
+      update[iBody].saVarName[iVar] = "238UNumCore";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum238UCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCore * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum238UCore * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCore * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum238UCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCore * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum238UCore * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCore * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d238UNumCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum238UCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum238UCore * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCore * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum238UCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum238UCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum238UCore * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCore * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1580,43 +1957,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                             iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 238U Mantle */
     update[iBody].i238UMan = -1;
     if (update[iBody].iNum238UMan) {
-      update[iBody].i238UMan       = iVar;
-      update[iBody].iaVar[iVar]    = VNUM238UMAN;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum238UMan;
-      update[iBody].pdVar[iVar]    = &body[iBody].d238UNumMan;
+      update[iBody].i238UMan        = iVar;
+      update[iBody].iaVar[iVar]     = VNUM238UMAN;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum238UMan;
+      update[iBody].pdVar[iVar]     = &body[iBody].d238UNumMan;
+      update[iBody].saVarName[iVar] = "238UNumMan";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum238UMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UMan * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum238UMan * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UMan * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum238UMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UMan * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum238UMan * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UMan * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d238UNumMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum238UMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum238UMan * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UMan * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum238UMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum238UMan * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum238UMan * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UMan * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1626,43 +2016,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* 238U Crust */
     update[iBody].i238UCrust = -1;
     if (update[iBody].iNum238UCrust) {
-      update[iBody].i238UCrust     = iVar;
-      update[iBody].iaVar[iVar]    = VNUM238UCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNum238UCrust;
-      update[iBody].pdVar[iVar]    = &body[iBody].d238UNumCrust;
+      update[iBody].i238UCrust      = iVar;
+      update[iBody].iaVar[iVar]     = VNUM238UCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNum238UCrust;
+      update[iBody].pdVar[iVar]     = &body[iBody].d238UNumCrust;
+      update[iBody].saVarName[iVar] = "238UNumCrust";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNum238UCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCrust * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNum238UCrust * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCrust * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNum238UCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCrust * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNum238UCrust * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNum238UCrust * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].d238UNumCrust;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNum238UCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNum238UCrust * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCrust * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNum238UCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNum238UCrust * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCrust * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNum238UCrust * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNum238UCrust * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1672,43 +2075,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Atmospheric Envelope Mass
     update[iBody].iEnvelopeMass = -1;
     if (update[iBody].iNumEnvelopeMass) {
-      update[iBody].iEnvelopeMass  = iVar;
-      update[iBody].iaVar[iVar]    = VENVELOPEMASS;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumEnvelopeMass;
-      update[iBody].pdVar[iVar]    = &body[iBody].dEnvelopeMass;
+      update[iBody].iEnvelopeMass   = iVar;
+      update[iBody].iaVar[iVar]     = VENVELOPEMASS;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumEnvelopeMass;
+      update[iBody].pdVar[iVar]     = &body[iBody].dEnvelopeMass;
+      update[iBody].saVarName[iVar] = "EnvelopeMass";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumEnvelopeMass * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumEnvelopeMass * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumEnvelopeMass * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumEnvelopeMass * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumEnvelopeMass * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEnvelopeMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEnvelopeMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumEnvelopeMass * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEnvelopeMass * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEnvelopeMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumEnvelopeMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEnvelopeMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumEnvelopeMass * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEnvelopeMass * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1718,8 +2134,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -1732,35 +2150,46 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
 
     update[iBody].iDynEllip = -1;
     if (update[iBody].iNumDynEllip) {
-      update[iBody].iDynEllip      = iVar;
-      update[iBody].iaVar[iVar]    = VDYNELLIP;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumDynEllip;
-      update[iBody].pdVar[iVar]    = &body[iBody].dDynEllip;
+      update[iBody].iDynEllip       = iVar;
+      update[iBody].iaVar[iVar]     = VDYNELLIP;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumDynEllip;
+      update[iBody].pdVar[iVar]     = &body[iBody].dDynEllip;
+      update[iBody].saVarName[iVar] = "DynEllip";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumDynEllip * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumDynEllip * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumDynEllip * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumDynEllip * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumDynEllip * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumDynEllip * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumDynEllip * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumDynEllip * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dDynEllip;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumDynEllip * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumDynEllip * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumDynEllip * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumDynEllip * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumDynEllip * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumDynEllip * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumDynEllip * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumDynEllip * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumDynEllip * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumDynEllip * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1770,43 +2199,50 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                          iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Poincare's h (Hecc)
     update[iBody].iHecc = -1;
     if (update[iBody].iNumHecc) {
-      update[iBody].iHecc          = iVar;
-      update[iBody].iaVar[iVar]    = VHECC;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumHecc;
-      update[iBody].pdVar[iVar]    = &body[iBody].dHecc;
+      update[iBody].iHecc           = iVar;
+      update[iBody].iaVar[iVar]     = VHECC;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumHecc;
+      update[iBody].pdVar[iVar]     = &body[iBody].dHecc;
+      update[iBody].saVarName[iVar] = "Hecc";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumHecc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumHecc * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumHecc * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumHecc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumHecc * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumHecc * sizeof(int));
       // XXX +1 allows for GR correction -- better to set iNumKecc based on user input!
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumHecc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumHecc * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dHecc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumHecc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumHecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumHecc * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumHecc * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumHecc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumHecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumHecc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumHecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumHecc * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumHecc * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1816,43 +2252,50 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Poincare's k (Kecc)
     update[iBody].iKecc = -1;
     if (update[iBody].iNumKecc) {
-      update[iBody].iKecc          = iVar;
-      update[iBody].iaVar[iVar]    = VKECC;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumKecc;
-      update[iBody].pdVar[iVar]    = &body[iBody].dKecc;
+      update[iBody].iKecc           = iVar;
+      update[iBody].iaVar[iVar]     = VKECC;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumKecc;
+      update[iBody].pdVar[iVar]     = &body[iBody].dKecc;
+      update[iBody].saVarName[iVar] = "Kecc";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumKecc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumKecc * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumKecc * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumKecc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumKecc * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumKecc * sizeof(int));
       // XXX +1 allows for GR correction -- better to set iNumKecc based on user input!
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumKecc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumKecc * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dKecc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumKecc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumKecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumKecc * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumKecc * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumKecc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumKecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumKecc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumKecc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumKecc * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumKecc * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1862,8 +2305,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -1876,35 +2321,46 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     
     update[iBody].iLuminosity = -1;
     if (update[iBody].iNumLuminosity) {
-      update[iBody].iLuminosity    = iVar;
-      update[iBody].iaVar[iVar]    = VLUMINOSITY;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumLuminosity;
-      update[iBody].pdVar[iVar]    = &body[iBody].dLuminosity;
+      update[iBody].iLuminosity     = iVar;
+      update[iBody].iaVar[iVar]     = VLUMINOSITY;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumLuminosity;
+      update[iBody].pdVar[iVar]     = &body[iBody].dLuminosity;
+      update[iBody].saVarName[iVar] = "Luminosity";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumLuminosity * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLuminosity * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumLuminosity * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLuminosity * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumLuminosity * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLuminosity * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumLuminosity * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLuminosity * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLuminosity;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumLuminosity * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLuminosity * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumLuminosity * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLuminosity * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumLuminosity * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLuminosity * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumLuminosity * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLuminosity * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumLuminosity * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLuminosity * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1914,8 +2370,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -1923,10 +2381,11 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Obliquity
     update[iBody].iObl = -1;
     if (update[iBody].iNumObl) {
-      update[iBody].iObl = iVar;
-      update[iBody].iaVar[iVar] = VOBL;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumObl;
-      update[iBody].pdVar[iVar] = &body[iBody].dObliquity;
+      update[iBody].iObl            = iVar;
+      update[iBody].iaVar[iVar]     = VOBL;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumObl;
+      update[iBody].pdVar[iVar]     = &body[iBody].dObliquity;
+      update[iBody].saVarName[iVar] = "Obliquity";
       update[iBody].iNumBodies[iVar] =
     malloc(update[iBody].iNumObl*sizeof(int)); update[iBody].iaBody[iVar] =
     malloc(update[iBody].iNumObl*sizeof(int*)); update[iBody].iaType[iVar] =
@@ -1961,34 +2420,39 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Poincare's p (Pinc)
     update[iBody].iPinc = -1;
     if (update[iBody].iNumPinc) {
-      update[iBody].iPinc          = iVar;
-      update[iBody].iaVar[iVar]    = VPINC;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumPinc;
-      update[iBody].pdVar[iVar]    = &body[iBody].dPinc;
+      update[iBody].iPinc           = iVar;
+      update[iBody].iaVar[iVar]     = VPINC;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumPinc;
+      update[iBody].pdVar[iVar]     = &body[iBody].dPinc;
+      update[iBody].saVarName[iVar] = "Pinc";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumPinc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumPinc * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumPinc * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumPinc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumPinc * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumPinc * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumPinc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumPinc * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dPinc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumPinc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumPinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumPinc * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPinc * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumPinc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumPinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumPinc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumPinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumPinc * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumPinc * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -1998,42 +2462,49 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Poincare's q (Qinc)
     update[iBody].iQinc = -1;
     if (update[iBody].iNumQinc) {
-      update[iBody].iQinc          = iVar;
-      update[iBody].iaVar[iVar]    = VQINC;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumQinc;
-      update[iBody].pdVar[iVar]    = &body[iBody].dQinc;
+      update[iBody].iQinc           = iVar;
+      update[iBody].iaVar[iVar]     = VQINC;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumQinc;
+      update[iBody].pdVar[iVar]     = &body[iBody].dQinc;
+      update[iBody].saVarName[iVar] = "Qinc";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumQinc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumQinc * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumQinc * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumQinc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumQinc * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumQinc * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumQinc * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumQinc * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dQinc;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumQinc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumQinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumQinc * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumQinc * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumQinc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumQinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumQinc * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumQinc * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumQinc * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumQinc * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2043,43 +2514,53 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Radius:
     update[iBody].iRadius = -1;
     if (update[iBody].iNumRadius) {
-      update[iBody].iRadius        = iVar;
-      update[iBody].iaVar[iVar]    = VRADIUS;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumRadius;
-      update[iBody].pdVar[iVar]    = &body[iBody].dRadius;
+      update[iBody].iRadius         = iVar;
+      update[iBody].iaVar[iVar]     = VRADIUS;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumRadius;
+      update[iBody].pdVar[iVar]     = &body[iBody].dRadius;
+      update[iBody].saVarName[iVar] = "Radius";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumRadius * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumRadius * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumRadius * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumRadius * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumRadius * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumRadius * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumRadius * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumRadius * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dRadius;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumRadius * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumRadius * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadius * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumRadius * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumRadius * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadius * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumRadius * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadius * sizeof(int *));
       for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2089,42 +2570,49 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                        iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Mass:
     update[iBody].iMass = -1;
     if (update[iBody].iNumMass) {
-      update[iBody].iMass          = iVar;
-      update[iBody].iaVar[iVar]    = VMASS;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumMass;
-      update[iBody].pdVar[iVar]    = &body[iBody].dMass;
+      update[iBody].iMass           = iVar;
+      update[iBody].iaVar[iVar]     = VMASS;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumMass;
+      update[iBody].pdVar[iVar]     = &body[iBody].dMass;
+      update[iBody].saVarName[iVar] = "Mass";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumMass * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumMass * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumMass * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumMass * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumMass * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumMass * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumMass * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumMass * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumMass * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumMass * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumMass * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumMass * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumMass * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumMass * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumMass * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2134,42 +2622,49 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Rotation Rate
     update[iBody].iRot = -1;
     if (update[iBody].iNumRot) {
-      update[iBody].iRot           = iVar;
-      update[iBody].iaVar[iVar]    = VROT;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumRot;
-      update[iBody].pdVar[iVar]    = &body[iBody].dRotRate;
+      update[iBody].iRot            = iVar;
+      update[iBody].iaVar[iVar]     = VROT;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumRot;
+      update[iBody].pdVar[iVar]     = &body[iBody].dRotRate;
+      update[iBody].saVarName[iVar] = "RotRate";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumRot * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumRot * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumRot * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumRot * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumRot * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumRot * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumRot * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumRot * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dRotRate;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumRot * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumRot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumRot * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRot * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumRot * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumRot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumRot * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumRot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumRot * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRot * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2179,42 +2674,49 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                     iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Semi-major Axis
     update[iBody].iSemi = -1;
     if (update[iBody].iNumSemi) {
-      update[iBody].iSemi          = iVar;
-      update[iBody].iaVar[iVar]    = VSEMI;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumSemi;
-      update[iBody].pdVar[iVar]    = &body[iBody].dSemi;
+      update[iBody].iSemi           = iVar;
+      update[iBody].iaVar[iVar]     = VSEMI;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumSemi;
+      update[iBody].pdVar[iVar]     = &body[iBody].dSemi;
+      update[iBody].saVarName[iVar] = "Semi";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumSemi * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumSemi * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumSemi * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumSemi * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumSemi * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumSemi * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumSemi * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumSemi * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSemi;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumSemi * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumSemi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumSemi * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSemi * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumSemi * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumSemi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumSemi * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumSemi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumSemi * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSemi * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2228,8 +2730,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       FinalizeUpdateMultiEqStSemi(body, update, &iEqn, iVar, iBody, iFoo,
                                   fnUpdate);
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2240,31 +2744,42 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaVar[iVar]       = VSURFACEWATERMASS;
       update[iBody].iNumEqns[iVar]    = update[iBody].iNumSurfaceWaterMass;
       update[iBody].pdVar[iVar]       = &body[iBody].dSurfaceWaterMass;
+      update[iBody].saVarName[iVar]   = "SurfaceWaterMass";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfaceWaterMass * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfaceWaterMass * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfaceWaterMass * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumSurfaceWaterMass * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dSurfaceWaterMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfaceWaterMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumSurfaceWaterMass * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfaceWaterMass * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfaceWaterMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfaceWaterMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumSurfaceWaterMass * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumSurfaceWaterMass * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2274,43 +2789,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Oxygen Mass
     update[iBody].iOxygenMass = -1;
     if (update[iBody].iNumOxygenMass) {
-      update[iBody].iOxygenMass    = iVar;
-      update[iBody].iaVar[iVar]    = VOXYGENMASS;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumOxygenMass;
-      update[iBody].pdVar[iVar]    = &body[iBody].dOxygenMass;
+      update[iBody].iOxygenMass     = iVar;
+      update[iBody].iaVar[iVar]     = VOXYGENMASS;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumOxygenMass;
+      update[iBody].pdVar[iVar]     = &body[iBody].dOxygenMass;
+      update[iBody].saVarName[iVar] = "OxygenMass";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumOxygenMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMass * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumOxygenMass * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMass * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumOxygenMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMass * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumOxygenMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMass * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumOxygenMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumOxygenMass * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMass * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumOxygenMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumOxygenMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumOxygenMass * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMass * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }              
       }
 
@@ -2320,8 +2848,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2332,31 +2862,42 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iaVar[iVar]       = VOXYGENMANTLEMASS;
       update[iBody].iNumEqns[iVar]    = update[iBody].iNumOxygenMantleMass;
       update[iBody].pdVar[iVar]       = &body[iBody].dOxygenMantleMass;
+      update[iBody].saVarName[iVar]   = "OxygenMantleMass";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMantleMass * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumOxygenMantleMass * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMantleMass * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMantleMass * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumOxygenMantleMass * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dOxygenMantleMass;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMantleMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumOxygenMantleMass * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMantleMass * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMantleMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumOxygenMantleMass * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMantleMass * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumOxygenMantleMass * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumOxygenMantleMass * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2366,43 +2907,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
               body, update, &iEqn, iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Stellar Temperature:
     update[iBody].iTemperature = -1;
     if (update[iBody].iNumTemperature) {
-      update[iBody].iTemperature   = iVar;
-      update[iBody].iaVar[iVar]    = VTEMPERATURE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumTemperature;
-      update[iBody].pdVar[iVar]    = &body[iBody].dTemperature;
+      update[iBody].iTemperature    = iVar;
+      update[iBody].iaVar[iVar]     = VTEMPERATURE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumTemperature;
+      update[iBody].pdVar[iVar]     = &body[iBody].dTemperature;
+      update[iBody].saVarName[iVar] = "Temperature";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumTemperature * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumTemperature * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumTemperature * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumTemperature * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumTemperature * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumTemperature * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumTemperature * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumTemperature * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dTemperature;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumTemperature * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTemperature * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumTemperature * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTemperature * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumTemperature * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTemperature * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumTemperature * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTemperature * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumTemperature * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTemperature * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2412,43 +2966,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                             iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Stellar radius of gyration:
     update[iBody].iRadGyra = -1;
     if (update[iBody].iNumRadGyra) {
-      update[iBody].iRadGyra       = iVar;
-      update[iBody].iaVar[iVar]    = VRADGYRA;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumRadGyra;
-      update[iBody].pdVar[iVar]    = &body[iBody].dRadGyra;
+      update[iBody].iRadGyra        = iVar;
+      update[iBody].iaVar[iVar]     = VRADGYRA;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumRadGyra;
+      update[iBody].pdVar[iVar]     = &body[iBody].dRadGyra;
+      update[iBody].saVarName[iVar] = "RadGyra";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumRadGyra * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumRadGyra * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumRadGyra * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumRadGyra * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumRadGyra * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumRadGyra * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumRadGyra * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumRadGyra * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dRadGyra;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumRadGyra * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadGyra * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumRadGyra * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadGyra * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumRadGyra * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadGyra * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumRadGyra * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadGyra * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumRadGyra * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumRadGyra * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2458,43 +3025,53 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                         iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* Core Temperature (TCore) */
     update[iBody].iTCore = -1;
     if (update[iBody].iNumTCore) {
-      update[iBody].iTCore         = iVar;
-      update[iBody].iaVar[iVar]    = VTCORE;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumTCore;
-      update[iBody].pdVar[iVar]    = &body[iBody].dTCore;
+      update[iBody].iTCore          = iVar;
+      update[iBody].iaVar[iVar]     = VTCORE;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumTCore;
+      update[iBody].pdVar[iVar]     = &body[iBody].dTCore;
+      update[iBody].saVarName[iVar] = "TCore";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumTCore * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumTCore * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumTCore * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumTCore * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumTCore * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumTCore * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumTCore * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumTCore * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dTCore;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumTCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumTCore * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTCore * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumTCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumTCore * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTCore * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumTCore * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTCore * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2504,42 +3081,49 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                       iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* Mantle Temperature (TMan) */
     update[iBody].iTMan = -1;
     if (update[iBody].iNumTMan) {
-      update[iBody].iTMan          = iVar;
-      update[iBody].iaVar[iVar]    = VTMAN;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumTMan;
-      update[iBody].pdVar[iVar]    = &body[iBody].dTMan;
+      update[iBody].iTMan           = iVar;
+      update[iBody].iaVar[iVar]     = VTMAN;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumTMan;
+      update[iBody].pdVar[iVar]     = &body[iBody].dTMan;
+      update[iBody].saVarName[iVar] = "TMan";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumTMan * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumTMan * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumTMan * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumTMan * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumTMan * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumTMan * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumTMan * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumTMan * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dTMan;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumTMan * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumTMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumTMan * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTMan * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumTMan * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumTMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumTMan * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumTMan * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumTMan * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumTMan * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2549,43 +3133,50 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // DistRot's X (Xobl)
     update[iBody].iXobl = -1;
     if (update[iBody].iNumXobl) {
-      update[iBody].iXobl          = iVar;
-      update[iBody].iaVar[iVar]    = VXOBL;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumXobl;
-      update[iBody].pdVar[iVar]    = &body[iBody].dXobl;
+      update[iBody].iXobl           = iVar;
+      update[iBody].iaVar[iVar]     = VXOBL;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumXobl;
+      update[iBody].pdVar[iVar]     = &body[iBody].dXobl;
+      update[iBody].saVarName[iVar] = "Xobl";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumXobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumXobl * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumXobl * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumXobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumXobl * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumXobl * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumXobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumXobl * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dXobl;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumXobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumXobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumXobl * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumXobl * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumXobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumXobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumXobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumXobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumXobl * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumXobl * sizeof(int *));
         control->Evolve.tmpUpdate[iBody].iXobl = iVar;
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2595,43 +3186,50 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // DistRot's Y (Yobl)
     update[iBody].iYobl = -1;
     if (update[iBody].iNumYobl) {
-      update[iBody].iYobl          = iVar;
-      update[iBody].iaVar[iVar]    = VYOBL;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumYobl;
-      update[iBody].pdVar[iVar]    = &body[iBody].dYobl;
+      update[iBody].iYobl           = iVar;
+      update[iBody].iaVar[iVar]     = VYOBL;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumYobl;
+      update[iBody].pdVar[iVar]     = &body[iBody].dYobl;
+      update[iBody].saVarName[iVar] = "Yobl";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumYobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumYobl * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumYobl * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumYobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumYobl * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumYobl * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumYobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumYobl * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dYobl;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumYobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumYobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumYobl * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumYobl * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumYobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumYobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumYobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumYobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumYobl * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumYobl * sizeof(int *));
         control->Evolve.tmpUpdate[iBody].iYobl = iVar;
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2641,43 +3239,50 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // DistRot's Z (Zobl)
     update[iBody].iZobl = -1;
     if (update[iBody].iNumZobl) {
-      update[iBody].iZobl          = iVar;
-      update[iBody].iaVar[iVar]    = VZOBL;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumZobl;
-      update[iBody].pdVar[iVar]    = &body[iBody].dZobl;
+      update[iBody].iZobl           = iVar;
+      update[iBody].iaVar[iVar]     = VZOBL;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumZobl;
+      update[iBody].pdVar[iVar]     = &body[iBody].dZobl;
+      update[iBody].saVarName[iVar] = "Zobl";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumZobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumZobl * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumZobl * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumZobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumZobl * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumZobl * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumZobl * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumZobl * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dZobl;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumZobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumZobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumZobl * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumZobl * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumZobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumZobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumZobl * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumZobl * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumZobl * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumZobl * sizeof(int *));
         control->Evolve.tmpUpdate[iBody].iZobl = iVar;
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2687,8 +3292,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2697,34 +3304,39 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Binary's CBP's Orbital Radiys (dCBPR)
     update[iBody].iCBPR = -1;
     if (update[iBody].iNumCBPR) {
-      update[iBody].iCBPR          = iVar;
-      update[iBody].iaVar[iVar]    = VCBPR;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCBPR;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCBPR;
+      update[iBody].iCBPR           = iVar;
+      update[iBody].iaVar[iVar]     = VCBPR;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCBPR;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCBPR;
+      update[iBody].saVarName[iVar] = "CBPR";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCBPR * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPR * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCBPR * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumCBPR * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPR * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPR * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCBPR * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPR * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPR;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCBPR * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumCBPR * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCBPR * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPR * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCBPR * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumCBPR * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCBPR * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumCBPR * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCBPR * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPR * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2734,8 +3346,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2743,34 +3357,39 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Binary's CBP's Orbital height above/below plane (dCBPZ)
     update[iBody].iCBPZ = -1;
     if (update[iBody].iNumCBPZ) {
-      update[iBody].iCBPZ          = iVar;
-      update[iBody].iaVar[iVar]    = VCBPZ;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCBPZ;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCBPZ;
+      update[iBody].iCBPZ           = iVar;
+      update[iBody].iaVar[iVar]     = VCBPZ;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCBPZ;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCBPZ;
+      update[iBody].saVarName[iVar] = "CBPZ";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCBPZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPZ * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCBPZ * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumCBPZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPZ * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPZ * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCBPZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPZ * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCBPZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumCBPZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCBPZ * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPZ * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCBPZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumCBPZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCBPZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumCBPZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCBPZ * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPZ * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2780,8 +3399,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2789,35 +3410,43 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Binary's CBP's Orbital azimuthal angle (dCBPPhi)
     update[iBody].iCBPPhi = -1;
     if (update[iBody].iNumCBPPhi) {
-      update[iBody].iCBPPhi        = iVar;
-      update[iBody].iaVar[iVar]    = VCBPPHI;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCBPPhi;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCBPPhi;
+      update[iBody].iCBPPhi         = iVar;
+      update[iBody].iaVar[iVar]     = VCBPPHI;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCBPPhi;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCBPPhi;
+      update[iBody].saVarName[iVar] = "CBPPhi";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCBPPhi * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPPhi * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCBPPhi * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPPhi * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumCBPPhi * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPPhi * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCBPPhi * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumCBPPhi * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPPhi;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCBPPhi * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCBPPhi * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhi * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCBPPhi * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCBPPhi * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhi * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCBPPhi * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhi * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2827,8 +3456,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                        iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2836,35 +3467,46 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Binary's CBP's Orbital Radial velocity (dCBPRDot)
     update[iBody].iCBPRDot = -1;
     if (update[iBody].iNumCBPRDot) {
-      update[iBody].iCBPRDot       = iVar;
-      update[iBody].iaVar[iVar]    = VCBPRDOT;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCBPRDot;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCBPRDot;
+      update[iBody].iCBPRDot        = iVar;
+      update[iBody].iaVar[iVar]     = VCBPRDOT;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCBPRDot;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCBPRDot;
+      update[iBody].saVarName[iVar] = "CBPRDot";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCBPRDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPRDot * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCBPRDot * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPRDot * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumCBPRDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPRDot * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCBPRDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPRDot * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPRDot;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCBPRDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPRDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCBPRDot * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPRDot * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCBPRDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPRDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCBPRDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPRDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCBPRDot * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPRDot * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2874,8 +3516,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                         iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2883,35 +3527,46 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Binary's CBP's Orbital z orbital velocity (dCBPZDot)
     update[iBody].iCBPZDot = -1;
     if (update[iBody].iNumCBPZDot) {
-      update[iBody].iCBPZDot       = iVar;
-      update[iBody].iaVar[iVar]    = VCBPZDOT;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCBPZDot;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCBPZDot;
+      update[iBody].iCBPZDot        = iVar;
+      update[iBody].iaVar[iVar]     = VCBPZDOT;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCBPZDot;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCBPZDot;
+      update[iBody].saVarName[iVar] = "CBPZDot";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCBPZDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPZDot * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCBPZDot * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPZDot * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumCBPZDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPZDot * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCBPZDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPZDot * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPZDot;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCBPZDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPZDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCBPZDot * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPZDot * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCBPZDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPZDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCBPZDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPZDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCBPZDot * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPZDot * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2921,8 +3576,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                         iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -2930,35 +3587,46 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Binary's CBP's Orbital Angular velocity (dCBPPhiDot)
     update[iBody].iCBPPhiDot = -1;
     if (update[iBody].iNumCBPPhiDot) {
-      update[iBody].iCBPPhiDot     = iVar;
-      update[iBody].iaVar[iVar]    = VCBPPHIDOT;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumCBPPhiDot;
-      update[iBody].pdVar[iVar]    = &body[iBody].dCBPPhiDot;
+      update[iBody].iCBPPhiDot      = iVar;
+      update[iBody].iaVar[iVar]     = VCBPPHIDOT;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumCBPPhiDot;
+      update[iBody].pdVar[iVar]     = &body[iBody].dCBPPhiDot;
+      update[iBody].saVarName[iVar] = "CBPPhiDot";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPPhiDot * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumCBPPhiDot * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPPhiDot * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPPhiDot * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumCBPPhiDot * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dCBPPhiDot;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhiDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumCBPPhiDot * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhiDot * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhiDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumCBPPhiDot * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhiDot * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumCBPPhiDot * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumCBPPhiDot * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -2968,8 +3636,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                           iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -3027,34 +3697,39 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     // Eccentricity vector x
     update[iBody].iEccX = -1;
     if (update[iBody].iNumEccX) {
-      update[iBody].iEccX          = iVar;
-      update[iBody].iaVar[iVar]    = VECCX;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumEccX;
-      update[iBody].pdVar[iVar]    = &body[iBody].dEccX;
+      update[iBody].iEccX           = iVar;
+      update[iBody].iaVar[iVar]     = VECCX;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumEccX;
+      update[iBody].pdVar[iVar]     = &body[iBody].dEccX;
+      update[iBody].saVarName[iVar] = "EccX";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumEccX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccX * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumEccX * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumEccX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccX * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccX * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumEccX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccX * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEccX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumEccX * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumEccX * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEccX * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumEccX * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumEccX * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumEccX * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEccX * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3064,42 +3739,49 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Eccentricity vector y
     update[iBody].iEccY = -1;
     if (update[iBody].iNumEccY) {
-      update[iBody].iEccY          = iVar;
-      update[iBody].iaVar[iVar]    = VECCY;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumEccY;
-      update[iBody].pdVar[iVar]    = &body[iBody].dEccY;
+      update[iBody].iEccY           = iVar;
+      update[iBody].iaVar[iVar]     = VECCY;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumEccY;
+      update[iBody].pdVar[iVar]     = &body[iBody].dEccY;
+      update[iBody].saVarName[iVar] = "EccY";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumEccY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccY * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumEccY * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumEccY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccY * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccY * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumEccY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccY * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEccY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumEccY * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumEccY * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEccY * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumEccY * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumEccY * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumEccY * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEccY * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3109,42 +3791,49 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Eccentricity vector z
     update[iBody].iEccZ = -1;
     if (update[iBody].iNumEccZ) {
-      update[iBody].iEccZ          = iVar;
-      update[iBody].iaVar[iVar]    = VECCZ;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumEccZ;
-      update[iBody].pdVar[iVar]    = &body[iBody].dEccZ;
+      update[iBody].iEccZ           = iVar;
+      update[iBody].iaVar[iVar]     = VECCZ;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumEccZ;
+      update[iBody].pdVar[iVar]     = &body[iBody].dEccZ;
+      update[iBody].saVarName[iVar] = "EccZ";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumEccZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccZ * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumEccZ * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumEccZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccZ * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccZ * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumEccZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumEccZ * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dEccZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumEccZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumEccZ * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEccZ * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumEccZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumEccZ * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumEccZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumEccZ * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumEccZ * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3154,43 +3843,53 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Angular momentum x component
     update[iBody].iAngMX = -1;
     if (update[iBody].iNumAngMX) {
-      update[iBody].iAngMX         = iVar;
-      update[iBody].iaVar[iVar]    = VANGMX;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumAngMX;
-      update[iBody].pdVar[iVar]    = &body[iBody].dAngMX;
+      update[iBody].iAngMX          = iVar;
+      update[iBody].iaVar[iVar]     = VANGMX;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumAngMX;
+      update[iBody].pdVar[iVar]     = &body[iBody].dAngMX;
+      update[iBody].saVarName[iVar] = "AngMX";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumAngMX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMX * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumAngMX * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumAngMX * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumAngMX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMX * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumAngMX * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMX * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dAngMX;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumAngMX * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumAngMX * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMX * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumAngMX * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumAngMX * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMX * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumAngMX * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMX * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3200,43 +3899,53 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                       iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Angular momentum y component
     update[iBody].iAngMY = -1;
     if (update[iBody].iNumAngMY) {
-      update[iBody].iAngMY         = iVar;
-      update[iBody].iaVar[iVar]    = VANGMY;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumAngMY;
-      update[iBody].pdVar[iVar]    = &body[iBody].dAngMY;
+      update[iBody].iAngMY          = iVar;
+      update[iBody].iaVar[iVar]     = VANGMY;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumAngMY;
+      update[iBody].pdVar[iVar]     = &body[iBody].dAngMY;
+      update[iBody].saVarName[iVar] = "AngMY";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumAngMY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMY * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumAngMY * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumAngMY * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumAngMY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMY * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumAngMY * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMY * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dAngMY;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumAngMY * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumAngMY * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMY * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumAngMY * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumAngMY * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMY * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumAngMY * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMY * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3246,43 +3955,53 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                       iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     // Angular momentum z component
     update[iBody].iAngMZ = -1;
     if (update[iBody].iNumAngMZ) {
-      update[iBody].iAngMZ         = iVar;
-      update[iBody].iaVar[iVar]    = VANGMZ;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumAngMZ;
-      update[iBody].pdVar[iVar]    = &body[iBody].dAngMZ;
+      update[iBody].iAngMZ          = iVar;
+      update[iBody].iaVar[iVar]     = VANGMZ;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumAngMZ;
+      update[iBody].pdVar[iVar]     = &body[iBody].dAngMZ;
+      update[iBody].saVarName[iVar] = "AngMZ";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumAngMZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMZ * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumAngMZ * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumAngMZ * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumAngMZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMZ * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumAngMZ * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumAngMZ * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dAngMZ;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumAngMZ * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumAngMZ * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMZ * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumAngMZ * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumAngMZ * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMZ * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumAngMZ * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumAngMZ * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3292,8 +4011,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                       iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -3311,30 +4032,35 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
       update[iBody].iNumEqns[iVar] = update[iBody].iNumLXUV;
       update[iBody].pdVar[iVar] =
             &body[iBody].dLXUVFlare; // Note this does NOT point dLXUV
+      update[iBody].saVarName[iVar] = "LXUVFlare";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumLXUV * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumLXUV * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumLXUV * sizeof(int *));
-      update[iBody].iaType[iVar] = malloc(update[iBody].iNumLXUV * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumLXUV * sizeof(int *));
+      update[iBody].iaType[iVar] =
+            ArenaAlloc(&control->Arena, update[iBody].iNumLXUV * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumLXUV * sizeof(int));
+            ArenaAlloc(&control->Arena, update[iBody].iNumLXUV * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLXUV;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumLXUV * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumLXUV * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumLXUV * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLXUV * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumLXUV * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumLXUV * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumLXUV * sizeof(int));
+              ArenaAlloc(&control->Arena, update[iBody].iNumLXUV * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumLXUV * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLXUV * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3344,43 +4070,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                      iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* Lost Angular Momentum */
     update[iBody].iLostAngMom = -1;
     if (update[iBody].iNumLostAngMom) {
-      update[iBody].iLostAngMom    = iVar;
-      update[iBody].iaVar[iVar]    = VLOSTANGMOM;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumLostAngMom;
-      update[iBody].pdVar[iVar]    = &body[iBody].dLostAngMom;
+      update[iBody].iLostAngMom     = iVar;
+      update[iBody].iaVar[iVar]     = VLOSTANGMOM;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumLostAngMom;
+      update[iBody].pdVar[iVar]     = &body[iBody].dLostAngMom;
+      update[iBody].saVarName[iVar] = "LostAngMom";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumLostAngMom * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostAngMom * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumLostAngMom * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostAngMom * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumLostAngMom * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostAngMom * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumLostAngMom * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostAngMom * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLostAngMom;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumLostAngMom * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostAngMom * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumLostAngMom * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostAngMom * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumLostAngMom * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostAngMom * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumLostAngMom * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostAngMom * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumLostAngMom * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostAngMom * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3390,43 +4129,56 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                            iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
     /* Lost Energy */
     update[iBody].iLostEng = -1;
     if (update[iBody].iNumLostEng) {
-      update[iBody].iLostEng       = iVar;
-      update[iBody].iaVar[iVar]    = VLOSTENG;
-      update[iBody].iNumEqns[iVar] = update[iBody].iNumLostEng;
-      update[iBody].pdVar[iVar]    = &body[iBody].dLostEng;
+      update[iBody].iLostEng        = iVar;
+      update[iBody].iaVar[iVar]     = VLOSTENG;
+      update[iBody].iNumEqns[iVar]  = update[iBody].iNumLostEng;
+      update[iBody].pdVar[iVar]     = &body[iBody].dLostEng;
+      update[iBody].saVarName[iVar] = "LostEng";
       update[iBody].iNumBodies[iVar] =
-            malloc(update[iBody].iNumLostEng * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostEng * sizeof(int));
       update[iBody].iaBody[iVar] =
-            malloc(update[iBody].iNumLostEng * sizeof(int *));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostEng * sizeof(int *));
       update[iBody].iaType[iVar] =
-            malloc(update[iBody].iNumLostEng * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostEng * sizeof(int));
       update[iBody].iaModule[iVar] =
-            malloc(update[iBody].iNumLostEng * sizeof(int));
+            ArenaAlloc(&control->Arena,
+                       update[iBody].iNumLostEng * sizeof(int));
 
       if (control->Evolve.iOneStep == RUNGEKUTTA) {
         control->Evolve.tmpUpdate[iBody].pdVar[iVar] =
               &control->Evolve.tmpBody[iBody].dLostEng;
         control->Evolve.tmpUpdate[iBody].iNumBodies[iVar] =
-              malloc(update[iBody].iNumLostEng * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostEng * sizeof(int));
         control->Evolve.tmpUpdate[iBody].daDerivProc[iVar] =
-              malloc(update[iBody].iNumLostEng * sizeof(double));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostEng * sizeof(double));
         control->Evolve.tmpUpdate[iBody].iaType[iVar] =
-              malloc(update[iBody].iNumLostEng * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostEng * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaModule[iVar] =
-              malloc(update[iBody].iNumLostEng * sizeof(int));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostEng * sizeof(int));
         control->Evolve.tmpUpdate[iBody].iaBody[iVar] =
-              malloc(update[iBody].iNumLostEng * sizeof(int *));
+              ArenaAlloc(&control->Arena,
+                         update[iBody].iNumLostEng * sizeof(int *));
         for (iSubStep=0; iSubStep < 4; iSubStep++) {
             control->Evolve.daDerivProc[iSubStep][iBody][iVar] =
-                  malloc(update[iBody].iNumEqns[iVar] * sizeof(double));
+                  ArenaAlloc(&control->Arena,
+                             update[iBody].iNumEqns[iVar] * sizeof(double));
         }
       }
 
@@ -3436,8 +4188,10 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
                                                         iVar, iBody, iFoo);
       }
 
-      (*fnUpdate)[iBody][iVar]        = malloc(iEqn * sizeof(fnUpdateVariable));
-      update[iBody].daDerivProc[iVar] = malloc(iEqn * sizeof(double));
+      (*fnUpdate)[iBody][iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(fnUpdateVariable));
+      update[iBody].daDerivProc[iVar] =
+            ArenaAlloc(&control->Arena, iEqn * sizeof(double));
       iVar++;
     }
 
@@ -3445,4 +4199,143 @@ void InitializeUpdate(BODY *body, CONTROL *control, MODULE *module,
     FinalizeUpdateMulti(body, control, module, update, fnUpdate, &iVar, iBody,
                         iFoo);
   }
+
+  InitializeUpdateTable(control, update, *fnUpdate);
+}
+
+/**
+  Copy one UPDATE array's per-body tables into the contiguous arrays of an
+  UPDATETABLE and point the per-body tables into them. The row layout of
+  the table must already be set; it is used instead of the UPDATE array's
+  own counts, which Evolve.tmpUpdate only receives in UpdateCopy.
+
+@param control Pointer to the CONTROL struct
+@param update The UPDATE array to pack
+@param table The UPDATETABLE that receives the arrays
+*/
+void PackUpdateTable(CONTROL *control, UPDATE *update, UPDATETABLE *table) {
+  int iRow, iBody, iVar, iStart, iEqn;
+
+  table->pdVar =
+        ArenaAlloc(&control->Arena, table->iNumRows * sizeof(double *));
+  table->daDeriv =
+        ArenaAlloc(&control->Arena, table->iNumRows * sizeof(double));
+  table->iaType = ArenaAlloc(&control->Arena, table->iNumEqns * sizeof(int));
+  table->iaBody =
+        ArenaAlloc(&control->Arena, table->iNumEqns * sizeof(int *));
+  table->daDerivProc =
+        ArenaAlloc(&control->Arena, table->iNumEqns * sizeof(double));
+
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    iBody  = table->iaRowBody[iRow];
+    iVar   = table->iaRowVar[iRow];
+    iStart = table->iaRowStart[iRow];
+    table->pdVar[iRow] = update[iBody].pdVar[iVar];
+    for (iEqn = iStart; iEqn < table->iaRowStart[iRow + 1]; iEqn++) {
+      table->iaType[iEqn] = update[iBody].iaType[iVar][iEqn - iStart];
+      table->iaBody[iEqn] = update[iBody].iaBody[iVar][iEqn - iStart];
+    }
+    update[iBody].iaType[iVar]      = &table->iaType[iStart];
+    update[iBody].iaBody[iVar]      = &table->iaBody[iStart];
+    update[iBody].daDerivProc[iVar] = &table->daDerivProc[iStart];
+  }
+
+  /* A body's rows are consecutive, starting with its variable 0 */
+  for (iRow = 0; iRow < table->iNumRows; iRow++) {
+    if (table->iaRowVar[iRow] == 0) {
+      iBody                 = table->iaRowBody[iRow];
+      update[iBody].pdVar   = &table->pdVar[iRow];
+      update[iBody].daDeriv = &table->daDeriv[iRow];
+    }
+  }
+}
+
+/**
+  Lay out the equations of all bodies in compressed sparse row form and move
+  the UPDATE tables (and, for Runge-Kutta, those of Evolve.tmpUpdate and the
+  substep derivatives) into contiguous arrays. This must run before any
+  module stores pointers into daDerivProc, i.e. before the modules' Verify
+  functions.
+
+@param control Pointer to the CONTROL struct
+@param update The UPDATE array
+@param fnUpdate The derivative functions, indexed [iBody][iVar][iEqn]
+*/
+void InitializeUpdateTable(CONTROL *control, UPDATE *update,
+                           fnUpdateVariable ***fnUpdate) {
+  UPDATETABLE *table = &control->UpdateTable;
+  EVOLVE *evolve     = &control->Evolve;
+  int iBody, iVar, iRow, iStart, iEqn, iSubStep;
+
+  table->iNumRows = 0;
+  table->iNumEqns = 0;
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    table->iNumRows += update[iBody].iNumVars;
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      table->iNumEqns += update[iBody].iNumEqns[iVar];
+    }
+  }
+
+  table->iaRowStart =
+        ArenaAlloc(&control->Arena, (table->iNumRows + 1) * sizeof(int));
+  table->iaRowBody =
+        ArenaAlloc(&control->Arena, table->iNumRows * sizeof(int));
+  table->iaRowVar = ArenaAlloc(&control->Arena, table->iNumRows * sizeof(int));
+  table->fnEqn    = ArenaAlloc(&control->Arena,
+                               table->iNumEqns * sizeof(fnUpdateVariable));
+
+  iRow   = 0;
+  iStart = 0;
+  for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+    for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+      table->iaRowStart[iRow] = iStart;
+      table->iaRowBody[iRow]  = iBody;
+      table->iaRowVar[iRow]   = iVar;
+      for (iEqn = 0; iEqn < update[iBody].iNumEqns[iVar]; iEqn++) {
+        table->fnEqn[iStart + iEqn] = fnUpdate[iBody][iVar][iEqn];
+      }
+      fnUpdate[iBody][iVar] = &table->fnEqn[iStart];
+      iStart += update[iBody].iNumEqns[iVar];
+      iRow++;
+    }
+  }
+  table->iaRowStart[iRow] = iStart;
+
+  PackUpdateTable(control, update, table);
+
+  if (evolve->iOneStep == RUNGEKUTTA) {
+    /* The temporary tables share the layout and the functions */
+    control->TmpUpdateTable = *table;
+    PackUpdateTable(control, evolve->tmpUpdate, &control->TmpUpdateTable);
+
+    for (iSubStep = 0; iSubStep < 4; iSubStep++) {
+      evolve->daStepDeriv[iSubStep] =
+            ArenaAlloc(&control->Arena, table->iNumRows * sizeof(double));
+      evolve->daStepDerivProc[iSubStep] =
+            ArenaAlloc(&control->Arena, table->iNumEqns * sizeof(double));
+      iRow = 0;
+      for (iBody = 0; iBody < evolve->iNumBodies; iBody++) {
+        evolve->daDeriv[iSubStep][iBody] = &evolve->daStepDeriv[iSubStep][iRow];
+        for (iVar = 0; iVar < update[iBody].iNumVars; iVar++) {
+          evolve->daDerivProc[iSubStep][iBody][iVar] =
+                &evolve->daStepDerivProc[iSubStep]
+                                        [table->iaRowStart[iRow + iVar]];
+        }
+        iRow += update[iBody].iNumVars;
+      }
+    }
+  }
+}
+
+/**
+  Return the packed table that holds an UPDATE array's equations.
+
+@param control Pointer to the CONTROL struct
+@param update Either the UPDATE array or Evolve.tmpUpdate
+*/
+UPDATETABLE *fpUpdateTable(CONTROL *control, UPDATE *update) {
+  if (update == control->Evolve.tmpUpdate) {
+    return &control->TmpUpdateTable;
+  }
+  return &control->UpdateTable;
 }
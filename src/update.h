@@ -107,6 +107,9 @@
 void InitializeUpdateBodyPerts(CONTROL *, UPDATE *, int);
 void InitializeUpdateTmpBody(BODY *, CONTROL *, MODULE *, UPDATE *, int);
 void UpdateCopy(UPDATE *, UPDATE *, int);
+void PackUpdateTable(CONTROL *, UPDATE *, UPDATETABLE *);
+void InitializeUpdateTable(CONTROL *, UPDATE *, fnUpdateVariable ***);
+UPDATETABLE *fpUpdateTable(CONTROL *, UPDATE *);
 void InitializeUpdate(BODY *, CONTROL *, MODULE *, UPDATE *,
                       fnUpdateVariable ****);
 
@@ -1183,6 +1183,9 @@ void VerifyOptions(BODY *body, CONTROL *control, FILES *files, MODULE *module,
   // Set next output time so logging does not contain a memory leak
   // control->Io.dNextOutput = control->Evolve.dTime + control->Io.dOutputTime;
 
+  // Every equation type is known now, so choose the timescale kernels
+  InitializeTimeStep(control, update);
+
   // Finally, initialize derivative values -- this avoids leaks while logging
   PropertiesAuxiliary(body, control, system, update);
   CalculateDerivatives(body, system, update, *fnUpdate,
@@ -21,6 +21,117 @@ const double dTINY = 1. / DBL_MAX; // This is the smallest possibled double
                                    // value according to <float.h>
 /* Do not change these values */
 
+/*!
+Read and verify the system described by the primary input file `infile` and
+write the initial log. The OPTIONS and OUTPUT arrays must already have been
+initialized, so that several simulations can share one copy of them (see
+sweep.c and ensemble.c).
+ */
+void InitializeSimulation(BODY **body, CONTROL *control, FILES *files,
+                          MODULE *module, OPTIONS *options, OUTPUT *output,
+                          SYSTEM *system, UPDATE **update,
+                          fnUpdateVariable ****fnUpdate,
+                          fnIntegrate *fnOneStep, fnReadOption fnRead[],
+                          fnWriteOutput fnWrite[], char infile[],
+                          int iVerbose, int bOverwrite) {
+#ifdef GITVERSION
+  strcpy(control->sGitVersion, GITVERSION);
+#else
+  strcpy(control->sGitVersion, "Unknown");
+#endif
+
+  /* Set to IntegrationMethod to 0, so default can be
+     assigned if necessary */
+  control->Evolve.iOneStep     = 0;
+  control->Evolve.bBatchDeccDt = 0;
+  control->Io.iVerbose         = iVerbose;
+  control->Io.bOverwrite       = bOverwrite;
+  ArenaInit(&control->Arena);
+
+  /* Read input files */
+  ReadOptions(body, control, files, module, options, output, system, update,
+              fnRead, infile);
+
+  if (control->Io.iVerbose >= VERBINPUT) {
+    printf("Input files read.\n");
+  }
+
+  /* Check that user options are mutually compatible */
+  VerifyOptions(*body, control, files, module, options, output, system,
+                *update, fnOneStep, fnUpdate);
+
+  if (control->Io.iVerbose >= VERBINPUT) {
+    printf("Input files verified.\n");
+  }
+
+  control->Evolve.dTime      = 0;
+  control->Evolve.bFirstStep = 1;
+
+  if (control->Io.bLog) {
+    WriteLog(*body, control, files, module, options, output, system, *update,
+             *fnUpdate, fnWrite, 0);
+    if (control->Io.iVerbose >= VERBPROG) {
+      printf("Log file written.\n");
+    }
+  }
+}
+
+/*!
+Log the final system parameters of a simulation set up by
+InitializeSimulation, if it was evolved, and release its integration tables.
+ */
+void FinishSimulation(BODY *body, CONTROL *control, FILES *files,
+                      MODULE *module, OPTIONS *options, OUTPUT *output,
+                      SYSTEM *system, UPDATE *update,
+                      fnUpdateVariable ***fnUpdate, fnWriteOutput fnWrite[]) {
+  /* If evolution performed, log final system parameters */
+  if ((control->Evolve.bDoForward || control->Evolve.bDoBackward) &&
+      control->Io.bLog) {
+    WriteLog(body, control, files, module, options, output, system, update,
+             fnUpdate, fnWrite, 1);
+    if (control->Io.iVerbose >= VERBPROG) {
+      printf("Log file updated.\n");
+    }
+  }
+
+  if (control->Io.iVerbose >= VERBPROG) {
+    printf("Simulation completed.\n");
+  }
+
+  /* The integration tables and input lists are no longer needed */
+  ArenaRelease(&control->Arena);
+}
+
+/*!
+Read, verify and integrate the system described by the primary input file
+`infile`. The OPTIONS and OUTPUT arrays must already have been initialized,
+so that several simulations can share one copy of them (see sweep.c).
+ */
+void RunSimulation(OPTIONS *options, OUTPUT *output, FILES *files,
+                   fnReadOption fnRead[], fnWriteOutput fnWrite[],
+                   char infile[], int iVerbose, int bOverwrite) {
+  CONTROL control;
+  UPDATE *update;
+  BODY *body;
+  MODULE module;
+  SYSTEM system;
+  fnUpdateVariable ***fnUpdate;
+  fnIntegrate fnOneStep;
+
+  InitializeSimulation(&body, &control, files, &module, options, output,
+                       &system, &update, &fnUpdate, &fnOneStep, fnRead,
+                       fnWrite, infile, iVerbose, bOverwrite);
+
+  /* Perform evolution */
+  if (control.Evolve.bDoForward || control.Evolve.bDoBackward) {
+    Evolve(body, &control, files, &module, output, &system, update, fnUpdate,
+           fnWrite, fnOneStep);
+  }
+
+  FinishSimulation(body, &control, files, &module, options, output, &system,
+                   update, fnUpdate, fnWrite);
+}
+
 /*!
 Actual implementation of the main function; called from in `int main()` below.
 We need this wrapper so we can call `main_impl` from Python.
@@ -51,26 +162,14 @@ int main_impl(int argc, char *argv[]) {
   dStartTime = time(NULL);
   */
 
-  int iOption, iVerbose, iQuiet, iOverwrite;
+  int iOption, iVerbose, iQuiet, iOverwrite, iSweep, iServer, iCores;
+  int iVerbosity, bOverwrite, iNumCores;
   OPTIONS *options;
   OUTPUT *output;
-  CONTROL control;
-  UPDATE *update;
-  BODY *body;
-  MODULE module;
   FILES files;
-  SYSTEM system;
   char infile[NAMELEN];
   fnReadOption fnRead[MODULEOPTEND]; // XXX Pointers?
   fnWriteOutput fnWrite[MODULEOUTEND];
-  fnUpdateVariable ***fnUpdate;
-  fnIntegrate fnOneStep;
-
-#ifdef GITVERSION
-  strcpy(control.sGitVersion, GITVERSION);
-#else
-  strcpy(control.sGitVersion, "Unknown");
-#endif
 
   /** Must initialize all options and outputs for all modules
      independent of what is selected. This allows a complete
@@ -84,40 +183,42 @@ int main_impl(int argc, char *argv[]) {
   output = malloc(MODULEOUTEND * sizeof(OUTPUT));
   InitializeOutput(&files, output, fnWrite);
 
-  /* Set to IntegrationMethod to 0, so default can be
-     assigned if necessary */
-  control.Evolve.iOneStep = 0;
-
   /* Copy executable file name to the files struct. */
   strcpy(files.cExe, argv[0]);
 
   if (argc == 1) {
     fprintf(stderr,
             "Usage: %s [-v, -verbose] [-q, -quiet] [-h, -help] [-H, -Help] "
-            "<file>\n",
-            argv[0]);
+            "<file>\n"
+            "       %s [-v] [-q] [-c <num_cores>] -sweep <vspace file>\n"
+            "       %s [-v] [-q] [-c <num_cores>] -server <fifo>\n",
+            argv[0], argv[0], argv[0]);
     exit(EXIT_EXE);
   }
 
-  iVerbose              = -1;
-  iQuiet                = -1;
-  iOverwrite            = -1;
-  control.Io.iVerbose   = -1;
-  control.Io.bOverwrite = -1;
+  iVerbose   = -1;
+  iQuiet     = -1;
+  iOverwrite = -1;
+  iSweep     = -1;
+  iServer    = -1;
+  iCores     = -1;
+  iVerbosity = -1;
+  bOverwrite = -1;
+  iNumCores  = 0;
 
   /* Check for flags */
   for (iOption = 1; iOption < argc; iOption++) {
     if (memcmp(argv[iOption], "-v", 2) == 0) {
-      control.Io.iVerbose = 5;
-      iVerbose            = iOption;
+      iVerbosity = 5;
+      iVerbose   = iOption;
     }
     if (memcmp(argv[iOption], "-q", 2) == 0) {
-      control.Io.iVerbose = 0;
-      iQuiet              = iOption;
+      iVerbosity = 0;
+      iQuiet     = iOption;
     }
     if (memcmp(argv[iOption], "-f", 2) == 0) {
-      control.Io.bOverwrite = 1;
-      iOverwrite            = iOption;
+      bOverwrite = 1;
+      iOverwrite = iOption;
     }
     if (memcmp(argv[iOption], "-h", 2) == 0) {
       Help(options, output, files.cExe, 0);
@@ -125,6 +226,30 @@ int main_impl(int argc, char *argv[]) {
     if (memcmp(argv[iOption], "-H", 2) == 0) {
       Help(options, output, files.cExe, 1);
     }
+    if (strcmp(argv[iOption], "-sweep") == 0) {
+      if (iOption + 1 >= argc) {
+        fprintf(stderr, "ERROR: -sweep requires a vspace input file.\n");
+        exit(EXIT_EXE);
+      }
+      iSweep = iOption;
+    }
+    if (strcmp(argv[iOption], "-server") == 0) {
+      if (iOption + 1 >= argc) {
+        fprintf(stderr, "ERROR: -server requires the name of a FIFO.\n");
+        exit(EXIT_EXE);
+      }
+      iServer = iOption;
+    }
+    if (strcmp(argv[iOption], "-c") == 0 ||
+        strcmp(argv[iOption], "-cores") == 0) {
+      if (iOption + 1 >= argc) {
+        fprintf(stderr, "ERROR: %s requires the number of cores.\n",
+                argv[iOption]);
+        exit(EXIT_EXE);
+      }
+      iCores    = iOption;
+      iNumCores = atoi(argv[iOption + 1]);
+    }
   }
 
   if (iQuiet != -1 && iVerbose != -1) {
@@ -132,63 +257,35 @@ int main_impl(int argc, char *argv[]) {
     exit(EXIT_EXE);
   }
 
-  /* Now identify input file, usually vpl.in */
-  for (iOption = 1; iOption < argc; iOption++) {
-    if (iOption != iVerbose && iOption != iQuiet && iOption != iOverwrite) {
-      strcpy(infile, argv[iOption]);
+  if (iSweep != -1) {
+    /* A sweep with failed members fails, but all members are archived */
+    if (Sweep(options, output, &files, fnRead, fnWrite, argv[iSweep + 1],
+              iNumCores, iVerbosity) > 0) {
+      exit(EXIT_INT);
     }
+    exit(0);
   }
 
-  /* Read input files */
-  ReadOptions(&body, &control, &files, &module, options, output, &system,
-              &update, fnRead, infile);
-
-  if (control.Io.iVerbose >= VERBINPUT) {
-    printf("Input files read.\n");
+  if (iServer != -1) {
+    Server(options, output, &files, fnRead, fnWrite, argv[iServer + 1],
+           iNumCores, iVerbosity);
+    exit(0);
   }
 
-  /* Check that user options are mutually compatible */
-  VerifyOptions(body, &control, &files, &module, options, output, &system,
-                update, &fnOneStep, &fnUpdate);
-
-  if (control.Io.iVerbose >= VERBINPUT) {
-    printf("Input files verified.\n");
-  }
-
-  control.Evolve.dTime      = 0;
-  control.Evolve.bFirstStep = 1;
-
-  if (control.Io.bLog) {
-    WriteLog(body, &control, &files, &module, options, output, &system, update,
-             fnUpdate, fnWrite, 0);
-    if (control.Io.iVerbose >= VERBPROG) {
-      printf("Log file written.\n");
+  /* Now identify input file, usually vpl.in */
+  for (iOption = 1; iOption < argc; iOption++) {
+    if (iOption != iVerbose && iOption != iQuiet && iOption != iOverwrite &&
+        iOption != iCores && (iCores == -1 || iOption != iCores + 1)) {
+      strcpy(infile, argv[iOption]);
     }
   }
 
-  /* Perform evolution */
-
-  if (control.Evolve.bDoForward || control.Evolve.bDoBackward) {
-    Evolve(body, &control, &files, &module, output, &system, update, fnUpdate,
-           fnWrite, fnOneStep);
-
-    /* If evolution performed, log final system parameters */
-    if (control.Io.bLog) {
-      WriteLog(body, &control, &files, &module, options, output, &system,
-               update, fnUpdate, fnWrite, 1);
-      if (control.Io.iVerbose >= VERBPROG) {
-        printf("Log file updated.\n");
-      }
-    }
-  }
+  RunSimulation(options, output, &files, fnRead, fnWrite, infile, iVerbosity,
+                bOverwrite);
 
   // gettimeofday(&end, NULL);
-
-  if (control.Io.iVerbose >= VERBPROG) {
-    printf("Simulation completed.\n");
-    // printf("Total time: %.4e [sec]\n",
-    // difftime(end.tv_usec,start.tv_usec)/1e6);
-  }
+  // printf("Total time: %.4e [sec]\n",
+  // difftime(end.tv_usec,start.tv_usec)/1e6);
   exit(0);
 }
 
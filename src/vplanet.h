@@ -10,6 +10,7 @@
 #include <ctype.h>
 #include <float.h>
 #include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -24,6 +25,7 @@
 #ifdef VPLANET_ON_WINDOWS
 #define unlink _unlink
 #else
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 #ifndef M_PI
@@ -160,6 +162,7 @@ This is necessary in order to add pointers to structs into typedef'd functions
 
 typedef struct BODY BODY;
 typedef struct CONTROL CONTROL;
+typedef struct ENSEMBLE ENSEMBLE;
 typedef struct EVOLVE EVOLVE;
 typedef struct FILES FILES;
 typedef struct HALT HALT;
@@ -169,19 +172,35 @@ typedef struct MODULE MODULE;
 typedef struct OPTIONS OPTIONS;
 typedef struct OUTFILE OUTFILE;
 typedef struct OUTPUT OUTPUT;
+typedef struct SWEEP SWEEP;
+typedef struct SWEEPPARAM SWEEPPARAM;
 typedef struct SYSTEM SYSTEM;
 typedef struct UNITS UNITS;
 typedef struct UPDATE UPDATE;
+typedef struct UPDATETABLE UPDATETABLE;
 typedef struct VERIFY VERIFY;
 
+/* STARMEMO holds terms that depend only on a star but are needed by every
+   body orbiting it. Each term is stored with the stellar values it was
+   computed from and is recomputed when they change, so it is evaluated once
+   per integration stage however many planets ask for it. */
+
+typedef struct {
+  double dHZRG14Temperature; /**< Teff of daHZRG14Coeff, NAN if unset */
+  double daHZRG14Coeff[2];   /**< RG flux limit fit to log10 planet mass */
+  double dBondiTemperature;  /**< Teff of dBondiTempFactor, NAN if unset */
+  double dBondiTempFactor;   /**< sqrt(Teff / 5800 K) */
+  double dBondiRadius;       /**< Radius of dBondiRadiusFactor, NAN if unset */
+  double dBondiRadiusFactor; /**< (R / RSUN)^(1/4) */
+} STARMEMO;
+
 /*! \brief BODY contains all the physical parameters for every object in the
  * system.
  */
 struct BODY {
-  /* Body Properties */
-  char cName[NAMELEN]; /**< Body's Name */
-  char sColor[OPTLEN]; /**< Body color (for plotting) */
-
+  /* Body Properties. The fields read by most derivatives come first so they
+   * share cache lines; names and other input-only data are stored after
+   * them or allocated separately. */
   int bMantle; /**< Is there a mantle? */
   int bOcean;  /**< Is there an ocean? */
   int bEnv;    /**< Is there an envelope? */
@@ -212,6 +231,10 @@ struct BODY {
   double dOrbPeriod;  /**< Body's Orbital Period */
   double dEccSq;      /**< Eccentricity squared */
 
+  /* Names */
+  char cName[NAMELEN]; /**< Body's Name */
+  char sColor[OPTLEN]; /**< Body color (for plotting) */
+
   /* ATMESC Parameters */
   int bAtmEsc;        /**< Apply Module ATMESC? */
   int bInstantO2Sink; /**< Is oxygen absorbed instantaneously at the surface? */
@@ -397,7 +420,7 @@ struct BODY {
                           currently) */
   int iTidePerts;      /**< Number of Tidal Perturbers */
   int *iaTidePerts;    /**< Body #'s of Tidal Perturbers */
-  char saTidePerts[MAXARRAY][NAMELEN]; /**< Names of Tidal Perturbers */
+  char (*saTidePerts)[NAMELEN];        /**< Names of Tidal Perturbers */
   double dK2Man;                       /**< Mantle k2 love number */
   double dK2Ocean;                     /**< Ocean's Love Number */
   double dK2Env;                       /**< Envelope's Love Number */
@@ -602,6 +625,7 @@ struct BODY {
   double dSatXUVTime;
   double dXUVBeta;
   int iStellarModel;
+  double dMetallicity; /**< [Fe/H], for stellar grids with that axis */
   int iMagBrakingModel;
   int iWindModel;
   int iXUVModel;
@@ -618,6 +642,7 @@ struct BODY {
   double dLuminosityAmplitude;
   double dLuminosityFrequency;
   double dLuminosityPhase;
+  STARMEMO StarMemo; /**< Stellar terms shared by the bodies orbiting it */
 
   /* POISE parameters */
   int bPoise; /**< Apply POISE module? */
@@ -634,6 +659,7 @@ struct BODY {
   double dAstroDist;  /**< Distance between primary and planet */
   int bCalcAB;        /**< Calc A and B from Williams & Kasting 1997 */
   int iClimateModel;  /**< Which EBM to be used (ann or sea) */
+  int iAnnualSolver;  /**< Equilibrium solver of the annual EBM */
   int bColdStart;     /**< Start from global glaciation (snowball) conditions */
   double dCw_dt;      /**< Heat capacity of water / EBM time step */
   double dDiffCoeff;  /**< Diffusion coefficient set by user */
@@ -659,6 +685,10 @@ struct BODY {
   double dIceMassTot;    /**< Total ice mass over entire globe */
   int bIceSheets;        /**< Use ice sheet model? */
   int iIceTimeStep; /**< Time step of ice sheet model (should be > iNumYears) */
+  double dIceHeightTol; /**< Ice height error per adaptive ice sheet step */
+  double dIceDtAdapt;   /**< Next step of the adaptive ice sheet model */
+  double **daIceSheetSave; /**< Ice sheet state at the start of a step */
+  double *daIceHeightFull; /**< Ice heights after one undivided step */
   double dInitIceHeight; /**< Initial height of ice sheet */
   double dInitIceLat;    /**< Initial latitude of ice line (ice cap only) */
   double dLapseR; /**< Lapse rate used for elevation feedback of ice sheet */
@@ -672,6 +702,17 @@ struct BODY {
   double dNuLandWater; /**< Land-ocean interaction term */
   int iNumLats;        /**< Number of latitude cells */
   int iNumYears;       /**< Number of orbits!!! to run seasonal model */
+  int iNumYearsRun;    /**< Orbits the seasonal model ran last time */
+  double dSeasPeriodTol; /**< Year-over-year change of a periodic cycle */
+  int bRadTables;       /**< Interpolate OLR and TOA albedo from tables? */
+  int iRadTableTemps;   /**< Temperature intervals of the lookup tables */
+  int iRadTableZeniths; /**< Zenith angle intervals of the albedo tables */
+  double **daOLRTable;  /**< OLR fit and its slope vs. temperature */
+  double dOLRTableStep; /**< Temperature step of the OLR tables */
+  double **daAlbTOATable; /**< TOA albedo fits by piece and surface type */
+  double *daAlbTOATableTMin; /**< First temperature of each albedo table */
+  double *daAlbTOATableStep; /**< Temperature step of each albedo table */
+  double dAlbTOATableZenStep; /**< Zenith angle step of the albedo tables */
   double dObliqAmp;    /**< Amplitude of forced obliquity oscillation */
   double dObliqPer;    /**< Period of force obliquity oscillation */
   double dObliq0;      /**< Start obliquity for forced oscillation */
@@ -700,6 +741,7 @@ struct BODY {
   int bSkipSeas;          /**< Ann model will be used if in snowball state */
   int bSkipSeasEnabled; /**< Allow ann model to be used if in snowball state? */
   int bSnowball;        /**< Is planet in snowball state (oceans are frozen)? */
+  int *iaSnowballLat;   /**< Snowball state seen by each latitude in a step */
   double
         dSpinUpTol; /**< Tolerance for mean global temp change during spin up */
   double dSurfAlbedo;  /**< Base surface albedo used in ann model */
@@ -718,6 +760,9 @@ struct BODY {
   double *daFluxIn;      /**< Incoming surface flux (insolation) */
   double *daFluxOut;     /**< Outgoing surface flux (longwave) */
   double *daLats;      /**< Latitude of each cell (centered); South Pole is 0 */
+  double *daSinLats;   /**< Sine of each latitude */
+  double *daCosLats;   /**< Cosine of each latitude */
+  double *daTanLats;   /**< Tangent of each latitude */
   double *daPeakInsol; /**< Annually averaged insolation at each latitude */
   double *daTGrad;     /**< Gradient of temperature (meridional) */
 
@@ -725,22 +770,27 @@ struct BODY {
   double *daAlbedoAnn; /**< Albedo of each cell */
   double
         *daDiffusionAnn; /**< Diffusion coefficient of each latitude boundary */
-  double **daMEulerAnn;  /**< Matrix used for Euler step in annual model */
-  double **daMEulerCopyAnn; /**< Temp copy of Euler matrix */
-  double **daInvMAnn;       /**< Inverted matrix for annual model */
+  double **daMEulerAnn;  /**< Tridiagonal factors of the Euler step matrix in
+                            annual model */
   double *daLambdaAnn;      /**< Diffusion terms for annual matrix */
-  double **daMClim;         /**< Raw climate matrix for annual model */
-  double **daMDiffAnn;      /**< Diffusion matrix for annual model */
+  double **daMClim;    /**< Raw climate matrix for annual model (tridiagonal) */
+  double **daMDiffAnn; /**< Diffusion matrix for annual model (tridiagonal) */
   double *daPlanckAAnn;     /**< Array of Planck A values for ann model */
   double *daPlanckBAnn;     /**< Array of Planck B values for ann model */
-  int *iaRowswapAnn;      /**< Array of interchanged rows in matrix inversion */
-  double *daScaleAnn;     /**< Used in matrix inversion routine */
   double *daSourceF;      /**< Heating terms in EBM */
   double *daTempAnn;      /**< Surface temperature in each cell */
   double *daTempTerms;    /**< Temperature dependent terms in matrix */
   double *daTmpTempAnn;   /**< Temporary copy of temperature */
   double *daTmpTempTerms; /**< Temporary copy of temp dependent terms */
-  double *daUnitVAnn;     /**< Unit vector used in matrix inversion */
+  double **daAndersonDF; /**< Differences of past residuals (Anderson) */
+  double **daAndersonDG; /**< Differences of past iterates (Anderson) */
+  double **daAndersonQ;  /**< Orthonormal basis of daAndersonDF */
+  double **daAndersonR;  /**< Triangular factor of daAndersonDF */
+  double *daAndersonF;   /**< Residual of the current iterate */
+  double *daAndersonFOld;  /**< Residual of the previous iterate */
+  double *daAndersonGOld;  /**< Previous fixed-point map value */
+  double *daAndersonGamma; /**< Mixing coefficients */
+  double *daTempAnnStart;  /**< Warm start, restored if Anderson fails */
 
   /* Arrays for seasonal model */
   double *daAlbedoAvg;    /**< Orbit average albedo by latitude */
@@ -755,6 +805,13 @@ struct BODY {
   double *daBedrockH;     /**< Height of bedrock (can be negative) */
   double *daBedrockHEq;   /**< Equilibrium height of bedrock */
   double *daDeclination;  /**< Daily solar declination */
+  double *daInsolKey;     /**< Orbit and spin the insolation was found for */
+  int bInsolKeySet;       /**< daInsolKey holds inputs? */
+  double dInsolTol;       /**< Change in daInsolKey that recalculates it */
+  double dInsolTrueL;     /**< True longitude after the insolation year */
+  double dInsolMeanA;     /**< Mean anomaly after the insolation year */
+  double dInsolEccA;      /**< Eccentric anomaly after the insolation year */
+  double dInsolAstroDist; /**< Star distance after the insolation year */
   double *daDeltaTempL; /**< Keeps track of temp change on land for energy check
                          */
   double *daDeltaTempW; /**< Keeps track of temp change on water for energy
@@ -779,6 +836,7 @@ struct BODY {
   double *daFluxOutWater;  /**< Annually averaged outgoing flux on water */
   double *daFluxSeaIce;    /**< Heat flux through sea ice */
   double **daIceBalance;   /**< Gain/loss of ice at each latitude and day */
+  double **daIceBalancePrev; /**< daIceBalance of the previous orbit */
   double *daIceAblateTot;  /**< Total ice loss per orbit */
   double *daIceAccumTot;   /**< Total ice gain per orbit */
   double *daIceBalanceAnnual; /**< Net ice gain/loss over orbit */
@@ -794,15 +852,16 @@ struct BODY {
   double *daIcePropsTmp;    /**< Temporary array used in ice sheet matrix */
   double *daIceSheetDiff;   /**< Diffusion coefficient of ice sheet flow */
   double **daIceSheetMat;   /**< Matrix used in ice sheet flow */
-  double **daInvMSea;       /**< Inverted matrix in seasonal EBM */
   double *daLambdaSea;      /**< Diffusion terms in seasonal EBM matrix */
   double dLandFrac;         /**< Land fraction input by user */
   double *daLandFrac;       /**< Fraction of cell which is land */
   double **daMDiffSea;      /**< Diffusion only matrix in seasonal EBM */
-  double **daMEulerCopySea; /**< Temporary copy of Euler time step matrix
-                               (seasonal) */
-  double **daMEulerSea;     /**< Euler time step matrix in seasonal EBM */
+  double **daMEulerSea;     /**< Band LU factors of the Euler time step
+                               matrix in seasonal EBM */
   double **daMInit;  /**< Temporary matrix used in constructing Euler matrix */
+  double *daMatrixKeySea; /**< Inputs daMInit was last formed with */
+  int bMatrixKeySeaSet;   /**< daMatrixKeySea holds inputs? */
+  int bMatrixSeaFactored; /**< daMEulerSea holds the factors of daMInit? */
   double **daMLand;  /**< Land terms in seasonal matrix */
   double **daMWater; /**< Water terms in seasonal matrix */
   double *daPlanckASea;    /**< Array of Planck A values in seasonal model */
@@ -830,7 +889,6 @@ struct BODY {
   double *daTempMinLW;    /**< Minimum temperature over year */
   double *daTempWater;    /**< Temperature over ocean (by lat) */
   double *daTmpTempSea; /**< Temporary copy of temp dependent terms (sea EBM)*/
-  double *daUnitVSea;   /**< Unit vector used in matrix routines */
   double *daWaterFrac;  /**< Fraction of cell which is water */
   double *daXBoundary;  /**< Locations of grid boundaries in x = sin(lat) */
   double *daYBoundary;  /**< Locations of grid boundaries in y = R*lat */
@@ -1141,8 +1199,9 @@ struct SYSTEM {
 struct UPDATE {
   /* N.B. that pdVar points to the same memory location as
    * body.x, where x=semi, ecc, etc. */
-  double **pdVar; /**< Pointers to Primary Variables */
-  int iNumVars;   /**< Number of Update-able Variables */
+  double **pdVar;   /**< Pointers to Primary Variables */
+  char **saVarName; /**< Names of Primary Variables, for messages */
+  int iNumVars;     /**< Number of Update-able Variables */
 
   /*! The "type" refers to how the variable is updated. If 0, then
       the variable is assumed to be an explicit function of age. The
@@ -1748,6 +1807,9 @@ struct EVOLVE {
   int iNumBodies;    /**< Number of Bodies to be Integrated */
   int iOneStep;      /**< Integration Method number */
   double dCurrentDt; /**< Current timestep */
+  int iLimitRow;     /**< UPDATETABLE row that set the last timescale, or -1 */
+  int bBatchDeccDt;  /**< Leave the CTL de/dt to the ensemble's batched
+                        kernel? Only set inside EnsembleAuxiliary. */
 
   // These are to store midpoint derivative info in RK4.
   BODY *tmpBody;     /**< Temporary BODY struct */
@@ -1756,6 +1818,9 @@ struct EVOLVE {
                         Body #, second is the Primary variable number, third is
                         the equation number.  */
   double ****daDerivProc; /**< Derivatives over a timestep */
+  double *daStepDeriv[4];     /**< daDeriv of each substep, by table row */
+  double *daStepDerivProc[4]; /**< daDerivProc of each substep, by table
+                                 equation */
 
   // Module-specific parameters
   int *iNumModules; /**< Number of Modules per Primary Variable */
@@ -1820,6 +1885,13 @@ struct IO {
    matrix through fnForceBehavior. */
 
 typedef double (*fnUpdateVariable)(BODY *, SYSTEM *, int *);
+/* Timescale kernels for fdGetTimeStep. They evaluate one row (primary
+   variable) or one equation of an UPDATETABLE and return the new minimum
+   timescale, given the current one. */
+typedef double (*fnTimeStepVariable)(BODY *, CONTROL *, SYSTEM *,
+                                     UPDATETABLE *, int, double);
+typedef double (*fnTimeStepEquation)(BODY *, CONTROL *, SYSTEM *,
+                                     UPDATETABLE *, int, int, double);
 typedef void (*fnPropsAuxModule)(BODY *, EVOLVE *, IO *, UPDATE *, int);
 typedef void (*fnForceBehaviorModule)(BODY *, MODULE *, EVOLVE *, IO *,
                                       SYSTEM *, UPDATE *, fnUpdateVariable ***,
@@ -1830,11 +1902,126 @@ typedef void (*fnForceBehaviorModule)(BODY *, MODULE *, EVOLVE *, IO *,
 typedef int (*fnHaltModule)(BODY *, EVOLVE *, HALT *, IO *, UPDATE *,
                             fnUpdateVariable ***, int);
 
+/* INTERPGRID is a table sampled on a rectilinear grid of up to
+   INTERPGRID_MAXDIM axes, interpolated multilinearly by fdInterpGrid. Each
+   axis remembers the cell of its last lookup, which is almost always still
+   the right one, and the reciprocals of its node spacings, so a lookup
+   needs no division. */
+
+#define INTERPGRID_MAXDIM 4
+
+typedef struct {
+  const double *daNode; /**< Grid points, increasing */
+  int iLen;             /**< Number of grid points */
+  int iStride;          /**< Distance between neighboring table entries */
+  int iHint;            /**< Cell of the last lookup */
+  double *daInvStep;    /**< Reciprocal width of each cell */
+} GRIDAXIS;
+
+typedef struct {
+  int iNumDim;                       /**< Number of axes */
+  GRIDAXIS aAxis[INTERPGRID_MAXDIM]; /**< Axes, first interpolated first */
+  /** Offsets of the corners of a cell from its lower corner */
+  int iaCornerOffset[1 << INTERPGRID_MAXDIM];
+  int bInit; /**< Have iaCornerOffset and daInvStep been set? */
+} INTERPGRID;
+
+/* STELLARTRACK is the interpolant of a STELLARGRID restricted to one mass
+   and metallicity, a cubic in age for each age cell. Tracks are built for
+   stars whose mass does not change, and filled cell by cell as they are
+   used. */
+
+typedef struct {
+  double dMass;        /**< Mass of the track [MSUN] */
+  double dMetallicity; /**< Metallicity of the track [Fe/H] */
+  int iMassIndex;      /**< Lower mass index of the grid cells */
+  double dDx;          /**< Normalized distance from the lower mass */
+  int iMetIndex;       /**< Lower metallicity slice */
+  double dDz;          /**< Normalized distance from the lower slice */
+  double *daRow[4];    /**< Cubic in age of each cell, by quantity */
+  char *caRowSet[4];   /**< Cells whose cubic is in daRow */
+  int iAgeHint;        /**< Age index of the last lookup */
+} STELLARTRACK;
+
+/* STELLARGRID describes a stellar evolution grid in mass, age and
+   optionally metallicity. The data are stored by metallicity, then mass:
+   daLogL[(iMet * iMLen + iMass) * iALen + iAge]. The bicubic coefficients
+   of a cell are computed the first time it is used and kept for the rest
+   of the run. */
+
+typedef struct {
+  int iMLen;              /**< Number of masses */
+  int iALen;              /**< Number of ages */
+  int iZLen;              /**< Number of metallicities, 1 without that axis */
+  const double *daMass;   /**< Masses [MSUN] */
+  const double *daAge;    /**< Ages [Gyr] */
+  const double *daMet;    /**< Metallicities [Fe/H], NULL without that axis */
+  const double *daLogL;   /**< log10 luminosity [LSUN] */
+  const double *daRadius; /**< Radius [RSUN] */
+  const double *daLogT;   /**< log10 effective temperature [K] */
+  const double *daRG;     /**< Radius of gyration */
+  void *pMap;             /**< Mapped grid file, NULL for the built-in grid */
+  size_t iMapSize;        /**< Size of the mapped file */
+  char cFile[OPTLEN];     /**< Name of the grid file */
+  double *daCoeff[4];     /**< Bicubic coefficients of each cell, by
+                               quantity (STELLAR_T - 1, ...) */
+  char *caCoeffSet[4];    /**< Cells whose coefficients are in daCoeff */
+  int iMassHint;          /**< Mass index of the last lookup */
+  int iAgeHint;           /**< Age index of the last lookup */
+  STELLARTRACK *aTrack;   /**< Tracks of stars with constant mass */
+  int iNumTracks;         /**< Number of tracks */
+} STELLARGRID;
+
+/* ARENA is a bump allocator for memory that lives as long as one
+   simulation. Requests are carved out of large blocks, so related arrays
+   are contiguous, and everything is released at once by ArenaRelease. */
+
+typedef struct ARENABLOCK ARENABLOCK;
+
+struct ARENABLOCK {
+  ARENABLOCK *pNext; /**< Previously filled block */
+  size_t iSize;      /**< Usable bytes in caData */
+  size_t iUsed;      /**< Bytes already handed out */
+  char *caData;      /**< Start of the block's memory */
+};
+
+typedef struct {
+  ARENABLOCK *pBlock; /**< Current block, head of the list */
+  size_t iTotal;      /**< Total bytes handed out */
+} ARENA;
+
+/* UPDATETABLE stores the equations of all bodies in contiguous arrays in
+   compressed sparse row form. Row iRow is primary variable iaRowVar[iRow] of
+   body iaRowBody[iRow], and its equations are iaRowStart[iRow] through
+   iaRowStart[iRow + 1] - 1. The per-body arrays in UPDATE point into these
+   arrays, so both views always hold the same values. */
+
+struct UPDATETABLE {
+  int iNumRows;        /**< Number of primary variables of all bodies */
+  int iNumEqns;        /**< Number of equations of all bodies */
+  int *iaRowStart;     /**< First equation of each row, then iNumEqns */
+  int *iaRowBody;      /**< Body number of each row */
+  int *iaRowVar;       /**< Primary variable index of each row */
+  double **pdVar;      /**< Primary variable of each row */
+  double *daDeriv;     /**< Total derivative of each row */
+  fnUpdateVariable *fnEqn; /**< Function of each equation */
+  int *iaType;         /**< Type of each equation */
+  int **iaBody;        /**< Body numbers passed to each equation */
+  double *daDerivProc; /**< Derivative of each equation */
+  fnTimeStepVariable *fnRowTimeStep; /**< Timescale kernel of each row */
+  fnTimeStepEquation *fnEqnTimeStep; /**< Timescale kernel of each equation in
+                                        rows using fdTimeStepRates */
+  int *iaLimitCount; /**< Number of steps whose timescale each row set */
+};
+
 struct CONTROL {
   EVOLVE Evolve;
   HALT *Halt;
   IO Io;
   UNITS *Units;
+  ARENA Arena; /**< Memory for the integration tables and input lists */
+  UPDATETABLE UpdateTable;    /**< Packed equations of the UPDATE array */
+  UPDATETABLE TmpUpdateTable; /**< Packed equations of Evolve.tmpUpdate */
 
   char sGitVersion[64];
 
@@ -2386,18 +2573,125 @@ struct MODULE {
 typedef void (*fnIntegrate)(BODY *, CONTROL *, SYSTEM *, UPDATE *,
                             fnUpdateVariable ***, double *, int);
 
+/* fnEnsembleEquation evaluates one equation for several members of an
+ * ensemble at once. Its arguments are the members' BODY and SYSTEM arrays,
+ * the bodies passed to the equation, the number of members, the derivatives
+ * to fill and scratch space for ENSEMBLEWORK values per member. */
+typedef void (*fnEnsembleEquation)(BODY **, SYSTEM **, int *, int, double *,
+                                   double *);
+
+/* ENSEMBLE holds simulations with identical UPDATETABLE layouts that are
+   integrated in lockstep, one Runge-Kutta step of every member at a time.
+   The primary variables and derivatives of all members are stored next to
+   each other, e.g. daVar[iRow * iNumMembers + iMember], so that the loops
+   over the members run over contiguous memory. Members that are finished
+   or not integrated in lockstep keep their slots with a zero timestep. */
+
+struct ENSEMBLE {
+  int iNumMembers;            /**< Number of simulations */
+  int iNumRows;               /**< Rows of each member's UPDATETABLE */
+  int iNumEqns;               /**< Equations of each member's UPDATETABLE */
+  int *iaRowStart;            /**< First equation of each row */
+  int *iaRowType;             /**< Type of the first equation of each row */
+  int iHomeFd;                /**< Directory the ensemble was started in */
+  int *iaDirFd;               /**< Working directory of each member */
+  int iCurrentMember;         /**< Member whose directory is current */
+  OPTIONS *Options;           /**< Options shared by all members */
+  OUTPUT *Output;             /**< Outputs shared by all members */
+  fnWriteOutput *fnWrite;     /**< Output functions */
+  BODY **pBody;               /**< BODY array of each member */
+  CONTROL *Control;           /**< CONTROL of each member */
+  FILES *Files;               /**< FILES of each member */
+  MODULE *Module;             /**< MODULE of each member */
+  SYSTEM *System;             /**< SYSTEM of each member */
+  UPDATE **pUpdate;           /**< UPDATE array of each member */
+  fnUpdateVariable ****pfnUpdate; /**< Derivatives of each member */
+  fnIntegrate *fnOneStep;     /**< Integration method of each member */
+  int iReference;             /**< First member integrated in lockstep */
+  int *bLockstep;             /**< Is the member integrated in lockstep? */
+  int *bActive;               /**< Is the member still being integrated? */
+  int iNumActive;             /**< Number of members still integrated */
+  int *iaActive;              /**< Members still integrated, in order */
+  double *daDir;              /**< Direction of each member, 0 if inactive */
+  double *daDt;               /**< Timestep of each member, 0 if inactive */
+  double *daVar;              /**< Primary variables at the start of a step */
+  double *daTmpVar;           /**< Primary variables at a substep */
+  double *daRowDeriv;         /**< Total derivative of each row */
+  double *daStepDeriv[4];     /**< Row derivatives of each substep */
+  double *daEqnDeriv;         /**< Derivative of each equation */
+  double *daStepEqnDeriv[4];  /**< Equation derivatives of each substep */
+  fnUpdateVariable *fnEqn;    /**< Equations the batched kernels replace */
+  fnEnsembleEquation *fnKernel; /**< Batched kernel of each equation */
+  BODY **pLaneBody;           /**< BODY arrays passed to a batched kernel */
+  SYSTEM **pLaneSystem;       /**< SYSTEMs passed to a batched kernel */
+  int *iaLane;                /**< Member of each lane of a batched kernel */
+  double *daLane;             /**< Results of a batched kernel */
+  double *daWork;             /**< Scratch space of the batched kernels */
+};
+
+/* SWEEP contains a parameter sweep read from a VSPACE input file. Each
+   member of the sweep is one complete simulation. */
+
+struct SWEEPPARAM {
+  char cName[OPTLEN];   /**< Option name */
+  char cPrefix[OPTLEN]; /**< Label used to build member names */
+  char cValue[LINE];    /**< Literal value for SWEEP_FIXED options */
+  int iFile;            /**< Input file the option belongs to */
+  int iDistrib;         /**< How values are generated (SWEEP_* in sweep.h) */
+  int iNumValues;       /**< Number of grid values */
+  double dMin;          /**< Grid start, lower bound, or Gaussian mean */
+  double dMax;          /**< Grid end, upper bound, or Gaussian width */
+  double dStep;         /**< Grid step size */
+  int bCutLow;          /**< Truncate the Gaussian below dCutLow? */
+  int bCutHigh;         /**< Truncate the Gaussian above dCutHigh? */
+  double dCutLow;       /**< Lower truncation of the Gaussian */
+  double dCutHigh;      /**< Upper truncation of the Gaussian */
+};
+
+struct SWEEP {
+  char cFile[NAMELEN];             /**< Name of the VSPACE input file */
+  char cSrcFolder[LINE];           /**< Folder with the template files */
+  char cDestFolder[LINE];          /**< Name of the sweep (and archive) */
+  char cTrialName[NAMELEN];        /**< Prefix of every member name */
+  int iSampleMode;                 /**< SWEEP_GRID or SWEEP_RANDOM */
+  int iNumTrials;                  /**< Number of random members */
+  int iSeed;                       /**< Seed for random members */
+  int iEnsembleSize;               /**< Members integrated by one worker */
+  int iNumFiles;                   /**< Number of template files */
+  int iPrimaryFile;                /**< Index of the primary input file */
+  char caFile[MAXFILES][NAMELEN];  /**< Template file names */
+  int iNumArchivePatterns;         /**< Number of saArchiveFiles patterns */
+  /** Shell patterns of the output files to archive besides the log */
+  char caArchivePattern[MAXFILES][NAMELEN];
+  char *saTemplate[MAXFILES];      /**< Template file contents */
+  int iNumParams;                  /**< Number of options to modify */
+  SWEEPPARAM *Param;               /**< Options to modify */
+  int iNumMembers;                 /**< Number of simulations */
+  int **iaIndex;                   /**< Grid index of each swept option */
+  double **daValue;                /**< Value of each option in each member */
+  char cArchive[LINE + 8];         /**< Name of the archive */
+  FILE *fpArchive;                 /**< Archive of all members' output */
+  int iNumArchived;                /**< Number of members in the archive */
+  int *iaArchived;                 /**< Members in order of completion */
+  long *laOffset;                  /**< Offset of each member's record */
+};
+
 /*
  * Other Header Files - These are primarily for function declarations
  */
 
 /* Top-level files */
+#include "arena.h"
 #include "body.h"
 #include "control.h"
+#include "ensemble.h"
 #include "evolve.h"
 #include "halt.h"
 #include "module.h"
 #include "options.h"
 #include "output.h"
+#include "server.h"
+#include "sweep.h"
 #include "system.h"
 #include "update.h"
 #include "verify.h"
@@ -2416,3 +2710,14 @@ typedef void (*fnIntegrate)(BODY *, CONTROL *, SYSTEM *, UPDATE *,
 #include "spinbody.h"
 #include "stellar.h"
 #include "thermint.h"
+
+/* vplanet.c */
+void InitializeSimulation(BODY **, CONTROL *, FILES *, MODULE *, OPTIONS *,
+                          OUTPUT *, SYSTEM *, UPDATE **, fnUpdateVariable ****,
+                          fnIntegrate *, fnReadOption[], fnWriteOutput[],
+                          char[], int, int);
+void FinishSimulation(BODY *, CONTROL *, FILES *, MODULE *, OPTIONS *,
+                      OUTPUT *, SYSTEM *, UPDATE *, fnUpdateVariable ***,
+                      fnWriteOutput[]);
+void RunSimulation(OPTIONS *, OUTPUT *, FILES *, fnReadOption[],
+                   fnWriteOutput[], char[], int, int);
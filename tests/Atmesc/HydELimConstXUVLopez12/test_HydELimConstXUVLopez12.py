@@ -60,16 +60,16 @@ import astropy.units as u
        "log.initial.planet.RGDuration": {"value": 1.00000e+06, "unit": u.yr}, 
        "log.final.system.Age": {"value": 6.311520e+13, "unit": u.sec}, 
        "log.final.system.Time": {"value": 3.155760e+13, "unit": u.sec}, 
-       "log.final.system.TotAngMom": {"value": 4.450092e+35, "unit": (u.kg * u.m ** 2) / u.sec}, 
-       "log.final.system.TotEnergy": {"value": -8.591537e+30, "unit": u.Joule}, 
-       "log.final.system.PotEnergy": {"value": -2.477253e+31, "unit": u.Joule}, 
-       "log.final.system.KinEnergy": {"value": 1.618099e+31, "unit": u.Joule}, 
+       "log.final.system.TotAngMom": {"value": 4.449900e+35, "unit": (u.kg * u.m ** 2) / u.sec}, 
+       "log.final.system.TotEnergy": {"value": -8.592766e+30, "unit": u.Joule}, 
+       "log.final.system.PotEnergy": {"value": -2.477306e+31, "unit": u.Joule}, 
+       "log.final.system.KinEnergy": {"value": 1.618029e+31, "unit": u.Joule}, 
        "log.final.system.DeltaTime": {"value": 6.275124e+09, "unit": u.sec}, 
        "log.final.planet.Mass": {"value": 1.140116, "unit": u.Mearth}, 
-       "log.final.planet.Radius": {"value": 7.494630e+07, "unit": u.m}, 
+       "log.final.planet.Radius": {"value": 7.494469e+07, "unit": u.m}, 
        "log.final.planet.RadGyra": {"value": 0.400000}, 
        "log.final.planet.BodyType": {"value": 0.000000}, 
-       "log.final.planet.Density": {"value": 3.861386, "unit": u.kg / u.m ** 3}, 
+       "log.final.planet.Density": {"value": 3.861635, "unit": u.kg / u.m ** 3}, 
        "log.final.planet.HZLimitDryRunaway": {"value": -1.000000, "unit": u.m}, 
        "log.final.planet.HZLimRecVenus": {"value": -1.000000}, 
        "log.final.planet.HZLimRunaway": {"value": -1.000000}, 
@@ -87,7 +87,7 @@ import astropy.units as u
        "log.final.planet.RGLimit": {"value": -1.000000, "unit": u.m}, 
        "log.final.planet.XO": {"value": 0.000000}, 
        "log.final.planet.EtaO": {"value": 0.000000}, 
-       "log.final.planet.PlanetRadius": {"value": 11.750569, "unit": u.Rearth}, 
+       "log.final.planet.PlanetRadius": {"value": 11.750316, "unit": u.Rearth}, 
        "log.final.planet.OxygenMantleMass": {"value": 0.000000, "unit": u.kg}, 
        "log.final.planet.RadXUV": {"value": -1.000000, "unit": u.m}, 
        "log.final.planet.RadSolid": {"value": -1.000000, "unit": u.m}, 
@@ -96,20 +96,20 @@ import astropy.units as u
        "log.final.planet.ThermTemp": {"value": 400.000000, "unit": u.K}, 
        "log.final.planet.AtmGasConst": {"value": 4124.000000}, 
        "log.final.planet.PresSurf": {"value": -1.000000, "unit": u.Pa}, 
-       "log.final.planet.DEnvMassDt": {"value": -2.910047e+10, "unit": u.kg / u.sec}, 
+       "log.final.planet.DEnvMassDt": {"value": -2.909913e+10, "unit": u.kg / u.sec}, 
        "log.final.planet.FXUV": {"value": 100.000000, "unit": u.W / u.m ** 2}, 
        "log.final.planet.AtmXAbsEffH2O": {"value": 0.300000}, 
        "log.final.planet.RocheRadius": {"value": 2.818540e+301, "unit": u.Rearth}, 
        "log.final.planet.BondiRadius": {"value": -1.567865e-07, "unit": u.Rearth}, 
        "log.final.planet.HEscapeRegime": {"value": 3.000000}, 
-       "log.final.planet.RRCriticalFlux": {"value": 0.096815, "unit": u.W / u.m ** 2}, 
+       "log.final.planet.RRCriticalFlux": {"value": 0.096821, "unit": u.W / u.m ** 2}, 
        "log.final.planet.CrossoverMass": {"value": 0.000000, "unit": u.kg}, 
        "log.final.planet.WaterEscapeRegime": {"value": 8.000000}, 
        "log.final.planet.FXUVCRITDRAG": {"value": 0.000213, "unit": u.W / u.m ** 2}, 
-       "log.final.planet.HREFFLUX": {"value": 7.448616e+20, "unit": 1 / u.m ** 2 / u.sec}, 
+       "log.final.planet.HREFFLUX": {"value": 7.448456e+20, "unit": 1 / u.m ** 2 / u.sec}, 
        "log.final.planet.XO2": {"value": 0.000000}, 
        "log.final.planet.XH2O": {"value": 0.000000}, 
-       "log.final.planet.HDiffFlux": {"value": 1.566642e+15, "unit": 1 / u.m ** 2 / u.sec}, 
+       "log.final.planet.HDiffFlux": {"value": 1.566710e+15, "unit": 1 / u.m ** 2 / u.sec}, 
        "log.final.planet.HRefODragMod": {"value": 1.000000}, 
        "log.final.planet.KTide": {"value": 1.000000}, 
        "log.final.planet.RGDuration": {"value": 1.00000e+06, "unit": u.yr}, 
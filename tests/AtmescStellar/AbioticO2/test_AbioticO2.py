@@ -163,7 +163,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.system.KinEnergy": {
-            "value": 8.299539e36,
+            "value": 8.300864e36,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -247,7 +247,7 @@ from benchmark import Benchmark, benchmark
         "log.final.star.LXUVStellar": {"value": 7.362970e20, "unit": u.W, "rtol": 1e-4},
         "log.final.star.Temperature": {"value": 2926.559809, "unit": u.K, "rtol": 1e-4},
         "log.final.star.LXUVFrac": {"value": 0.001000, "rtol": 1e-4},
-        "log.final.star.RossbyNumber": {"value": 0.005916, "rtol": 1e-4},
+        "log.final.star.RossbyNumber": {"value": 0.005915, "rtol": 1e-4},
         "log.final.star.DRotPerDtStellar": {"value": -4.367065e-12, "rtol": 1e-4},
         "log.final.b.Mass": {"value": 6.073713e24, "unit": u.kg, "rtol": 1e-4},
         "log.final.b.Radius": {"value": 7.149850e06, "unit": u.m, "rtol": 1e-4},
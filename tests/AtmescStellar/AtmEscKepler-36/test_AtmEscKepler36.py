@@ -213,10 +213,10 @@ import astropy.units as u
        "log.final.b.KTide": {"value": 0.936111, "rtol": 1e-4}, 
        "log.final.b.RGDuration": {"value": 0.00000e+00, "unit": u.yr, "rtol": 1e-4}, 
        "log.final.c.Mass": {"value": 6.650983e+25, "unit": u.kg, "rtol": 1e-4}, 
-       "log.final.c.Radius": {"value": 3.372667e+07, "unit": u.m, "rtol": 1e-4}, 
+       "log.final.c.Radius": {"value": 3.371919e+07, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.RadGyra": {"value": 0.500000, "rtol": 1e-4}, 
        "log.final.c.BodyType": {"value": 0.000000, "rtol": 1e-4}, 
-       "log.final.c.Density": {"value": 413.882226, "unit": u.kg / u.m ** 3, "rtol": 1e-4}, 
+       "log.final.c.Density": {"value": 414.157850, "unit": u.kg / u.m ** 3, "rtol": 1e-4}, 
        "log.final.c.HZLimitDryRunaway": {"value": 1.357831e+11, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.HZLimRecVenus": {"value": 1.118929e+11, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.HZLimRunaway": {"value": 1.461108e+11, "unit": u.m, "rtol": 1e-4}, 
@@ -234,7 +234,7 @@ import astropy.units as u
        "log.final.c.RGLimit": {"value": 1.349743e+11, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.XO": {"value": 0.000000, "rtol": 1e-4}, 
        "log.final.c.EtaO": {"value": 0.000000, "rtol": 1e-4}, 
-       "log.final.c.PlanetRadius": {"value": 3.372667e+07, "unit": u.m, "rtol": 1e-4}, 
+       "log.final.c.PlanetRadius": {"value": 3.371919e+07, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.OxygenMantleMass": {"value": 0.000000, "unit": u.kg, "rtol": 1e-4}, 
        "log.final.c.RadXUV": {"value": -1.000000, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.RadSolid": {"value": -1.000000, "unit": u.m, "rtol": 1e-4}, 
@@ -249,16 +249,16 @@ import astropy.units as u
        "log.final.c.RocheRadius": {"value": 3.342037e+08, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.BondiRadius": {"value": 2.872125e+07, "unit": u.m, "rtol": 1e-4}, 
        "log.final.c.HEscapeRegime": {"value": 7.000000, "rtol": 1e-4}, 
-       "log.final.c.RRCriticalFlux": {"value": 73.086412, "unit": u.W / u.m ** 2, "rtol": 1e-4}, 
+       "log.final.c.RRCriticalFlux": {"value": 73.140807, "unit": u.W / u.m ** 2, "rtol": 1e-4}, 
        "log.final.c.CrossoverMass": {"value": 0.000000, "unit": u.kg, "rtol": 1e-4}, 
        "log.final.c.WaterEscapeRegime": {"value": 8.000000, "rtol": 1e-4}, 
-       "log.final.c.FXUVCRITDRAG": {"value": 0.223423, "unit": u.W / u.m ** 2, "rtol": 1e-4}, 
-       "log.final.c.HREFFLUX": {"value": 4.483991e+17, "unit": 1 / u.m ** 2 / u.sec, "rtol": 1e-4}, 
+       "log.final.c.FXUVCRITDRAG": {"value": 0.223572, "unit": u.W / u.m ** 2, "rtol": 1e-4}, 
+       "log.final.c.HREFFLUX": {"value": 4.482821e+17, "unit": 1 / u.m ** 2 / u.sec, "rtol": 1e-4}, 
        "log.final.c.XO2": {"value": 0.000000, "rtol": 1e-4}, 
        "log.final.c.XH2O": {"value": 0.000000, "rtol": 1e-4}, 
-       "log.final.c.HDiffFlux": {"value": 7.556605e+16, "unit": 1 / u.m ** 2 / u.sec, "rtol": 1e-4}, 
+       "log.final.c.HDiffFlux": {"value": 7.559959e+16, "unit": 1 / u.m ** 2 / u.sec, "rtol": 1e-4}, 
        "log.final.c.HRefODragMod": {"value": 1.000000, "rtol": 1e-4}, 
-       "log.final.c.KTide": {"value": 0.849139, "rtol": 1e-4}, 
+       "log.final.c.KTide": {"value": 0.849172, "rtol": 1e-4}, 
        "log.final.c.RGDuration": {"value": 0.00000e+00, "unit": u.yr, "rtol": 1e-4}, 
    } 
 )
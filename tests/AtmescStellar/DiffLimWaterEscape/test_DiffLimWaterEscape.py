@@ -148,12 +148,12 @@ from benchmark import Benchmark, benchmark
         "log.final.system.Age": {"value": 3.001128e16, "unit": u.sec, "rtol": 1e-4},
         "log.final.system.Time": {"value": 2.997972e16, "unit": u.sec, "rtol": 1e-4},
         "log.final.system.TotAngMom": {
-            "value": 1.140606e42,
+            "value": 1.145845e42,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
         "log.final.system.TotEnergy": {
-            "value": -1.889993e39,
+            "value": -1.885232e39,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -163,7 +163,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.system.KinEnergy": {
-            "value": 9.851973e35,
+            "value": 9.946972e35,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -171,22 +171,22 @@ from benchmark import Benchmark, benchmark
         "log.final.star.Radius": {"value": 7.861410e07, "unit": u.m, "rtol": 1e-4},
         "log.final.star.RadGyra": {"value": 0.465100, "rtol": 1e-4},
         "log.final.star.RotAngMom": {
-            "value": 2.171192e40,
+            "value": 2.181635e40,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
         "log.final.star.RotVel": {
-            "value": 7134.365876,
+            "value": 7168.680433,
             "unit": u.m / u.sec,
             "rtol": 1e-4,
         },
         "log.final.star.BodyType": {"value": 0.000000, "rtol": 1e-4},
         "log.final.star.RotRate": {
-            "value": 9.075173e-05,
+            "value": 9.118823e-05,
             "unit": 1 / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.star.RotPer": {"value": 6.923488e04, "unit": u.sec, "rtol": 1e-4},
+        "log.final.star.RotPer": {"value": 6.890347e04, "unit": u.sec, "rtol": 1e-4},
         "log.final.star.Density": {
             "value": 8.793460e04,
             "unit": u.kg / u.m**3,
@@ -234,12 +234,12 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.star.LXUVTot": {"value": 5.680628e-07, "unit": u.LSUN, "rtol": 1e-4},
         "log.final.star.LostEnergy": {
-            "value": 1.442284e40,
+            "value": 1.442759e40,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.star.LostAngMom": {
-            "value": 1.116766e42,
+            "value": 1.121900e42,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
@@ -247,7 +247,7 @@ from benchmark import Benchmark, benchmark
         "log.final.star.LXUVStellar": {"value": 2.184770e20, "unit": u.W, "rtol": 1e-4},
         "log.final.star.Temperature": {"value": 2649.349787, "unit": u.K, "rtol": 1e-4},
         "log.final.star.LXUVFrac": {"value": 0.001000, "rtol": 1e-4},
-        "log.final.star.RossbyNumber": {"value": 0.009905, "rtol": 1e-4},
+        "log.final.star.RossbyNumber": {"value": 0.009857, "rtol": 1e-4},
         "log.final.star.DRotPerDtStellar": {"value": 1.447216e-12, "rtol": 1e-4},
         "log.final.b.Mass": {"value": 8.223700e24, "unit": u.kg, "rtol": 1e-4},
         "log.final.b.Radius": {"value": 7.124338e06, "unit": u.m, "rtol": 1e-4},
@@ -350,7 +350,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.system.TotEnergy": {
-            "value": -1.964618e41,
+            "value": -1.963639e41,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -360,7 +360,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.system.KinEnergy": {
-            "value": 5.383156e38,
+            "value": 5.414298e38,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -373,34 +373,34 @@ from benchmark import Benchmark, benchmark
         "log.final.primary.Radius": {"value": 1.334698e09, "unit": u.m, "rtol": 1e-4},
         "log.final.primary.RadGyra": {"value": 0.451302, "rtol": 1e-4},
         "log.final.primary.RotAngMom": {
-            "value": 2.787002e43,
+            "value": 2.795024e43,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
         "log.final.primary.RotKinEnergy": {
-            "value": 5.383156e38,
+            "value": 5.414298e38,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.primary.RotVel": {
-            "value": 5.155998e04,
+            "value": 5.170890e04,
             "unit": u.m / u.sec,
             "rtol": 1e-4,
         },
         "log.final.primary.BodyType": {"value": 1.000000, "rtol": 1e-4},
         "log.final.primary.RotRate": {
-            "value": 3.863044e-05,
+            "value": 3.874241e-05,
             "unit": 1 / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.primary.RotPer": {"value": 1.626486e05, "unit": u.sec, "rtol": 1e-4},
+        "log.final.primary.RotPer": {"value": 1.621785e05, "unit": u.sec, "rtol": 1e-4},
         "log.final.primary.Density": {
             "value": 199.650029,
             "unit": u.kg / u.m**3,
             "rtol": 1e-4,
         },
         "log.final.primary.SurfEnFluxTotal": {
-            "value": 6.583204e05,
+            "value": 6.616662e05,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
@@ -499,12 +499,12 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.primary.LostEnergy": {
-            "value": 2.595878e40,
+            "value": 2.600582e40,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.primary.LostAngMom": {
-            "value": 4.290187e41,
+            "value": 4.297453e41,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
@@ -559,19 +559,19 @@ from benchmark import Benchmark, benchmark
         "log.final.primary.OceanTidalQ": {"value": -1.000000, "rtol": 1e-4},
         "log.final.primary.TideLock": {"value": 0.000000, "rtol": 1e-4},
         "log.final.primary.RotTimeEqtide": {
-            "value": 4.141359e13,
+            "value": 4.153492e13,
             "unit": u.sec,
             "rtol": 1e-4,
         },
         "log.final.primary.EnvK2": {"value": 0.010000, "rtol": 1e-4},
         "log.final.primary.OblTimeEqtide": {"value": -1.000000, "rtol": 1e-4},
         "log.final.primary.PowerEqtide": {
-            "value": 1.473715e25,
+            "value": 1.481174e25,
             "unit": u.W,
             "rtol": 1e-4,
         },
         "log.final.primary.SurfEnFluxEqtide": {
-            "value": 6.583204e05,
+            "value": 6.616662e05,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
@@ -591,7 +591,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.primary.LXUVFrac": {"value": 0.001000, "rtol": 1e-4},
-        "log.final.primary.RossbyNumber": {"value": 0.055669, "rtol": 1e-4},
+        "log.final.primary.RossbyNumber": {"value": 0.055508, "rtol": 1e-4},
         "log.final.primary.DRotPerDtStellar": {"value": -1.661944e-09, "rtol": 1e-4},
         "log.final.primary.FreeEcc": {"value": -1.000000, "rtol": 1e-4},
         "log.final.primary.FreeInc": {"value": -1.000000, "unit": u.rad, "rtol": 1e-4},
@@ -618,14 +618,14 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.primary.R0": {"value": 0.000000, "unit": u.m, "rtol": 1e-4},
         "log.final.primary.CBPInsol": {"value": -1.000000, "rtol": 1e-4},
-        "log.final.primary.BinPriR": {"value": 6.421344e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.primary.BinPriR": {"value": 4.726100e09, "unit": u.m, "rtol": 1e-4},
         "log.final.primary.BinPriPhi": {
-            "value": -2.915610,
+            "value": 1.027108,
             "unit": u.rad,
             "rtol": 1e-4,
         },
-        "log.final.primary.BinSecR": {"value": 6.421344e09, "unit": u.m, "rtol": 1e-4},
-        "log.final.primary.BinSecPhi": {"value": 0.225983, "unit": u.rad, "rtol": 1e-4},
+        "log.final.primary.BinSecR": {"value": 4.726100e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.primary.BinSecPhi": {"value": 4.168701, "unit": u.rad, "rtol": 1e-4},
         "log.final.secondary.Mass": {"value": 1.988416e30, "unit": u.kg, "rtol": 1e-4},
         "log.final.secondary.Obliquity": {
             "value": 0.000000,
@@ -643,34 +643,34 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.secondary.RadGyra": {"value": 0.451302, "rtol": 1e-4},
         "log.final.secondary.RotAngMom": {
-            "value": 2.787002e43,
+            "value": 2.795024e43,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
         "log.final.secondary.RotKinEnergy": {
-            "value": 5.383156e38,
+            "value": 5.414298e38,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.secondary.RotVel": {
-            "value": 5.155998e04,
+            "value": 5.170890e04,
             "unit": u.m / u.sec,
             "rtol": 1e-4,
         },
         "log.final.secondary.BodyType": {"value": 1.000000, "rtol": 1e-4},
         "log.final.secondary.RotRate": {
-            "value": 3.863044e-05,
+            "value": 3.874241e-05,
             "unit": 1 / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.secondary.RotPer": {"value": 1.882507, "unit": u.day, "rtol": 1e-4},
+        "log.final.secondary.RotPer": {"value": 1.877066, "unit": u.day, "rtol": 1e-4},
         "log.final.secondary.Density": {
             "value": 199.650029,
             "unit": u.kg / u.m**3,
             "rtol": 1e-4,
         },
         "log.final.secondary.SurfEnFluxTotal": {
-            "value": 6.583204e05,
+            "value": 6.616662e05,
             "unit": u.W / u.m**2,
             "rtol": 1e-4,
         },
@@ -769,12 +769,12 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.secondary.LostEnergy": {
-            "value": 2.595878e40,
+            "value": 2.600582e40,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.secondary.LostAngMom": {
-            "value": 4.290187e41,
+            "value": 4.297453e41,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
@@ -897,19 +897,19 @@ from benchmark import Benchmark, benchmark
         "log.final.secondary.OceanTidalQ": {"value": -1.000000, "rtol": 1e-4},
         "log.final.secondary.TideLock": {"value": 0.000000, "rtol": 1e-4},
         "log.final.secondary.RotTimeEqtide": {
-            "value": 4.141359e13,
+            "value": 4.153492e13,
             "unit": u.sec,
             "rtol": 1e-4,
         },
         "log.final.secondary.EnvK2": {"value": 0.010000, "rtol": 1e-4},
         "log.final.secondary.OblTimeEqtide": {"value": -1.000000, "rtol": 1e-4},
         "log.final.secondary.PowerEqtide": {
-            "value": 1.473715e25,
+            "value": 1.481174e25,
             "unit": u.W,
             "rtol": 1e-4,
         },
         "log.final.secondary.SurfEnFluxEqtide": {
-            "value": 6.583204e05,
+            "value": 6.616662e05,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
@@ -929,7 +929,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.secondary.LXUVFrac": {"value": 0.001000, "rtol": 1e-4},
-        "log.final.secondary.RossbyNumber": {"value": 0.055669, "rtol": 1e-4},
+        "log.final.secondary.RossbyNumber": {"value": 0.055508, "rtol": 1e-4},
         "log.final.secondary.DRotPerDtStellar": {"value": -1.661944e-09, "rtol": 1e-4},
         "log.final.secondary.FreeEcc": {"value": -1.000000, "rtol": 1e-4},
         "log.final.secondary.FreeInc": {
@@ -961,22 +961,22 @@ from benchmark import Benchmark, benchmark
         "log.final.secondary.R0": {"value": 0.000000, "unit": u.m, "rtol": 1e-4},
         "log.final.secondary.CBPInsol": {"value": -1.000000, "rtol": 1e-4},
         "log.final.secondary.BinPriR": {
-            "value": 6.421344e09,
+            "value": 4.726100e09,
             "unit": u.m,
             "rtol": 1e-4,
         },
         "log.final.secondary.BinPriPhi": {
-            "value": -2.915610,
+            "value": 1.027108,
             "unit": u.rad,
             "rtol": 1e-4,
         },
         "log.final.secondary.BinSecR": {
-            "value": 6.421344e09,
+            "value": 4.726100e09,
             "unit": u.m,
             "rtol": 1e-4,
         },
         "log.final.secondary.BinSecPhi": {
-            "value": 0.225983,
+            "value": 4.168701,
             "unit": u.rad,
             "rtol": 1e-4,
         },
@@ -1021,20 +1021,20 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.cbp.Instellation": {
-            "value": 6561.097947,
+            "value": 6563.812985,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
-        "log.final.cbp.Eccentricity": {"value": 0.030249, "rtol": 1e-4},
+        "log.final.cbp.Eccentricity": {"value": 0.030068, "rtol": 1e-4},
         "log.final.cbp.OrbEnergy": {"value": 0.000000, "unit": u.Joule, "rtol": 1e-4},
         "log.final.cbp.MeanMotion": {
             "value": 4.791245e-07,
             "unit": 1 / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.cbp.OrbPeriod": {"value": 1.316341e07, "unit": u.sec, "rtol": 1e-4},
+        "log.final.cbp.OrbPeriod": {"value": 1.315818e07, "unit": u.sec, "rtol": 1e-4},
         "log.final.cbp.SemiMajorAxis": {
-            "value": 1.052219e11,
+            "value": 1.051941e11,
             "unit": u.m,
             "rtol": 1e-4,
         },
@@ -1049,10 +1049,10 @@ from benchmark import Benchmark, benchmark
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.cbp.ArgP": {"value": 2.120813, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.ArgP": {"value": 2.128283, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.Inc": {"value": 0.005463, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.LongA": {"value": 5.803411, "unit": u.rad, "rtol": 1e-4},
-        "log.final.cbp.LongP": {"value": 1.641039, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.LongP": {"value": 1.648518, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.TotOrbEnergy": {
             "value": -1.220006e40,
             "unit": u.Joule,
@@ -1072,7 +1072,7 @@ from benchmark import Benchmark, benchmark
         "log.final.cbp.CBPZ": {"value": 3.846763e08, "unit": u.m, "rtol": 1e-4},
         "log.final.cbp.CBPPhi": {"value": 0.259278, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.CBPRDot": {
-            "value": -1493.596117,
+            "value": -1486.935122,
             "unit": u.m / u.sec,
             "rtol": 1e-4,
         },
@@ -1088,10 +1088,10 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.cbp.R0": {"value": 1.049579e11, "unit": u.m, "rtol": 1e-4},
         "log.final.cbp.CBPInsol": {"value": 4.858289, "rtol": 1e-4},
-        "log.final.cbp.BinPriR": {"value": 6.421344e09, "unit": u.m, "rtol": 1e-4},
-        "log.final.cbp.BinPriPhi": {"value": -2.915610, "unit": u.rad, "rtol": 1e-4},
-        "log.final.cbp.BinSecR": {"value": 6.421344e09, "unit": u.m, "rtol": 1e-4},
-        "log.final.cbp.BinSecPhi": {"value": 0.225983, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.BinPriR": {"value": 4.726100e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.cbp.BinPriPhi": {"value": 1.027108, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.BinSecR": {"value": 4.726100e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.cbp.BinSecPhi": {"value": 4.168701, "unit": u.rad, "rtol": 1e-4},
     }
 )
 class Test_STEEP_CBP_CPL(Benchmark):
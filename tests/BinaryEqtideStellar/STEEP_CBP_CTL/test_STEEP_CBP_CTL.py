@@ -342,7 +342,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.system.KinEnergy": {
-            "value": 2.046791e38,
+            "value": 2.047215e38,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -359,34 +359,34 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.primary.RadGyra": {"value": 0.451302, "rtol": 1e-4},
         "log.final.primary.RotAngMom": {
-            "value": 1.718519e43,
+            "value": 1.718698e43,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
         "log.final.primary.RotKinEnergy": {
-            "value": 2.046791e38,
+            "value": 2.047215e38,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.primary.RotVel": {
-            "value": 3.179296e04,
+            "value": 3.179625e04,
             "unit": u.m / u.sec,
             "rtol": 1e-4,
         },
         "log.final.primary.BodyType": {"value": 1.000000, "rtol": 1e-4},
         "log.final.primary.RotRate": {
-            "value": 2.058083,
+            "value": 2.058295,
             "unit": 1 / u.day,
             "rtol": 1e-4,
         },
-        "log.final.primary.RotPer": {"value": 3.052930, "unit": u.day, "rtol": 1e-4},
+        "log.final.primary.RotPer": {"value": 3.052616, "unit": u.day, "rtol": 1e-4},
         "log.final.primary.Density": {
             "value": 199.651861,
             "unit": u.kg / u.m**3,
             "rtol": 1e-4,
         },
         "log.final.primary.SurfEnFluxTotal": {
-            "value": 1.927577e05,
+            "value": 1.928116e05,
             "unit": u.W / u.m**2,
             "rtol": 1e-4,
         },
@@ -484,12 +484,12 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.primary.LostEnergy": {
-            "value": 3.393135e40,
+            "value": 3.393560e40,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.primary.LostAngMom": {
-            "value": 3.459611e41,
+            "value": 3.459970e41,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
@@ -530,12 +530,12 @@ from benchmark import Benchmark, benchmark
         "log.final.primary.EnvK2": {"value": 0.010000, "rtol": 1e-4},
         "log.final.primary.OblTimeEqtide": {"value": -1.000000, "rtol": 1e-4},
         "log.final.primary.PowerEqtide": {
-            "value": 4.315042e24,
+            "value": 4.316256e24,
             "unit": u.W,
             "rtol": 1e-4,
         },
         "log.final.primary.SurfEnFluxEqtide": {
-            "value": 1.927577e05,
+            "value": 1.928116e05,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
@@ -582,14 +582,14 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.primary.R0": {"value": 0.000000, "unit": u.m, "rtol": 1e-4},
         "log.final.primary.CBPInsol": {"value": -1.000000, "rtol": 1e-4},
-        "log.final.primary.BinPriR": {"value": 5.235229e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.primary.BinPriR": {"value": 8.059179e09, "unit": u.m, "rtol": 1e-4},
         "log.final.primary.BinPriPhi": {
-            "value": -0.732909,
+            "value": 2.257084,
             "unit": u.rad,
             "rtol": 1e-4,
         },
-        "log.final.primary.BinSecR": {"value": 5.235229e09, "unit": u.m, "rtol": 1e-4},
-        "log.final.primary.BinSecPhi": {"value": 2.408684, "unit": u.rad, "rtol": 1e-4},
+        "log.final.primary.BinSecR": {"value": 8.059179e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.primary.BinSecPhi": {"value": 5.398677, "unit": u.rad, "rtol": 1e-4},
         "log.final.secondary.Mass": {"value": 1.988416e30, "unit": u.kg, "rtol": 1e-4},
         "log.final.secondary.Obliquity": {
             "value": 0.000000,
@@ -607,17 +607,17 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.secondary.RadGyra": {"value": 0.451302, "rtol": 1e-4},
         "log.final.secondary.RotAngMom": {
-            "value": 1.718519e43,
+            "value": 1.718698e43,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
         "log.final.secondary.RotKinEnergy": {
-            "value": 2.046791e38,
+            "value": 2.047215e38,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.secondary.RotVel": {
-            "value": 3.179296e04,
+            "value": 3.179625e04,
             "unit": u.m / u.sec,
             "rtol": 1e-4,
         },
@@ -627,14 +627,14 @@ from benchmark import Benchmark, benchmark
             "unit": 1 / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.secondary.RotPer": {"value": 3.052930, "unit": u.day, "rtol": 1e-4},
+        "log.final.secondary.RotPer": {"value": 3.052616, "unit": u.day, "rtol": 1e-4},
         "log.final.secondary.Density": {
             "value": 199.651861,
             "unit": u.kg / u.m**3,
             "rtol": 1e-4,
         },
         "log.final.secondary.SurfEnFluxTotal": {
-            "value": 1.927577e05,
+            "value": 1.928116e05,
             "unit": u.W / u.m**2,
             "rtol": 1e-4,
         },
@@ -732,12 +732,12 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.secondary.LostEnergy": {
-            "value": 3.393135e40,
+            "value": 3.393560e40,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.secondary.LostAngMom": {
-            "value": 3.459611e41,
+            "value": 3.459970e41,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
@@ -763,12 +763,12 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.secondary.DOrbPerDtEqtide": {"value": 8.225114e-10, "rtol": 1e-4},
         "log.final.secondary.EccTimeEqtide": {
-            "value": 2.505109e15,
+            "value": 2.501901e15,
             "unit": u.sec,
             "rtol": 1e-4,
         },
         "log.final.secondary.SemiTimeEqtide": {
-            "value": 1.205636e15,
+            "value": 1.205289e15,
             "unit": u.sec,
             "rtol": 1e-4,
         },
@@ -842,12 +842,12 @@ from benchmark import Benchmark, benchmark
         "log.final.secondary.EnvK2": {"value": 0.010000, "rtol": 1e-4},
         "log.final.secondary.OblTimeEqtide": {"value": -1.000000, "rtol": 1e-4},
         "log.final.secondary.PowerEqtide": {
-            "value": 4.315042e24,
+            "value": 4.316256e24,
             "unit": u.W,
             "rtol": 1e-4,
         },
         "log.final.secondary.SurfEnFluxEqtide": {
-            "value": 1.927577e05,
+            "value": 1.928116e05,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
@@ -899,22 +899,22 @@ from benchmark import Benchmark, benchmark
         "log.final.secondary.R0": {"value": 0.000000, "unit": u.m, "rtol": 1e-4},
         "log.final.secondary.CBPInsol": {"value": -1.000000, "rtol": 1e-4},
         "log.final.secondary.BinPriR": {
-            "value": 5.235229e09,
+            "value": 8.059179e09,
             "unit": u.m,
             "rtol": 1e-4,
         },
         "log.final.secondary.BinPriPhi": {
-            "value": -0.732909,
+            "value": 2.257084,
             "unit": u.rad,
             "rtol": 1e-4,
         },
         "log.final.secondary.BinSecR": {
-            "value": 5.235229e09,
+            "value": 8.059179e09,
             "unit": u.m,
             "rtol": 1e-4,
         },
         "log.final.secondary.BinSecPhi": {
-            "value": 2.408684,
+            "value": 5.398677,
             "unit": u.rad,
             "rtol": 1e-4,
         },
@@ -959,13 +959,13 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.cbp.Instellation": {
-            "value": 6612.163368,
+            "value": 6641.396386,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
-        "log.final.cbp.Eccentricity": {"value": 0.031100, "rtol": 1e-4},
+        "log.final.cbp.Eccentricity": {"value": 0.030526, "rtol": 1e-4},
         "log.final.cbp.OrbEnergy": {
-            "value": -7.556798e33,
+            "value": -7.555462e33,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -974,9 +974,9 @@ from benchmark import Benchmark, benchmark
             "unit": 1 / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.cbp.OrbPeriod": {"value": 1.309994e07, "unit": u.sec, "rtol": 1e-4},
+        "log.final.cbp.OrbPeriod": {"value": 1.310342e07, "unit": u.sec, "rtol": 1e-4},
         "log.final.cbp.SemiMajorAxis": {
-            "value": 1.048835e11,
+            "value": 1.049020e11,
             "unit": u.m,
             "rtol": 1e-4,
         },
@@ -987,21 +987,21 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.cbp.COPP": {"value": 0.000000, "rtol": 1e-4},
         "log.final.cbp.OrbAngMom": {
-            "value": 3.149541e40,
+            "value": 3.149875e40,
             "unit": (u.kg * u.m**2) / u.sec,
             "rtol": 1e-4,
         },
-        "log.final.cbp.ArgP": {"value": 2.250609, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.ArgP": {"value": 2.240323, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.Inc": {"value": 0.005259, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.LongA": {"value": 5.841417, "unit": u.rad, "rtol": 1e-4},
-        "log.final.cbp.LongP": {"value": 1.808841, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.LongP": {"value": 1.799111, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.TotOrbEnergy": {
             "value": -9.211934e39,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
         "log.final.cbp.OrbPotEnergy": {
-            "value": -1.511360e34,
+            "value": -1.511092e34,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
@@ -1014,7 +1014,7 @@ from benchmark import Benchmark, benchmark
         "log.final.cbp.CBPZ": {"value": -5.638753e08, "unit": u.m, "rtol": 1e-4},
         "log.final.cbp.CBPPhi": {"value": 4.232754, "unit": u.rad, "rtol": 1e-4},
         "log.final.cbp.CBPRDot": {
-            "value": 1029.297122,
+            "value": 998.966275,
             "unit": u.m / u.sec,
             "rtol": 1e-4,
         },
@@ -1030,10 +1030,10 @@ from benchmark import Benchmark, benchmark
         },
         "log.final.cbp.R0": {"value": 1.049579e11, "unit": u.m, "rtol": 1e-4},
         "log.final.cbp.CBPInsol": {"value": 4.611149, "rtol": 1e-4},
-        "log.final.cbp.BinPriR": {"value": 5.235229e09, "unit": u.m, "rtol": 1e-4},
-        "log.final.cbp.BinPriPhi": {"value": -0.732909, "unit": u.rad, "rtol": 1e-4},
-        "log.final.cbp.BinSecR": {"value": 5.235229e09, "unit": u.m, "rtol": 1e-4},
-        "log.final.cbp.BinSecPhi": {"value": 2.408684, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.BinPriR": {"value": 8.059179e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.cbp.BinPriPhi": {"value": 2.257084, "unit": u.rad, "rtol": 1e-4},
+        "log.final.cbp.BinSecR": {"value": 8.059179e09, "unit": u.m, "rtol": 1e-4},
+        "log.final.cbp.BinSecPhi": {"value": 5.398677, "unit": u.rad, "rtol": 1e-4},
     }
 )
 class Test_STEEP_CBP_CTL(Benchmark):
@@ -466,7 +466,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.star.LostEnergy": {
-            "value": 1.876648e36,
+            "value": 1.905357e36,
             "unit": u.Joule,
             "rtol": 1e-4,
         },
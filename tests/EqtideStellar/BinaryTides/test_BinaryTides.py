@@ -311,7 +311,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.primary.SurfEnFluxTotal": {
-            "value": 2.137000e05,
+            "value": 2.136574e05,
             "unit": u.W / u.m**2,
             "rtol": 1e-4,
         },
@@ -478,12 +478,12 @@ from benchmark import Benchmark, benchmark
         "log.final.primary.EnvK2": {"value": 0.010000, "rtol": 1e-4},
         "log.final.primary.OblTimeEqtide": {"value": -1.000000, "rtol": 1e-4},
         "log.final.primary.PowerEqtide": {
-            "value": 4.783780e24,
+            "value": 4.782818e24,
             "unit": u.W,
             "rtol": 1e-4,
         },
         "log.final.primary.SurfEnFluxEqtide": {
-            "value": 2.137000e05,
+            "value": 2.136574e05,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
@@ -549,7 +549,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.secondary.SurfEnFluxTotal": {
-            "value": 2.137000e05,
+            "value": 2.136574e05,
             "unit": u.W / u.m**2,
             "rtol": 1e-4,
         },
@@ -754,7 +754,7 @@ from benchmark import Benchmark, benchmark
             "rtol": 1e-4,
         },
         "log.final.secondary.EqTidePower": {
-            "value": 3.005173e24,
+            "value": 3.004554e24,
             "unit": 1 / u.sec,
             "rtol": 1e-4,
         },
@@ -780,12 +780,12 @@ from benchmark import Benchmark, benchmark
         "log.final.secondary.EnvK2": {"value": 0.010000, "rtol": 1e-4},
         "log.final.secondary.OblTimeEqtide": {"value": -1.000000, "rtol": 1e-4},
         "log.final.secondary.PowerEqtide": {
-            "value": 4.783780e24,
+            "value": 4.782818e24,
             "unit": u.W,
             "rtol": 1e-4,
         },
         "log.final.secondary.SurfEnFluxEqtide": {
-            "value": 2.137000e05,
+            "value": 2.136574e05,
             "unit": u.kg / u.sec**3,
             "rtol": 1e-4,
         },
@@ -0,0 +1,33 @@
+import pathlib
+import shutil
+import subprocess
+
+import numpy as np
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def test_AnnualSolver(tmp_path):
+    # The log of the annual model would need the seasonal model's arrays, so
+    # bDoLog is off and the output files are read directly
+    for file in ["vpl.in", "sun.in", "earth.in", "anderson.in"]:
+        shutil.copy(path / file, tmp_path)
+    subprocess.check_output(
+        [str(path / "../../../bin/vplanet"), "vpl.in", "-q"], cwd=tmp_path
+    )
+
+    # Time, TGlobal, AlbedoGlobal, FluxOutGlobal, Obliq
+    relax = np.loadtxt(tmp_path / "annual.earth.forward")
+    anderson = np.loadtxt(tmp_path / "annual.anderson.forward")
+    assert relax.shape == anderson.shape == (11, 5)
+
+    # The obliquity cycle crosses the ice-albedo threshold and back
+    assert np.any(relax[:, 2] > relax[0, 2])
+    assert np.allclose(anderson, relax, rtol=1e-9, atol=0)
+
+    # Time, Latitude, TempLat, AlbedoLat, AnnInsol, FluxIn, FluxOut
+    relax = np.loadtxt(tmp_path / "annual.earth.Climate")
+    anderson = np.loadtxt(tmp_path / "annual.anderson.Climate")
+    assert relax.shape == anderson.shape
+    assert np.array_equal(anderson[:, 3], relax[:, 3])
+    assert np.allclose(anderson, relax, rtol=0, atol=1e-6)
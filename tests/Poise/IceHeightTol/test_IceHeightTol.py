@@ -0,0 +1,25 @@
+import astropy.units as u
+import numpy as np
+
+# dIceHeightTol of the adaptive planet
+dTol = 1 * u.m
+
+
+def test_IceHeightTol(vplanet_output):
+    earth = vplanet_output.earth
+    adaptive = vplanet_output.adaptive
+
+    # The ice sheets grow over 20 kyr; the adaptive steps follow the fixed
+    # one-orbit steps to about the accumulated tolerance
+    assert earth.TotIceMass[-1] > 0
+    assert np.allclose(
+        adaptive.TotIceMass.value, earth.TotIceMass.value, rtol=2e-3, atol=0
+    )
+    assert np.allclose(adaptive.TGlobal.value, earth.TGlobal.value, rtol=0, atol=2e-3)
+    assert np.array_equal(adaptive.AlbedoGlobal.value, earth.AlbedoGlobal.value)
+    assert np.allclose(
+        adaptive.IceHeight.to(u.m).value,
+        earth.IceHeight.to(u.m).value,
+        rtol=0,
+        atol=10 * dTol.value,
+    )
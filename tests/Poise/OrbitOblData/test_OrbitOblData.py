@@ -0,0 +1,103 @@
+import pathlib
+import shutil
+import struct
+import subprocess
+
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+# Unit conversions of vplanet.h, so both files hold the same doubles
+YEARSEC = 3.15576e7
+AUM = 1.49597870700e11
+DEGRAD = 0.017453292519444445
+
+
+def forcing():
+    # Rows that do not fall on the output times, over 1050 years [yr, au, deg]
+    time = np.arange(0.0, 1051.0, 75.0)
+    semi = 1.02 + 0.01 * np.sin(2 * np.pi * time / 900)
+    ecc = 0.02 + 0.015 * np.sin(2 * np.pi * time / 700)
+    argp = 10 + 0.3 * time
+    longa = np.full_like(time, 5.0)
+    obl = 23.5 + 2 * np.sin(2 * np.pi * time / 400)
+    # Wraps through 360 degrees at 200 years
+    preca = (350 + 0.05 * time) % 360
+    return [time, semi, ecc, argp, longa, obl, preca]
+
+
+def write_text(file, columns):
+    with open(file, "w") as f:
+        for row in zip(*columns):
+            f.write(" ".join("{:.17g}".format(value) for value in row) + "\n")
+
+
+def write_binary(file, columns):
+    # The layout read by fvMapOrbitOblData in src/poise.c
+    factors = [YEARSEC, AUM, 1, DEGRAD, DEGRAD, DEGRAD, DEGRAD]
+    with open(file, "wb") as f:
+        f.write(b"VPLORBOB")
+        f.write(struct.pack("=2i", 1, len(columns[0])))
+        for column, factor in zip(columns, factors):
+            f.write((column * factor).astype("<f8").tobytes())
+
+
+def test_OrbitOblData(tmp_path):
+    for file in ["vpl.in", "sun.in", "text.in", "binary.in"]:
+        shutil.copy(path / file, tmp_path)
+    columns = forcing()
+    write_text(tmp_path / "forcing.txt", columns)
+    write_binary(tmp_path / "forcing.bin", columns)
+    subprocess.check_output(
+        [str(path / "../../../bin/vplanet"), "vpl.in", "-q"], cwd=tmp_path
+    )
+    output = vplanet.get_output(str(tmp_path))
+    text = output.text
+    binary = output.binary
+
+    # Text and binary copies of the forcing give the same evolution
+    for param in ["PrecA", "TGlobal", "AlbedoGlobal", "FluxOutGlobal", "Obliquity"]:
+        assert np.array_equal(
+            getattr(binary, param).value, getattr(text, param).value
+        ), param
+    for param in ["TempLat", "AlbedoLat", "AnnInsol", "FluxOut"]:
+        assert np.array_equal(
+            getattr(binary, param).value, getattr(text, param).value
+        ), param
+
+    # Like the other forcings, the output shows the forcing at the start of
+    # the last step. The precession angle is linear in time, so it gives
+    # that time, going the short way through 360 degrees.
+    time, semi, ecc, argp, longa, obl, preca = columns
+    t = text.Time.value
+    tau = ((text.PrecA.value - 350) % 360) / 0.05
+    assert np.all(tau <= t + 1e-6)
+    assert np.all(tau >= t - 100 - 1e-6)
+    assert np.any(tau > 200)
+
+    # The other elements are interpolated linearly to the same time
+    assert np.allclose(text.Obliquity.value, np.interp(tau, time, obl), rtol=1e-8)
+    assert np.allclose(text.Eccentricity.value, np.interp(tau, time, ecc), rtol=1e-8)
+
+    # A binary file shorter than its header says is rejected
+    data = (tmp_path / "forcing.bin").read_bytes()
+    (tmp_path / "forcing.bin").write_bytes(data[:-8])
+    proc = subprocess.run(
+        [str(path / "../../../bin/vplanet"), "vpl.in", "-q"],
+        cwd=tmp_path,
+        capture_output=True,
+    )
+    assert proc.returncode != 0
+    assert b"forcing.bin is inconsistent" in proc.stderr
+
+    # So is one that ends inside the header
+    (tmp_path / "forcing.bin").write_bytes(data[:12])
+    proc = subprocess.run(
+        [str(path / "../../../bin/vplanet"), "vpl.in", "-q"],
+        cwd=tmp_path,
+        capture_output=True,
+    )
+    assert proc.returncode != 0
+    assert b"shorter than its 16 byte header" in proc.stderr
@@ -0,0 +1,50 @@
+import pathlib
+import subprocess
+
+import numpy as np
+import pytest
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+@pytest.mark.parametrize("model", ["wk97", "hm16"])
+def test_RadTables(vplanet_output, model):
+    # The same planet with the OLR and TOA albedo fits evaluated directly and
+    # interpolated from tables. The wk97 planet has polar ice and the hm16
+    # planet is ice-free and warmer.
+    fit = getattr(vplanet_output, model)
+    table = getattr(vplanet_output, model + "tab")
+
+    assert np.allclose(table.TGlobal.value, fit.TGlobal.value, rtol=0, atol=1e-4)
+    assert np.allclose(
+        table.AlbedoGlobal.value, fit.AlbedoGlobal.value, rtol=0, atol=1e-5
+    )
+    assert np.allclose(
+        table.FluxOutGlobal.value, fit.FluxOutGlobal.value, rtol=1e-6, atol=0
+    )
+    assert np.array_equal(table.AreaIceCov.value, fit.AreaIceCov.value)
+
+    assert np.allclose(table.TempLat.value, fit.TempLat.value, rtol=0, atol=1e-4)
+    assert np.allclose(table.AlbedoLat.value, fit.AlbedoLat.value, rtol=0, atol=1e-4)
+    assert np.allclose(table.FluxOut.value, fit.FluxOut.value, rtol=0, atol=1e-4)
+
+
+def test_RadTablesSMS09(tmp_path):
+    # The sms09 fits are closed forms, so their tables are skipped with a
+    # warning
+    (tmp_path / "vpl.in").write_text(
+        (path / "vpl.in")
+        .read_text()
+        .replace("wk97.in wk97tab.in hm16.in hm16tab.in", "wk97tab.in")
+    )
+    (tmp_path / "sun.in").write_text((path / "sun.in").read_text())
+    (tmp_path / "wk97tab.in").write_text(
+        (path / "wk97tab.in").read_text().replace("wk97 ", "sms09")
+    )
+    proc = subprocess.run(
+        [str(path / "../../../bin/vplanet"), "vpl.in"],
+        cwd=tmp_path,
+        capture_output=True,
+    )
+    assert proc.returncode == 0
+    assert b"bRadTables = 1 has no effect with iOLRModel = sms09" in proc.stderr
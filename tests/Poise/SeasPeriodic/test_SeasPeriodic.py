@@ -0,0 +1,34 @@
+import numpy as np
+
+# dSeasPeriodTol of the periodic planet [deg C]
+dTol = 1e-3
+
+
+def test_SeasPeriodic(vplanet_output):
+    earth = vplanet_output.earth
+    periodic = vplanet_output.periodic
+
+    # The default runs every orbit; the first run starts far from the
+    # periodic state and runs them all, the later ones stop early
+    assert np.all(earth.SeasYears == 20)
+    assert periodic.SeasYears[0] == 20
+    assert np.all(periodic.SeasYears[1:] < 20)
+
+    # The stopped runs agree with the full runs to about the tolerance
+    assert np.allclose(periodic.TGlobal.value, earth.TGlobal.value, rtol=0, atol=dTol)
+    assert np.allclose(periodic.TempLat.value, earth.TempLat.value, rtol=0, atol=dTol)
+    assert np.allclose(
+        periodic.TempMaxLat.value, earth.TempMaxLat.value, rtol=0, atol=dTol
+    )
+    assert np.allclose(
+        periodic.TempMinLat.value, earth.TempMinLat.value, rtol=0, atol=dTol
+    )
+    assert np.array_equal(periodic.AlbedoGlobal.value, earth.AlbedoGlobal.value)
+
+    # The ice balance of the skipped orbits is filled in from the last one
+    assert np.allclose(
+        periodic.TotIceMass.value, earth.TotIceMass.value, rtol=1e-3, atol=0
+    )
+    assert np.allclose(
+        periodic.TotIceBalance.value, earth.TotIceBalance.value, rtol=1e-3, atol=0
+    )
@@ -0,0 +1,77 @@
+import os
+import pathlib
+import select
+import shutil
+import subprocess
+import time
+
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def read_reports(proc, count, timeout=30):
+    # Lines printed by the server until count jobs are reported, without
+    # blocking the test forever
+    text = ""
+    reports = {}
+    deadline = time.time() + timeout
+    while len(reports) < count:
+        ready, _, _ = select.select([proc.stdout], [], [], deadline - time.time())
+        assert ready, "The server did not report the jobs."
+        chunk = os.read(proc.stdout.fileno(), 4096).decode()
+        assert chunk, "The server exited early."
+        text += chunk
+        for line in text.splitlines():
+            if line.endswith("/vpl.in 0") or line.endswith("/vpl.in 1"):
+                job, status = line.rsplit(" ", 1)
+                reports[job] = int(status)
+    return reports
+
+
+def test_FifoJobs(vplanet_output, tmp_path):
+    # Two jobs, one of them in a directory whose name contains a space
+    jobs = ["job one/vpl.in", "job2/vpl.in"]
+    for job in jobs:
+        (tmp_path / job).parent.mkdir()
+        for file in ["vpl.in", "star.in"]:
+            shutil.copy(path / file, (tmp_path / job).parent)
+
+    proc = subprocess.Popen(
+        [str(path / "../../../bin/vplanet"), "-q", "-c", "2", "-server", "jobs.fifo"],
+        cwd=tmp_path,
+        stdout=subprocess.PIPE,
+    )
+    try:
+        for _ in range(100):
+            if (tmp_path / "jobs.fifo").exists():
+                break
+            time.sleep(0.1)
+        with open(tmp_path / "jobs.fifo", "w") as fifo:
+            for job in jobs:
+                fifo.write(job + "\n")
+            fifo.flush()
+
+            # Each finished job is reported with its exit code before quit,
+            # even though -q silences the jobs
+            assert read_reports(proc, len(jobs)) == {job: 0 for job in jobs}
+
+            fifo.write("quit\n")
+        assert proc.wait(timeout=30) == 0
+    finally:
+        if proc.poll() is None:
+            proc.kill()
+
+    # The output is the same as running vpl.in directly
+    for job in jobs:
+        directory = (tmp_path / job).parent
+        forward = "system.star.forward"
+        assert (directory / forward).read_text() == (path / forward).read_text()
+        output = vplanet.get_output(str(directory))
+        for param in ["Luminosity", "Radius", "Temperature", "RotPer"]:
+            assert np.array_equal(
+                getattr(output.log.final.star, param),
+                getattr(vplanet_output.log.final.star, param),
+            )
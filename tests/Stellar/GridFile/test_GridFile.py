@@ -0,0 +1,122 @@
+import pathlib
+import re
+import struct
+import subprocess
+
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+# Shift of log10(L/Lsun) in the upper metallicity slice of the version 2 grid
+dLogLShift = 0.2
+
+
+def builtin_grid():
+    # Read the built-in Baraffe grid from its source, so the grid files hold
+    # exactly the same doubles
+    source = (path / "../../../src/bodygrids.c").read_text()
+
+    def array(name):
+        match = re.search(
+            r"double const {}\[[^=]*=\s*{{(.*?)}};".format(name), source, re.S
+        )
+        tokens = re.findall(r"NAN|[-+]?\d[\d.]*(?:[eE][-+]?\d+)?", match.group(1))
+        return np.array([np.nan if t == "NAN" else float(t) for t in tokens])
+
+    mass = array("STELLAR_BAR_MARR")
+    age = array("STELLAR_BAR_AARR")
+    data = [
+        array(name) for name in ["DATA_LOGL", "DATA_RADIUS", "DATA_LOGT", "DATA_RG"]
+    ]
+    for block in data:
+        assert len(block) == len(mass) * len(age)
+    return mass, age, data
+
+
+def write_grid(file, version, mass, age, met, data):
+    # The layout read by fvLoadStellarGrid in src/body.c
+    with open(file, "wb") as f:
+        f.write(b"VPLSTGRD")
+        f.write(struct.pack("=4i", version, len(mass), len(age), len(met)))
+        for axis in [mass, age, met]:
+            f.write(np.asarray(axis, dtype="<f8").tobytes())
+        for block in data:
+            f.write(np.asarray(block, dtype="<f8").tobytes())
+
+
+def run_with(tmp_path, name, options, fixed=False):
+    # Run the star with extra options, optionally with fixed time steps
+    dest = tmp_path / name
+    dest.mkdir()
+    primary = (path / "vpl.in").read_text()
+    if fixed:
+        primary = primary.replace("bVarDt        1", "bVarDt        0")
+        primary += "dTimeStep     1e5\n"
+    (dest / "vpl.in").write_text(primary)
+    (dest / "a.in").write_text((path / "a.in").read_text() + options)
+    return (
+        subprocess.run(
+            [str(path / "../../../bin/vplanet"), "vpl.in", "-q"],
+            cwd=dest,
+            capture_output=True,
+        ),
+        dest,
+    )
+
+
+def test_GridFile(vplanet_output, tmp_path):
+    mass, age, data = builtin_grid()
+    default = vplanet_output.a
+
+    # A version 1 copy of the built-in grid gives the same evolution
+    write_grid(tmp_path / "v1.grd", 1, mass, age, [], data)
+    proc, dest = run_with(
+        tmp_path, "v1", "sStellarGridFile {}\n".format(tmp_path / "v1.grd")
+    )
+    assert proc.returncode == 0
+    v1 = vplanet.get_output(str(dest)).a
+    for param in ["RotPer", "Luminosity", "Radius", "Temperature", "RadGyra"]:
+        assert np.array_equal(
+            getattr(v1, param).value, getattr(default, param).value
+        ), param
+
+    # A version 2 grid with the built-in grid at [Fe/H] = -1 and brighter
+    # stars at [Fe/H] = 1: halfway between, only the luminosity changes. The
+    # time steps would follow the luminosity, so both runs use fixed steps
+    met = [-1.0, 1.0]
+    data2 = [np.concatenate([block, block]) for block in data]
+    data2[0][len(mass) * len(age) :] += dLogLShift
+    write_grid(tmp_path / "v2.grd", 2, mass, age, met, data2)
+    proc, dest = run_with(tmp_path, "builtin", "", fixed=True)
+    assert proc.returncode == 0
+    builtin = vplanet.get_output(str(dest)).a
+    proc, dest = run_with(
+        tmp_path,
+        "v2",
+        "sStellarGridFile {}\ndStellarMetallicity 0\n".format(tmp_path / "v2.grd"),
+        fixed=True,
+    )
+    assert proc.returncode == 0
+    v2 = vplanet.get_output(str(dest)).a
+    for param in ["RotPer", "Radius", "Temperature", "RadGyra"]:
+        assert np.allclose(
+            getattr(v2, param).value, getattr(builtin, param).value, rtol=1e-10
+        ), param
+    assert np.allclose(
+        v2.Luminosity.value,
+        builtin.Luminosity.value * 10 ** (dLogLShift / 2),
+        rtol=1e-10,
+    )
+
+    # Metallicities outside the grid are rejected
+    proc, dest = run_with(
+        tmp_path,
+        "outside",
+        "sStellarGridFile {}\ndStellarMetallicity 1.5\n".format(tmp_path / "v2.grd"),
+    )
+    assert proc.returncode != 0
+    # The error points at the dStellarMetallicity line
+    line = len((path / "a.in").read_text().splitlines()) + 2
+    assert "a.in: Line {}".format(line) in proc.stderr.decode()
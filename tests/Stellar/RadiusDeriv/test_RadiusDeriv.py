@@ -0,0 +1,58 @@
+import pathlib
+import shutil
+import subprocess
+
+import astropy.units as u
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+# Half the age difference of the finite difference, small compared to the
+# grid cell (4.5e7 yr lies between the nodes at 3.8e7 and 5.3e7 yr)
+dAgeStep = 1e4 * u.yr
+
+
+def run_at_age(tmp_path, dAge):
+    # Run the stars at another age and return the initial values of the log
+    dest = tmp_path / "{:.0f}".format(dAge.to(u.yr).value)
+    dest.mkdir()
+    shutil.copy(path / "vpl.in", dest)
+    for file in ["a.in", "b.in"]:
+        text = (path / file).read_text()
+        text = text.replace(
+            "dAge                4.5e7",
+            "dAge                {:.10g}".format(dAge.to(u.yr).value),
+        )
+        (dest / file).write_text(text)
+    subprocess.check_output(
+        [str(path / "../../../bin/vplanet"), "vpl.in", "-q"], cwd=dest
+    )
+    return vplanet.get_output(str(dest)).log.initial
+
+
+def test_RadiusDeriv(vplanet_output, tmp_path):
+    dAge = 4.5e7 * u.yr
+    young = run_at_age(tmp_path, dAge - dAgeStep)
+    old = run_at_age(tmp_path, dAge + dAgeStep)
+    initial = vplanet_output.log.initial
+
+    # Rates of change from central differences of the interpolated grid
+    dRadius = (old.a.Radius - young.a.Radius) / (2 * dAgeStep)
+    dRadGyra = (old.a.RadGyra - young.a.RadGyra) / (2 * dAgeStep)
+
+    # Without magnetic braking the star spins up as it contracts, so
+    # dP/dt = 2 P (dR/dt / R + dr_g/dt / r_g)
+    dDRadius = (2 * initial.b.RotPer * dRadius / initial.b.Radius).to(u.Unit(""))
+    assert np.isclose(
+        initial.b.DRotPerDtStellar.value, dDRadius.value, rtol=1e-5, atol=0
+    )
+
+    dDRadGyra = (2 * initial.a.RotPer * dRadGyra / initial.a.RadGyra).to(u.Unit(""))
+    assert np.isclose(
+        initial.a.DRotPerDtStellar.value,
+        (dDRadius + dDRadGyra).value,
+        rtol=1e-5,
+        atol=0,
+    )
@@ -0,0 +1,80 @@
+import pathlib
+import shutil
+import subprocess
+
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def run_sweep(tmp_path, file, inputs, size):
+    # The same sweep with iEnsembleSize set to size, in its own directory
+    dir = tmp_path / "size{}".format(size)
+    dir.mkdir()
+    for name in inputs:
+        shutil.copy(path / name, dir)
+    text = (path / file).read_text()
+    (dir / file).write_text(
+        text.replace("iEnsembleSize  4", "iEnsembleSize  {}".format(size))
+    )
+    subprocess.check_output(
+        [str(path / "../../../bin/vplanet"), "-q", "-sweep", file], cwd=dir
+    )
+    return dir
+
+
+def compare_sweeps(tmp_path, file, inputs, name):
+    # Members integrated in lockstep give the same files as members that
+    # are integrated one at a time. The inputs print 16 digits, so the
+    # files agree to the last bit of every output.
+    single = vplanet.Archive(run_sweep(tmp_path, file, inputs, 1) / name)
+    lockstep = vplanet.Archive(run_sweep(tmp_path, file, inputs, 4) / name)
+    assert len(lockstep) == len(single)
+    members = {member.name: member for member in single}
+    for member in lockstep:
+        assert member.status == 0
+        other = members[member.name]
+        assert member.values == other.values
+        assert sorted(member.files) == sorted(other.files)
+        for file in member.files:
+            if isinstance(member.files[file], str):
+                assert member.files[file] == other.files[file], file
+            else:
+                for column in member.files[file]:
+                    assert np.array_equal(
+                        member.files[file][column], other.files[file][column]
+                    ), (member.name, file, column)
+    return lockstep
+
+
+def test_Ensemble(tmp_path):
+    # Constant time lag tides, radiogenic heating and the thermal interior
+    archive = compare_sweeps(
+        tmp_path, "vspace.in", ["vpl.in", "sun.in", "earth.in"], "tides.vpa"
+    )
+    assert len(archive) == 6
+    for member in archive:
+        forward = member.files["tides.earth.forward"]
+        assert np.isclose(forward["Time[Gyr]"][-1], 1e-4)
+
+
+def test_EnsembleHalts(tmp_path):
+    # Constant phase lag tides between two pre-main-sequence stars. The
+    # less eccentric members halt before their first step, and one of the
+    # others in the middle of its group's steps.
+    archive = compare_sweeps(
+        tmp_path,
+        "vspace_binary.in",
+        ["binary.in", "primary.in", "secondary.in"],
+        "binary.vpa",
+    )
+    assert len(archive) == 9
+    times = [
+        member.files["binary.secondary.forward"]["Time[year]"][-1]
+        for member in archive
+    ]
+    assert sum(time == 0 for time in times) == 6
+    assert sum(0 < time < 1e5 for time in times) == 1
+    assert sum(np.isclose(time, 1e5) for time in times) == 2
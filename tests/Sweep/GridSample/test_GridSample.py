@@ -0,0 +1,128 @@
+import itertools
+import pathlib
+import re
+import shutil
+import subprocess
+
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+
+
+def run_sweep(tmp_path, file):
+    for name in ["vpl.in", "star.in", file]:
+        shutil.copy(path / name, tmp_path)
+    subprocess.check_output(
+        [str(path / "../../../bin/vplanet"), "-q", "-sweep", file], cwd=tmp_path
+    )
+
+
+def log_value(log, param):
+    # Initial value of a parameter in the text of an archived log
+    return float(re.search(r"\(%s\)[^:]*: (\S+)" % param, log).group(1))
+
+
+def test_GridSample(tmp_path):
+    run_sweep(tmp_path, "vspace.in")
+    archive = vplanet.Archive(tmp_path / "grid.vpa")
+    assert len(archive) == 27
+
+    # Every combination of the linear, logarithmic and stepped grids
+    values = sorted(
+        (
+            member.values["star.in:dMass"],
+            member.values["star.in:dRadius"],
+            member.values["vpl.in:dStopTime"],
+        )
+        for member in archive
+    )
+    expected = list(
+        itertools.product([0.5, 0.75, 1.0], [0.001, 0.002, 0.004], [100, 200, 300])
+    )
+    assert np.allclose(values, expected, rtol=1e-12, atol=0)
+
+    for member in archive:
+        assert member.status == 0
+        log = member.files["system.log"]
+        assert np.isclose(
+            log_value(log, "Mass"), member.values["star.in:dMass"] * 1.988416e30
+        )
+        forward = member.files["system.star.forward"]
+        assert np.isclose(forward["Time[year]"][-1], member.values["vpl.in:dStopTime"])
+
+    # The member with the template's values matches running vpl.in directly
+    direct = tmp_path / "direct"
+    direct.mkdir()
+    for name in ["vpl.in", "star.in"]:
+        shutil.copy(path / name, direct)
+    subprocess.check_output(
+        [str(path / "../../../bin/vplanet"), "vpl.in", "-q"], cwd=direct
+    )
+    member = [member for member in archive if member.name == "test_m2r2t2"][0]
+    assert member.files["system.log"] == (direct / "system.log").read_text()
+
+
+def test_RandomSample(tmp_path):
+    run_sweep(tmp_path, "vspace_random.in")
+    archive = vplanet.Archive(tmp_path / "random.vpa")
+    assert len(archive) == 20
+
+    values = np.array(
+        [
+            [
+                member.values["star.in:dMass"],
+                member.values["star.in:dRadius"],
+                member.values["star.in:dRotPeriod"],
+            ]
+            for member in archive
+        ]
+    )
+    assert np.all((values[:, 0] >= 0.5) & (values[:, 0] <= 1.0))
+    assert np.all((values[:, 1] >= 0.001) & (values[:, 1] <= 0.01))
+    assert np.all((values[:, 2] >= -1.2) & (values[:, 2] <= -0.9))
+    assert all(member.status == 0 for member in archive)
+
+    # The same seed draws the same members
+    again = tmp_path / "again"
+    again.mkdir()
+    run_sweep(again, "vspace_random.in")
+    repeat = vplanet.Archive(again / "random.vpa")
+    for member in archive:
+        assert repeat[member.index].values == member.values
+
+
+def test_FailedMembers(tmp_path):
+    # A negative dEta is rejected, so one of the two members fails. It is
+    # still archived, and the sweep as a whole fails.
+    for name in ["vpl.in", "star.in"]:
+        shutil.copy(path / name, tmp_path)
+    (tmp_path / "vspace.in").write_text(
+        "sDestFolder fail\nsTrialName test_\nsBodyFile star.in\n"
+        "sPrimaryFile vpl.in\ndEta [-0.1, 0.1, n2] e\n"
+    )
+    proc = subprocess.run(
+        [str(path / "../../../bin/vplanet"), "-q", "-sweep", "vspace.in"],
+        cwd=tmp_path,
+        capture_output=True,
+    )
+    assert proc.returncode != 0
+    archive = vplanet.Archive(tmp_path / "fail.vpa")
+    assert {member.name: member.status for member in archive} == {
+        "test_e0": 2,
+        "test_e1": 0,
+    }
+
+    # Names longer than their buffers are errors, not overflows
+    (tmp_path / "long.in").write_text(
+        "sTrialName {}\nsBodyFile star.in\nsPrimaryFile vpl.in\n".format("x" * 120)
+    )
+    proc = subprocess.run(
+        [str(path / "../../../bin/vplanet"), "-q", "-sweep", "long.in"],
+        cwd=tmp_path,
+        capture_output=True,
+    )
+    assert proc.returncode != 0
+    assert b"is longer than 99 characters" in proc.stderr
+    assert b"long.in: Line 1" in proc.stderr
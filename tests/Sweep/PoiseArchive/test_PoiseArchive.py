@@ -0,0 +1,82 @@
+import pathlib
+import shutil
+import subprocess
+
+import numpy as np
+
+import vplanet
+
+path = pathlib.Path(__file__).parents[0].absolute()
+inputs = ["vpl.in", "sun.in", "earth.in"]
+
+
+def run(args, cwd):
+    subprocess.check_output([str(path / "../../../bin/vplanet")] + args, cwd=cwd)
+
+
+def test_PoiseArchive(tmp_path):
+    # Run the sweep, which must archive the SeasonalClimateFiles directory
+    for file in inputs + ["vspace.in"]:
+        shutil.copy(path / file, tmp_path)
+    run(["-q", "-c", "2", "-sweep", "vspace.in"], tmp_path)
+    archive = vplanet.Archive(tmp_path / "sweep.vpa")
+    assert len(archive) == 2
+
+    for member in archive:
+        assert member.status == 0
+
+        # Run the same member directly
+        direct = tmp_path / member.name
+        direct.mkdir()
+        for file in inputs:
+            shutil.copy(path / file, direct)
+        earth = (
+            (path / "earth.in")
+            .read_text()
+            .replace(
+                "dObliquity 55",
+                "dObliquity {!r}".format(member.values["earth.in:dObliquity"]),
+            )
+        )
+        (direct / "earth.in").write_text(earth)
+        run(["vpl.in", "-q"], direct)
+
+        # Every output file must have been archived unchanged
+        files = sorted(
+            str(file.relative_to(direct))
+            for file in direct.rglob("*")
+            if file.is_file() and file.name not in inputs
+        )
+        assert sorted(member.files) == files
+        assert "SeasonalClimateFiles/icebelt.earth.SeasonalTemp.0" in files
+        for file in files:
+            archived = member.files[file]
+            if isinstance(archived, dict):
+                data = np.loadtxt(direct / file, ndmin=2).T
+                assert np.array_equal(np.array(list(archived.values())), data)
+            else:
+                assert archived == (direct / file).read_text()
+
+
+def test_ArchiveFiles(tmp_path):
+    # Only the selected time series are archived, and always the log
+    for file in inputs:
+        shutil.copy(path / file, tmp_path)
+    (tmp_path / "vspace.in").write_text(
+        (path / "vspace.in").read_text()
+        + "saArchiveFiles *.earth.forward SeasonalClimateFiles/*.PlanckB.*\n"
+    )
+    run(["-q", "-c", "2", "-sweep", "vspace.in"], tmp_path)
+    archive = vplanet.Archive(tmp_path / "sweep.vpa")
+    assert len(archive) == 2
+    for member in archive:
+        assert member.status == 0
+        seasonal = [file for file in member.files if "/" in file]
+        assert len(seasonal) > 0
+        for file in seasonal:
+            assert file.startswith("SeasonalClimateFiles/icebelt.earth.PlanckB.")
+        assert sorted(set(member.files) - set(seasonal)) == [
+            "icebelt.earth.forward",
+            "icebelt.log",
+        ]
+        assert "Time" in list(member.files["icebelt.earth.forward"])[0]
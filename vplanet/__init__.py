@@ -11,6 +11,9 @@ __version__ = version().decode("utf-8")
 # Import the rest of the user-facing stuff
 from .log import Log, LogBody, LogStage
 
+# Import the sweep archive reader
+from .archive import Archive, ArchiveMember
+
 # Import the logger
 from .logger import logger
 from .output import Body, Output, get_output
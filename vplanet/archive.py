@@ -0,0 +1,136 @@
+# -*- coding: utf-8 -*-
+import mmap
+import struct
+
+import numpy as np
+
+__all__ = ["Archive", "ArchiveMember"]
+
+MAGIC = b"VPLSWEEP"
+BLOCK_TEXT = 0
+BLOCK_COLUMNS = 1
+
+
+class ArchiveMember(object):
+    """
+    One member of a sweep archive.
+
+    Attributes:
+        index (int): The member index in the sweep.
+        status (int): The exit code of the member's run.
+        name (str): The name of the member, as used by ``vspace``.
+        values (dict): The swept values, keyed by ``file:option``.
+        files (dict): The output files, keyed by file name relative to the
+            member's directory. Text files are ``str``; forward and backward
+            time series are ``dict`` objects mapping each column name to a
+            ``numpy`` array.
+    """
+
+    def __init__(self, index, status, name, values, files):
+        self.index = index
+        self.status = status
+        self.name = name
+        self.values = values
+        self.files = files
+
+    def __repr__(self):
+        return "<vplanet.ArchiveMember: {}>".format(self.name)
+
+
+class Archive(object):
+    """
+    Read the ``.vpa`` archive written by ``vplanet -sweep``.
+
+    The layout is described in ``src/sweep.c``. The file is memory-mapped
+    and members are read through the offset index at the end of the file,
+    so loading a member only reads the pages of that member. Time series
+    are ``numpy`` views of the mapped file.
+
+    Args:
+        path (str): The path to the archive.
+    """
+
+    def __init__(self, path):
+        self.path = path
+        with open(path, "rb") as f:
+            if f.seek(0, 2) < 32:
+                raise ValueError("{} is not a sweep archive.".format(path))
+            # The mapping stays valid after the file is closed
+            self._data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        if self._data[:8] != MAGIC:
+            raise ValueError("{} is not a sweep archive.".format(path))
+        self.version, self.size = struct.unpack_from("=ii", self._data, 8)
+        if self._data[-8:] != MAGIC:
+            raise ValueError("{} has no index; the sweep was interrupted.".format(path))
+        (offset,) = struct.unpack_from("=q", self._data, len(self._data) - 16)
+        if self._data[offset : offset + 4] != b"INDX":
+            raise ValueError("{} has a corrupt index.".format(path))
+        (count,) = struct.unpack_from("=i", self._data, offset + 4)
+        self._offset = {}
+        pos = offset + 8
+        for _ in range(count):
+            member, moffset = struct.unpack_from("=iq", self._data, pos)
+            self._offset[member] = moffset
+            pos += 12
+
+    def __len__(self):
+        return len(self._offset)
+
+    def __iter__(self):
+        for member in sorted(self._offset):
+            yield self[member]
+
+    def __getitem__(self, member):
+        return self._read_member(self._offset[member])
+
+    def _int(self, pos):
+        return struct.unpack_from("=i", self._data, pos)[0], pos + 4
+
+    def _long(self, pos):
+        return struct.unpack_from("=q", self._data, pos)[0], pos + 8
+
+    def _string(self, pos):
+        length, pos = self._int(pos)
+        return self._data[pos : pos + length].decode("utf-8"), pos + length
+
+    def _read_member(self, pos):
+        if self._data[pos : pos + 4] != b"MEMB":
+            raise ValueError("{} has a corrupt member record.".format(self.path))
+        index, pos = self._int(pos + 4)
+        status, pos = self._int(pos)
+        name, pos = self._string(pos)
+
+        values = {}
+        nvalues, pos = self._int(pos)
+        for _ in range(nvalues):
+            option, pos = self._string(pos)
+            values[option] = struct.unpack_from("=d", self._data, pos)[0]
+            pos += 8
+
+        files = {}
+        nblocks, pos = self._int(pos)
+        for _ in range(nblocks):
+            kind, pos = self._int(pos)
+            file, pos = self._string(pos)
+            if kind == BLOCK_TEXT:
+                nbytes, pos = self._long(pos)
+                files[file] = self._data[pos : pos + nbytes].decode("utf-8")
+                pos += nbytes
+            elif kind == BLOCK_COLUMNS:
+                names, pos = self._string(pos)
+                ncols, pos = self._int(pos)
+                nrows, pos = self._long(pos)
+                data = np.frombuffer(
+                    self._data, dtype=np.float64, count=ncols * nrows, offset=pos
+                ).reshape(ncols, nrows)
+                pos += 8 * ncols * nrows
+                names = names.split()
+                if len(names) != ncols:
+                    names = ["{}".format(n) for n in range(ncols)]
+                files[file] = dict(zip(names, data))
+            else:
+                raise ValueError(
+                    "{} has an unknown block type {}.".format(self.path, kind)
+                )
+
+        return ArchiveMember(index, status, name, values, files)